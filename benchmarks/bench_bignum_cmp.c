@@ -20,6 +20,9 @@
  *   - rev 1.1 (13.08.2025): Реализована предварительная генерация данных.
  *   - rev 1.2 (13.08.2025): Добавлены локальные определения констант
  *                           BIGNUM_CAPACITY и BIGNUM_BITS для компиляции.
+ *   - rev 1.3 (16.10.2026): Локальные определения удалены: BIGNUM_CAPACITY
+ *                           берётся из bignum.h (make CAPACITY=N), ядро
+ *                           получает ту же раскладку через bignum_layout.inc.
  *
  * # Сборка
  *  gcc -g -O2 -I include -no-pie -fno-omit-frame-pointer \
@@ -40,20 +43,12 @@
 #include <bignum.h>
 #include "bignum_cmp.h"
 
-// --- Локальные определения для компиляции ---
-// Эти константы должны быть синхронизированы с ассемблерным кодом.
-#define BIGNUM_CAPACITY 32
-#define BIGNUM_BITS (BIGNUM_CAPACITY * 64)
-
 // Увеличиваем количество итераций для более надежных измерений
 #define ITERATIONS (100000000u * 20)
 
 // Количество предварительно сгенерированных наборов данных
 #define PREGEN_DATA_COUNT 8192
 
-// Максимальный сдвиг
-#define MAX_SHIFT (BIGNUM_BITS - 1)
-
 /** Заполняет bignum случайными словами и устанавливает len. */
 static void init_random_bignum(bignum_t *num) {
     int used = (rand() % BIGNUM_CAPACITY) + 1;
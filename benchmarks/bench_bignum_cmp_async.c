@@ -0,0 +1,278 @@
+/**
+ * @file    bench_bignum_cmp_async.c
+ * @brief   Бенчмарк задержки цикла событий: пакетный поиск в цикле против
+ *          отправки в асинхронную очередь `bignum_async`.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Цикл событий просыпается каждые `--tick-us` микросекунд
+ *   (`clock_nanosleep` до абсолютного срока) и каждые `--every` тиков
+ *   запускает пакетное задание — `bignum_lower_bound_batch` для `--m` запросов
+ *   по `--n` отсортированным ключам (несколько миллисекунд). Задержка тика —
+ *   время от срока пробуждения до конца обработки тика; она пишется в
+ *   гистограмму (bench_histogram.h). Режимы (строки отчёта):
+ *   - `idle`   — заданий нет (нижняя граница задержки);
+ *   - `inline` — задание выполняется прямо в цикле (базовая линия): тики за
+ *                ним опаздывают на всю его длительность;
+ *   - `async`  — задание отправляется в `bignum_async` (`entries = 4`), цикл
+ *                забирает завершения по `poll` на `fd` без ожидания; если все
+ *                места заняты, задание пропускается (`dropped`).
+ *
+ *   Колонки: тики, выполненные и пропущенные задания, p50/p99/p99.9/max
+ *   задержки тика в микросекундах. На одном ядре рабочий поток делит его с
+ *   циклом, и задержка `async` определяется планировщиком.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_async [--ticks=20000] [--tick-us=100] [--every=500]
+ *                              [--n=65536] [--m=65536] [--threads=T] [--seed=S]
+ *                              [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_async REPORT_NAME=baseline
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <poll.h>
+#include <time.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_async.h"
+#include "bignum_cmp_search.h"
+#include "bignum_cmp_topk.h"
+#include "bench_harness.h"
+#include "bench_histogram.h"
+#include "bench_inputs.h"
+
+#define ENTRIES 4
+
+typedef enum { MODE_IDLE = 0, MODE_INLINE, MODE_ASYNC, MODE_COUNT } loop_mode_t;
+
+static const char *const mode_names[MODE_COUNT] = { "idle", "inline", "async" };
+
+typedef struct {
+    uint64_t ticks, done, dropped;
+    double   p50, p99, p999, max;     /* мкс */
+} loop_result_t;
+
+static uint64_t now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
+}
+
+static void sleep_until(uint64_t ns)
+{
+    struct timespec t = { (time_t)(ns / 1000000000ull), (long)(ns % 1000000000ull) };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL) != 0) {
+    }
+}
+
+typedef struct {
+    const bignum_t *keys, *xs;
+    size_t          n, m;
+    size_t         *pos[ENTRIES];
+} job_data_t;
+
+/** Забирает завершения и освобождает их места. */
+static void reap(bignum_async_t *q, int *busy, uint64_t *done)
+{
+    struct pollfd p = { .fd = q->fd, .events = POLLIN };
+    if (poll(&p, 1, 0) != 1) {
+        return;
+    }
+    bignum_async_cqe_t cqe[ENTRIES];
+    size_t k = bignum_async_reap(q, cqe, ENTRIES);
+    for (size_t i = 0; i < k; ++i) {
+        busy[cqe[i].user_data] = 0;
+        *done += cqe[i].status == BIGNUM_ASYNC_OK;
+    }
+}
+
+static int run_loop(loop_mode_t mode, const job_data_t *jd, uint64_t ticks, uint64_t tick_ns,
+                    uint64_t every, unsigned threads, bench_hist_t *h, loop_result_t *res)
+{
+    bignum_async_t q;
+    int busy[ENTRIES] = { 0 };
+    memset(res, 0, sizeof(*res));
+    bench_hist_reset(h);
+    if (mode == MODE_ASYNC && bignum_async_init(&q, ENTRIES, threads) != BIGNUM_ASYNC_OK) {
+        return 0;
+    }
+
+    uint64_t deadline = now_ns();
+    for (uint64_t t = 0; t < ticks; ++t) {
+        deadline += tick_ns;
+        sleep_until(deadline);
+        if (mode == MODE_ASYNC) {
+            reap(&q, busy, &res->done);
+        }
+        if (mode != MODE_IDLE && t % every == 0) {
+            if (mode == MODE_INLINE) {
+                bignum_lower_bound_batch(jd->keys, jd->n, jd->xs, jd->m, jd->pos[0]);
+                res->done++;
+            } else {
+                int slot = 0;
+                while (slot < ENTRIES && busy[slot]) {
+                    ++slot;
+                }
+                bignum_async_sqe_t s = { .op = BIGNUM_ASYNC_OP_LOWER_BOUND, .user_data = (uint64_t)slot,
+                                         .a = jd->keys, .n = jd->n, .b = jd->xs, .m = jd->m,
+                                         .pos_out = slot < ENTRIES ? jd->pos[slot] : NULL };
+                if (slot < ENTRIES && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_OK) {
+                    busy[slot] = 1;
+                } else {
+                    res->dropped++;
+                }
+            }
+        }
+        uint64_t end = now_ns();
+        bench_hist_record(h, end > deadline ? end - deadline : 0);
+        if (end > deadline + tick_ns) {
+            deadline = end - tick_ns;   /* пропущенные тики не догоняются пачкой */
+        }
+    }
+
+    if (mode == MODE_ASYNC) {
+        bignum_async_cqe_t cqe[ENTRIES];
+        size_t k;
+        while ((k = bignum_async_wait(&q, cqe, ENTRIES)) > 0) {
+            for (size_t i = 0; i < k; ++i) {
+                res->done += cqe[i].status == BIGNUM_ASYNC_OK;
+            }
+        }
+        bignum_async_free(&q);
+    }
+    res->ticks = ticks;
+    res->p50   = (double)bench_hist_percentile(h, 50.0) / 1e3;
+    res->p99   = (double)bench_hist_percentile(h, 99.0) / 1e3;
+    res->p999  = (double)bench_hist_percentile(h, 99.9) / 1e3;
+    res->max   = (double)h->max / 1e3;
+    return 1;
+}
+
+static void report_row(FILE *fp, bench_fmt_t fmt, int first, const char *label, const loop_result_t *r)
+{
+    if (fmt == BENCH_FMT_CSV) {
+        fprintf(fp, "%s,%llu,%llu,%llu,%.2f,%.2f,%.2f,%.2f\n", label, (unsigned long long)r->ticks,
+                (unsigned long long)r->done, (unsigned long long)r->dropped, r->p50, r->p99, r->p999, r->max);
+    } else if (fmt == BENCH_FMT_JSON) {
+        fprintf(fp, "%s  {\"label\": \"%s\", \"ticks\": %llu, \"jobs\": %llu, \"dropped\": %llu, "
+                    "\"p50_us\": %.2f, \"p99_us\": %.2f, \"p999_us\": %.2f, \"max_us\": %.2f}",
+                first ? "" : ",\n", label, (unsigned long long)r->ticks, (unsigned long long)r->done,
+                (unsigned long long)r->dropped, r->p50, r->p99, r->p999, r->max);
+    } else {
+        fprintf(fp, "%-10s %10llu %8llu %8llu %10.2f %10.2f %10.2f %10.2f\n", label,
+                (unsigned long long)r->ticks, (unsigned long long)r->done, (unsigned long long)r->dropped,
+                r->p50, r->p99, r->p999, r->max);
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--ticks=20000] [--tick-us=100] [--every=500] [--n=65536] [--m=65536]\n"
+            "          [--threads=T] [--seed=S] [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t ticks = 20000, tick_us = 100, every = 500, seed = 0;
+    size_t n = 65536, m = 65536;
+    unsigned threads = 0;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--ticks=", 8) == 0)   { ticks = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--tick-us=", 10) == 0) { tick_us = strtoull(arg + 10, NULL, 10); }
+        else if (strncmp(arg, "--every=", 8) == 0)   { every = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--n=", 4) == 0)       { n = (size_t)strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--m=", 4) == 0)       { m = (size_t)strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--threads=", 10) == 0) { threads = (unsigned)strtoul(arg + 10, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (ticks == 0 || tick_us == 0 || every == 0 || n == 0 || m == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    job_data_t jd = { 0 };
+    bignum_t *keys = malloc(sizeof(bignum_t) * n);
+    bignum_t *xs   = malloc(sizeof(bignum_t) * m);
+    int ok = keys != NULL && xs != NULL;
+    for (int s = 0; s < ENTRIES; ++s) {
+        jd.pos[s] = malloc(sizeof(size_t) * m);
+        ok = ok && jd.pos[s] != NULL;
+    }
+    if (!ok) {
+        perror("Failed to allocate memory for test data");
+        free(keys);
+        free(xs);
+        for (int s = 0; s < ENTRIES; ++s) {
+            free(jd.pos[s]);
+        }
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < n; ++i) {
+        bench_random_bignum(&keys[i], bench_skewed_len(&rng), &rng);
+    }
+    for (size_t i = 0; i < m; ++i) {
+        bench_random_bignum(&xs[i], bench_skewed_len(&rng), &rng);
+    }
+    bignum_partial_sort(keys, n, n);
+    jd = (job_data_t){ keys, xs, n, m, { jd.pos[0], jd.pos[1], jd.pos[2], jd.pos[3] } };
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        ok = 0;
+    }
+    bench_hist_t *h = aligned_alloc(64, sizeof(bench_hist_t));
+    if (ok && h != NULL) {
+        if (fmt == BENCH_FMT_CSV) {
+            fprintf(fp, "label,ticks,jobs,dropped,p50_us,p99_us,p999_us,max_us\n");
+        } else if (fmt == BENCH_FMT_JSON) {
+            fputs("[\n", fp);
+        } else {
+            fprintf(fp, "%-10s %10s %8s %8s %10s %10s %10s %10s\n", "mode", "ticks", "jobs", "dropped",
+                    "p50,us", "p99,us", "p99.9,us", "max,us");
+        }
+        loop_result_t res;
+        for (int mode = 0; mode < MODE_COUNT; ++mode) {
+            if (!run_loop((loop_mode_t)mode, &jd, ticks, tick_us * 1000, every, threads, h, &res)) {
+                fprintf(stderr, "bignum_async_init failed\n");
+                ok = 0;
+                break;
+            }
+            report_row(fp, fmt, mode == 0, mode_names[mode], &res);
+        }
+        if (fmt == BENCH_FMT_JSON) {
+            fputs("\n]\n", fp);
+        }
+    }
+    if (fp != NULL && fp != stdout) {
+        fclose(fp);
+    }
+    free(h);
+    free(keys);
+    free(xs);
+    for (int s = 0; s < ENTRIES; ++s) {
+        free(jd.pos[s]);
+    }
+    return ok ? 0 : 1;
+}
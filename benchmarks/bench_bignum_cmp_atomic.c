@@ -0,0 +1,214 @@
+/**
+ * @file    bench_bignum_cmp_atomic.c
+ * @brief   Бенчмарк отметки максимума: `bignum_atomic_fetch_max` против
+ *          `pthread_mutex` + `bignum_cmp` по числу потоков.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Каждый из T потоков публикует `--ops / T` кандидатов `{случайное слово, i / 64}`
+ *   (`len = 2`): старшее слово медленно растёт, поэтому максимум время от
+ *   времени сдвигается, а большинство кандидатов проигрывает — как у отметки
+ *   наибольшего номера последовательности. Строки (вызов = один кандидат, по
+ *   всем потокам):
+ *   - `mutex/tN`  — `lock; if (bignum_cmp(&cand, &max) > 0) max = cand; unlock`
+ *                   (базовая линия);
+ *   - `atomic/tN` — `bignum_atomic_fetch_max`.
+ *
+ *   В stderr печатается число успешных установок.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_atomic [--ops=OPS] [--threads=1,2,4,8,16,32,64] [--seed=S]
+ *                               [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_atomic REPORT_NAME=baseline BENCH_ARGS="--threads=1,2,4,8,16,32,64"
+ */
+
+#define _GNU_SOURCE
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_atomic.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_OPS 4000000ull
+#define MAX_SWEEP   16
+#define POOL        4096                /* младших слов кандидатов */
+
+typedef struct {
+    pthread_mutex_t lock;
+    bignum_t        max;
+} locked_max_t;
+
+typedef struct {
+    locked_max_t    *lm;
+    bignum_atomic_t *am;
+    const uint64_t  *pool;
+    size_t           ops, offset;
+    size_t           wins;
+} worker_t;
+
+static void *worker(void *arg)
+{
+    worker_t *w = arg;
+    bignum_t cand;
+    size_t wins = 0;
+    cand.len = 2;
+    for (size_t i = 0; i < w->ops; ++i) {
+        cand.words[0] = w->pool[(w->offset + i) % POOL];
+        cand.words[1] = i / 64 + 1;
+        if (w->am != NULL) {
+            wins += bignum_atomic_fetch_max(w->am, &cand, NULL) == BIGNUM_ATOMIC_OK;
+        } else {
+            pthread_mutex_lock(&w->lm->lock);
+            if (bignum_cmp(&cand, &w->lm->max) > 0) {
+                w->lm->max = cand;
+                ++wins;
+            }
+            pthread_mutex_unlock(&w->lm->lock);
+        }
+    }
+    w->wins = wins;
+    return NULL;
+}
+
+/** Запускает `t` потоков; возвращает число установок или `SIZE_MAX` при ошибке. */
+static size_t run_threads(unsigned t, const worker_t *tmpl, size_t ops)
+{
+    pthread_t tids[256];
+    worker_t  args[256];
+    unsigned  started = 0;
+    size_t    wins = 0;
+    for (unsigned i = 0; i < t; ++i) {
+        args[i] = *tmpl;
+        args[i].ops = ops / t;
+        args[i].offset = (size_t)i * 997;
+        if (pthread_create(&tids[i], NULL, worker, &args[i]) != 0) {
+            break;
+        }
+        started = i + 1;
+    }
+    for (unsigned i = 0; i < started; ++i) {
+        pthread_join(tids[i], NULL);
+        wins += args[i].wins;
+    }
+    return started == t ? wins : SIZE_MAX;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--ops=OPS] [--threads=1,2,4,8,16,32,64] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t ops = DEFAULT_OPS, seed = 0;
+    unsigned threads[MAX_SWEEP] = { 1, 2, 4, 8, 16, 32, 64 };
+    size_t nthreads = 7;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--ops=", 6) == 0)     { ops = strtoull(arg + 6, NULL, 10); }
+        else if (strncmp(arg, "--threads=", 10) == 0) {
+            nthreads = 0;
+            for (const char *p = arg + 10; *p != '\0' && nthreads < MAX_SWEEP; ) {
+                char *end;
+                threads[nthreads++] = (unsigned)strtoul(p, &end, 10);
+                p = (*end == ',') ? end + 1 : end;
+                if (end == p && *end != '\0') { usage(argv[0]); return 1; }
+            }
+        }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    for (size_t t = 0; t < nthreads; ++t) {
+        if (threads[t] == 0 || threads[t] > 256) { usage(argv[0]); return 1; }
+    }
+    if (ops == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    uint64_t *pool = malloc(sizeof(uint64_t) * POOL);
+    if (pool == NULL) {
+        perror("Failed to allocate memory for test data");
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < POOL; ++i) {
+        pool[i] = bench_rng_next(&rng);
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(pool);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    locked_max_t lm;
+    pthread_mutex_init(&lm.lock, NULL);
+    char label[64];
+    bench_region_t reg;
+    for (size_t t = 0; t < nthreads; ++t) {
+        unsigned T = threads[t];
+        size_t   calls = (size_t)(ops / T) * T;
+
+        lm.max.len = 0;
+        worker_t tmpl = { &lm, NULL, pool, 0, 0, 0 };
+        bench_region_begin(&hw, &reg);
+        size_t wins = run_threads(T, &tmpl, ops);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "mutex/t%u", T);
+        if (wins != SIZE_MAX) {
+            bench_report_row(fp, fmt, t == 0, label, &reg, calls);
+            fprintf(stderr, "%s: %zu updates\n", label, wins);
+        }
+
+        bignum_atomic_t am;
+        if (bignum_atomic_init(&am, NULL) != BIGNUM_ATOMIC_OK) {
+            fprintf(stderr, "atomic/t%u: init failed\n", T);
+            continue;
+        }
+        tmpl.am = &am;
+        bench_region_begin(&hw, &reg);
+        wins = run_threads(T, &tmpl, ops);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "atomic/t%u", T);
+        if (wins != SIZE_MAX) {
+            bench_report_row(fp, fmt, 0, label, &reg, calls);
+            fprintf(stderr, "%s: %zu updates\n", label, wins);
+        }
+        bignum_atomic_free(&am);
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    pthread_mutex_destroy(&lm.lock);
+    free(pool);
+    return 0;
+}
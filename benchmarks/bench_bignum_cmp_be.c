@@ -0,0 +1,217 @@
+/**
+ * @file    bench_bignum_cmp_be.c
+ * @brief   Бенчмарк проверки big-endian полей против границы: декодирование
+ *          в `bignum_t` + `bignum_cmp` против `bignum_cmp_be_bytes` и пакета.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   `--n` полей подряд в одном буфере (раскладка `offsets`, как у
+ *   `bignum_to_ordkey_batch`) и одна граница на распределение:
+ *   - `small` — граница `2^32`, поля 1–8 байт (длины, счётчики, версии);
+ *   - `u256`  — граница 4 слова, поля по 32 байта, равные ей или отличающиеся
+ *               в младшем байте (величины RLP; худший случай — полный проход);
+ *   - `der`   — граница `min(32, BIGNUM_CAPACITY)` слов со старшим битом,
+ *               поля — DER INTEGER той же длины с ведущим `0x00`, отличающиеся
+ *               в младшем байте.
+ *
+ *   Строки (операция = одно поле):
+ *   - `decode/D` — разбор в `bignum_t` (`bswap` по словам) и `bignum_cmp`
+ *                  (базовая линия);
+ *   - `direct/D` — `bignum_cmp_be_bytes` на каждое поле;
+ *   - `batch/D`  — один вызов `bignum_cmp_be_bytes_batch` с `na == 1`.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_be [--n=1000000] [--seed=S] [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_be REPORT_NAME=baseline
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_be.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define FIELD_MAX (BIGNUM_CAPACITY * 8 + 1)
+
+typedef enum { DIST_SMALL = 0, DIST_U256, DIST_DER, DIST_COUNT } be_dist_t;
+
+static const char *const dist_names[DIST_COUNT] = { "small", "u256", "der" };
+
+/** Базовая линия: декодер протокола, переводящий поле в `bignum_t`. */
+static int decode_be(const uint8_t *p, size_t n, bignum_t *x)
+{
+    while (n > 0 && *p == 0) {
+        ++p;
+        --n;
+    }
+    size_t len = (n + 7) / 8;
+    if (len > BIGNUM_CAPACITY) {
+        return 0;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        size_t   end = n - 8 * i, beg = end > 8 ? end - 8 : 0;
+        uint64_t w   = 0;
+        if (end - beg == 8) {
+            memcpy(&w, p + beg, 8);
+            w = __builtin_bswap64(w);
+        } else {
+            for (size_t j = beg; j < end; ++j) {
+                w = w << 8 | p[j];
+            }
+        }
+        x->words[i] = w;
+    }
+    x->len = len;
+    return 1;
+}
+
+static size_t put_be(const bignum_t *x, uint8_t *out, int der)
+{
+    size_t n = 0;
+    if (der) {
+        out[n++] = 0;
+    }
+    for (size_t i = x->len; i > 0; --i) {
+        uint64_t be = __builtin_bswap64(x->words[i - 1]);
+        memcpy(out + n, &be, 8);
+        n += 8;
+    }
+    return n;
+}
+
+/** Строит границу и поля распределения. */
+static void fill(bignum_t *bound, uint8_t *buf, size_t *offs, size_t n, be_dist_t dist, uint64_t *rng)
+{
+    size_t words = dist == DIST_U256 ? 4 : 32;
+    words = words < BIGNUM_CAPACITY ? words : BIGNUM_CAPACITY;
+    if (dist == DIST_SMALL) {
+        memset(bound, 0, sizeof(*bound));
+        bound->words[0] = 1ull << 32;
+        bound->len      = 1;
+    } else {
+        bench_random_bignum(bound, words, rng);
+        bound->words[words - 1] |= 1ull << 63;
+    }
+
+    offs[0] = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint8_t *p = buf + offs[i];
+        size_t   m;
+        if (dist == DIST_SMALL) {
+            m = (size_t)(bench_rng_next(rng) % 8) + 1;
+            uint64_t v = bench_rng_next(rng);
+            for (size_t j = 0; j < m; ++j) {
+                p[j] = (uint8_t)(v >> (8 * j));
+            }
+        } else {
+            m = put_be(bound, p, dist == DIST_DER);
+            p[m - 1] ^= (uint8_t)(bench_rng_next(rng) % 3);
+        }
+        offs[i + 1] = offs[i] + m;
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [--n=1000000] [--seed=S] [--format=text|csv|json] [--out=FILE]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    size_t n = 1000000;
+    uint64_t seed = 0;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)      { n = (size_t)strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)   { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0) { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)    { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    uint8_t *buf  = malloc((size_t)FIELD_MAX * n);       /* по самому длинному полю (der) */
+    size_t  *offs = malloc(sizeof(size_t) * (n + 1));
+    int8_t  *out  = malloc(n);
+    if (buf == NULL || offs == NULL || out == NULL) {
+        perror("Failed to allocate memory for test data");
+        free(buf); free(offs); free(out);
+        return 1;
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(buf); free(offs); free(out);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    int first = 1;
+    long sink_decode = 0, sink_direct = 0, sink_batch = 0;
+    for (int d = 0; d < DIST_COUNT; ++d) {
+        uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+        bignum_t bound, x;
+        fill(&bound, buf, offs, n, (be_dist_t)d, &rng);
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < n; ++i) {
+            sink_decode += decode_be(buf + offs[i], offs[i + 1] - offs[i], &x) ? bignum_cmp(&bound, &x) : -1;
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "decode/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+        first = 0;
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < n; ++i) {
+            sink_direct += bignum_cmp_be_bytes(&bound, buf + offs[i], offs[i + 1] - offs[i]);
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "direct/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+
+        bench_region_begin(&hw, &reg);
+        bignum_cmp_be_bytes_batch(&bound, 1, buf, offs, n, out);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "batch/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+        for (size_t i = 0; i < n; ++i) {
+            sink_batch += out[i];
+        }
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    int bad = sink_decode != sink_direct || sink_direct != sink_batch;
+    if (bad) {
+        fprintf(stderr, "result mismatch: decode, direct and batch compares differ\n");
+    }
+    free(buf); free(offs); free(out);
+    return bad;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file    bench_bignum_cmp_btree.c
+ * @brief   Бенчмарк поиска: бинарный поиск с bignum_cmp против B+-индекса по префиксам.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Строит отсортированный массив из N ключей (длины — смесь `skewed`, см.
+ *   bench_inputs.h) и сравнивает три операции на одинаковых случайных запросах:
+ *   - `bsearch`     — бинарный поиск по массиву `bignum_t` через `bignum_cmp`
+ *                     (log2 N визитов в 264-байтовые ключи);
+ *   - `btree`       — `bignum_btree_lower_bound` (узлы по 3 кэш-линии, полный
+ *                     ключ читается только при совпадении префикса);
+ *   - `btree_range` — `bignum_btree_range` с обходом найденного диапазона.
+ *
+ *   Для каждой строки печатаются ns, циклы и промахи L1D/LLC на запрос (если
+ *   счётчики доступны). Цель индекса — 2–3 промаха LLC на поиск при N = 1e7,
+ *   против ~log2(N) у бинарного поиска; для N = 1e7 нужно ~2.7 ГБ под ключи.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_btree [--n=N] [--lookups=N] [--miss=PCT] [--seed=S]
+ *                              [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_btree REPORT_NAME=baseline BENCH_ARGS="--n=10000000"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_btree.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N       1000000ull
+#define DEFAULT_LOOKUPS 2000000ull
+#define DEFAULT_MISS    50
+#define RANGE_WIDTH     64
+
+static volatile size_t g_sink;
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static size_t bsearch_lower(const bignum_t *keys, size_t n, const bignum_t *x)
+{
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (bignum_cmp(&keys[mid], x) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--lookups=N] [--miss=PCT] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, lookups = DEFAULT_LOOKUPS, seed = 0;
+    unsigned miss = DEFAULT_MISS;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n       = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--lookups=", 10) == 0) { lookups = strtoull(arg + 10, NULL, 10); }
+        else if (strncmp(arg, "--miss=", 7) == 0)    { miss    = (unsigned)strtoul(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed    = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || lookups == 0 || miss > 100) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *keys   = malloc(sizeof(bignum_t) * n);
+    bignum_t *probes = malloc(sizeof(bignum_t) * 4096);
+    size_t   *order  = malloc(sizeof(size_t) * lookups);
+    if (!keys || !probes || !order) {
+        perror("Failed to allocate memory for test data");
+        free(keys); free(probes); free(order);
+        return 1;
+    }
+
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n; ++i) {
+        bench_random_bignum(&keys[i], bench_skewed_len(&rng), &rng);
+    }
+    qsort(keys, n, sizeof(bignum_t), cmp_qsort);
+
+    /* Запросы: ключи из массива (попадания) и случайные значения (промахи);
+       пул запросов мал и горяч, чтобы промахи шли от индекса, а не от запросов. */
+    for (size_t i = 0; i < 4096; ++i) {
+        if (bench_rng_next(&rng) % 100 < miss) {
+            bench_random_bignum(&probes[i], bench_skewed_len(&rng), &rng);
+        } else {
+            probes[i] = keys[bench_rng_next(&rng) % n];
+        }
+    }
+    for (uint64_t i = 0; i < lookups; ++i) {
+        order[i] = (size_t)(bench_rng_next(&rng) % 4096);
+    }
+
+    bignum_btree_t tree;
+    if (bignum_btree_build(&tree, keys, n) != BIGNUM_BTREE_OK) {
+        fprintf(stderr, "bignum_btree_build failed\n");
+        free(keys); free(probes); free(order);
+        return 1;
+    }
+    fprintf(stderr, "btree: n=%llu levels=%u index~%.1f MB (keys %.1f MB)\n",
+            (unsigned long long)n, tree.levels,
+            ((double)tree.node_count * (sizeof(bignum_btree_node_t) + BIGNUM_BTREE_FANOUT * 4)
+             + (double)n * (sizeof(uint64_t) + sizeof(int16_t))) / 1e6,
+            (double)n * sizeof(bignum_t) / 1e6);
+
+    FILE *out = stdout;
+    if (path != NULL && (out = fopen(path, "w")) == NULL) {
+        perror(path);
+        bignum_btree_free(&tree);
+        free(keys); free(probes); free(order);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(out, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    size_t acc = 0;
+
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; i < lookups; ++i) {
+        acc += bsearch_lower(keys, n, &probes[order[i]]);
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "bsearch/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 1, label, &reg, lookups);
+
+    size_t check = 0;
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; i < lookups; ++i) {
+        size_t pos;
+        bignum_btree_lower_bound(&tree, &probes[order[i]], &pos);
+        check += pos;
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "btree/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, lookups);
+    if (check != acc) {
+        fprintf(stderr, "btree: result mismatch against binary search\n");
+    }
+
+    /* Диапазон [x, x + RANGE_WIDTH ключей): поиск двух границ и обход. */
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; i < lookups; ++i) {
+        const bignum_t *lo = &probes[order[i]];
+        size_t a, b;
+        bignum_btree_lower_bound(&tree, lo, &a);
+        const bignum_t *hi = &keys[(a + RANGE_WIDTH < n) ? a + RANGE_WIDTH : n - 1];
+        bignum_btree_range(&tree, lo, hi, &a, &b);
+        for (size_t k = a; k < b; ++k) {
+            acc += keys[k].len;
+        }
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "btree_range%d/n=%llu", RANGE_WIDTH, (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, lookups);
+
+    bench_report_end(out, fmt);
+    g_sink = acc;
+
+    bench_hw_close(&hw);
+    if (out != stdout) {
+        fclose(out);
+    }
+    bignum_btree_free(&tree);
+    free(keys);
+    free(probes);
+    free(order);
+    return 0;
+}
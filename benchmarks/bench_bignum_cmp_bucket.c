@@ -0,0 +1,167 @@
+/**
+ * @file    bench_bignum_cmp_bucket.c
+ * @brief   Бенчмарк bucketize: двоичный поиск bignum_cmp на элемент против
+ *          bignum_bucketize и bignum_bucketize_mt.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   N значений (длины — смесь `skewed`, см. bench_inputs.h) распределяются по
+ *   `k + 1` корзинам; разделители — отсортированная случайная выборка из самих
+ *   значений, чтобы корзины были сопоставимого размера. Строки (вызов = один
+ *   элемент):
+ *   - `bsearch`       — upper_bound двоичным поиском `bignum_cmp` (базовая линия);
+ *   - `bucketize`     — `bignum_bucketize` (включая построение индекса);
+ *   - `bucketize_mt/tN` — `bignum_bucketize_mt` на N потоках (`--threads`).
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_bucket [--n=N] [--k=K] [--threads=1,2,4,8] [--seed=S]
+ *                               [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_bucket REPORT_NAME=baseline BENCH_ARGS="--n=10000000 --k=1023"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_bucket.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N    2000000ull
+#define DEFAULT_K    255ull
+#define MAX_SWEEP    16
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--k=K] [--threads=1,2,4,8] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, k = DEFAULT_K, seed = 0;
+    unsigned threads[MAX_SWEEP] = { 1, 2, 4, 8 };
+    size_t nthreads = 4;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--k=", 4) == 0)       { k = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--threads=", 10) == 0) {
+            nthreads = 0;
+            for (const char *p = arg + 10; *p != '\0' && nthreads < MAX_SWEEP; ) {
+                char *end;
+                threads[nthreads++] = (unsigned)strtoul(p, &end, 10);
+                p = (*end == ',') ? end + 1 : end;
+                if (end == p && *end != '\0') { usage(argv[0]); return 1; }
+            }
+        }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || k == 0 || k > n) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *x   = malloc(sizeof(bignum_t) * n);
+    bignum_t *s   = malloc(sizeof(bignum_t) * k);
+    uint32_t *ref = malloc(sizeof(uint32_t) * n);
+    uint32_t *out = malloc(sizeof(uint32_t) * n);
+    if (!x || !s || !ref || !out) {
+        perror("Failed to allocate memory for test data");
+        free(x); free(s); free(ref); free(out);
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n; ++i) {
+        bench_random_bignum(&x[i], bench_skewed_len(&rng), &rng);
+    }
+    for (uint64_t j = 0; j < k; ++j) {
+        s[j] = x[bench_rng_next(&rng) % n];
+    }
+    qsort(s, k, sizeof(bignum_t), cmp_qsort);
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(x); free(s); free(ref); free(out);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+
+    bench_region_begin(&hw, &reg);
+    for (size_t i = 0; i < n; ++i) {
+        size_t lo = 0, hi = k;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (bignum_cmp(&s[mid], &x[i]) <= 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        ref[i] = (uint32_t)lo;
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "bsearch/k=%llu", (unsigned long long)k);
+    bench_report_row(fp, fmt, 1, label, &reg, n);
+
+    bench_region_begin(&hw, &reg);
+    bignum_bucketize(s, k, x, n, out);
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "bucketize/k=%llu", (unsigned long long)k);
+    bench_report_row(fp, fmt, 0, label, &reg, n);
+    if (memcmp(out, ref, sizeof(uint32_t) * n) != 0) {
+        fprintf(stderr, "bucketize: result mismatch against bsearch\n");
+    }
+
+    for (size_t t = 0; t < nthreads; ++t) {
+        memset(out, 0, sizeof(uint32_t) * n);
+        bench_region_begin(&hw, &reg);
+        bignum_bucketize_mt(s, k, x, n, threads[t], out);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "bucketize_mt/t%u/k=%llu", threads[t], (unsigned long long)k);
+        bench_report_row(fp, fmt, 0, label, &reg, n);
+        if (memcmp(out, ref, sizeof(uint32_t) * n) != 0) {
+            fprintf(stderr, "bucketize_mt/t%u: result mismatch against bsearch\n", threads[t]);
+        }
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    free(x);
+    free(s);
+    free(ref);
+    free(out);
+    return 0;
+}
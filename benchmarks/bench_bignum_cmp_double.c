@@ -0,0 +1,217 @@
+/**
+ * @file    bench_bignum_cmp_double.c
+ * @brief   Бенчмарк сравнения с порогами `double`: строка + `strtod` против
+ *          `bignum_cmp_double` и пакета.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   `--n` пар (число, порог) для каждого распределения:
+ *   - `far`  — длины `skewed` (bench_inputs.h), порог — усечённое до `double`
+ *              значение другого случайного числа (решает битовая длина);
+ *   - `near` — порог — усечённое значение самого числа ± 1 ulp (равные
+ *              битовые длины, сравнение 53 старших бит и хвоста).
+ *
+ *   Строки (операция = одна пара):
+ *   - `strtod/D` — десятичная строка числа, `strtod`, сравнение `double`
+ *                  (базовая линия, к тому же неточная);
+ *   - `direct/D` — `bignum_cmp_double` на каждую пару;
+ *   - `batch/D`  — один вызов `bignum_cmp_double_batch`.
+ *
+ *   Число пар, где базовая линия ошиблась из-за округления, печатается в
+ *   stderr.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_double [--n=100000] [--seed=S] [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_double REPORT_NAME=baseline
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_double.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+__extension__ typedef unsigned __int128 u128;
+
+#define STR_MAX  (BIGNUM_CAPACITY * 20 + 2)
+#define POW10_19 10000000000000000000ull
+
+typedef enum { DIST_FAR = 0, DIST_NEAR, DIST_COUNT } dbl_dist_t;
+
+static const char *const dist_names[DIST_COUNT] = { "far", "near" };
+
+static size_t to_dec(const bignum_t *x, char *out)
+{
+    uint64_t chunks[BIGNUM_CAPACITY * 2];
+    size_t   nc = 0;
+    bignum_t q  = *x;
+    while (q.len > 0) {
+        uint64_t r = 0;
+        for (size_t i = q.len; i > 0; --i) {
+            u128 cur = (u128)r << 64 | q.words[i - 1];
+            q.words[i - 1] = (uint64_t)(cur / POW10_19);
+            r              = (uint64_t)(cur % POW10_19);
+        }
+        while (q.len > 0 && q.words[q.len - 1] == 0) {
+            q.len--;
+        }
+        chunks[nc++] = r;
+    }
+    if (nc == 0) {
+        out[0] = '0';
+        out[1] = '\0';
+        return 1;
+    }
+    size_t n = (size_t)sprintf(out, "%llu", (unsigned long long)chunks[nc - 1]);
+    for (size_t i = nc - 1; i > 0; --i) {
+        n += (size_t)sprintf(out + n, "%019llu", (unsigned long long)chunks[i - 1]);
+    }
+    return n;
+}
+
+/** Усечение `x` до 53 старших бит (`DBL_MAX` при переполнении). */
+static double trunc_double(const bignum_t *x)
+{
+    if (x->len == 0) {
+        return 0.0;
+    }
+    size_t   B    = 64 * x->len - (size_t)__builtin_clzll(x->words[x->len - 1]);
+    uint64_t hi   = x->words[x->len - 1], lo = x->len > 1 ? x->words[x->len - 2] : 0;
+    unsigned lz   = (unsigned)__builtin_clzll(hi);
+    uint64_t norm = lz ? hi << lz | lo >> (64 - lz) : hi;
+    uint64_t bits = B > 1024 ? 0x7FEFFFFFFFFFFFFFull
+                             : (uint64_t)(B - 1 + 1023) << 52 | ((norm >> 11) & ((1ull << 52) - 1));
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+static void fill(bignum_t *a, double *d, size_t n, dbl_dist_t dist, uint64_t *rng)
+{
+    for (size_t i = 0; i < n; ++i) {
+        bench_random_bignum(&a[i], bench_skewed_len(rng), rng);
+        if (dist == DIST_FAR) {
+            bignum_t other;
+            bench_random_bignum(&other, bench_skewed_len(rng), rng);
+            d[i] = trunc_double(&other);
+        } else {
+            uint64_t bits;
+            double   t = trunc_double(&a[i]);
+            memcpy(&bits, &t, sizeof(bits));
+            bits += (uint64_t)(bench_rng_next(rng) % 3) - 1;
+            memcpy(&d[i], &bits, sizeof(bits));
+        }
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [--n=100000] [--seed=S] [--format=text|csv|json] [--out=FILE]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    size_t n = 100000;
+    uint64_t seed = 0;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)      { n = (size_t)strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)   { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0) { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)    { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *a      = malloc(sizeof(bignum_t) * n);
+    double   *d      = malloc(sizeof(double) * n);
+    int8_t   *out    = malloc(n);
+    int8_t   *approx = malloc(n);
+    if (a == NULL || d == NULL || out == NULL || approx == NULL) {
+        perror("Failed to allocate memory for test data");
+        free(a); free(d); free(out); free(approx);
+        return 1;
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(a); free(d); free(out); free(approx);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    char str[STR_MAX];
+    bench_region_t reg;
+    int first = 1, bad = 0;
+    for (int k = 0; k < DIST_COUNT; ++k) {
+        uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+        fill(a, d, n, (dbl_dist_t)k, &rng);
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < n; ++i) {
+            to_dec(&a[i], str);
+            double x = strtod(str, NULL);
+            approx[i] = (int8_t)((x > d[i]) - (x < d[i]));
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "strtod/%s", dist_names[k]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+        first = 0;
+
+        long sink = 0;
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < n; ++i) {
+            sink += bignum_cmp_double(&a[i], d[i]);
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "direct/%s", dist_names[k]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+
+        bench_region_begin(&hw, &reg);
+        bignum_cmp_double_batch(a, d, n, out);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "batch/%s", dist_names[k]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+
+        size_t wrong = 0;
+        for (size_t i = 0; i < n; ++i) {
+            sink  -= out[i];
+            wrong += approx[i] != out[i];
+        }
+        bad |= sink != 0;
+        fprintf(stderr, "%s: strtod baseline wrong on %zu of %zu pairs\n", dist_names[k], wrong, n);
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    if (bad) {
+        fprintf(stderr, "result mismatch: direct and batch compares differ\n");
+    }
+    free(a); free(d); free(out); free(approx);
+    return bad;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file    bench_bignum_cmp_filter.c
+ * @brief   Бенчмарк отсева промахов: бинарный поиск с фильтром и без.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Эталонное множество — отсортированный массив из N ключей (длины — смесь
+ *   `skewed`, см. bench_inputs.h); запросы — смесь попаданий и промахов
+ *   (`--miss`, по умолчанию 90%). Строки:
+ *   - `bsearch`            — каждый запрос идёт в бинарный поиск с `bignum_cmp`;
+ *   - `bloom+bsearch`      — поиск только при положительном ответе фильтра Блума;
+ *   - `fuse+bsearch`       — то же с binary fuse фильтром;
+ *   - `bloom_batch+bsearch`, `fuse_batch+bsearch` — фильтр опрашивается
+ *     пакетами (`*_contains_batch` с prefetch), затем выполняются поиски;
+ *   - `bloom_only`, `fuse_only` — только пакетный запрос к фильтру.
+ *
+ *   Размеры фильтров и измеренная доля ложных срабатываний печатаются в stderr.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_filter [--n=N] [--lookups=N] [--miss=PCT] [--bits=B] [--seed=S]
+ *                               [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_filter REPORT_NAME=baseline BENCH_ARGS="--n=10000000 --miss=99"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_filter.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N       1000000ull
+#define DEFAULT_LOOKUPS 2000000ull
+#define DEFAULT_MISS    90
+#define DEFAULT_BITS    10
+#define PROBE_POOL      65536
+#define CHUNK           256
+
+static volatile size_t g_sink;
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+/** 1, если `x` есть в отсортированном массиве. */
+static int bsearch_has(const bignum_t *keys, size_t n, const bignum_t *x)
+{
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int c = bignum_cmp(&keys[mid], x);
+        if (c == 0) {
+            return 1;
+        }
+        if (c < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--lookups=N] [--miss=PCT] [--bits=B] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, lookups = DEFAULT_LOOKUPS, seed = 0;
+    unsigned miss = DEFAULT_MISS, bits = DEFAULT_BITS;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n       = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--lookups=", 10) == 0) { lookups = strtoull(arg + 10, NULL, 10); }
+        else if (strncmp(arg, "--miss=", 7) == 0)    { miss    = (unsigned)strtoul(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--bits=", 7) == 0)    { bits    = (unsigned)strtoul(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed    = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || lookups == 0 || miss > 100 || bits == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    lookups = (lookups + CHUNK - 1) / CHUNK * CHUNK;
+
+    bignum_t *keys   = malloc(sizeof(bignum_t) * n);
+    bignum_t *probes = malloc(sizeof(bignum_t) * PROBE_POOL);
+    bignum_t *stream = malloc(sizeof(bignum_t) * CHUNK);
+    uint8_t  *maybe  = malloc(CHUNK);
+    size_t   *order  = malloc(sizeof(size_t) * lookups);
+    if (!keys || !probes || !stream || !maybe || !order) {
+        perror("Failed to allocate memory for test data");
+        free(keys); free(probes); free(stream); free(maybe); free(order);
+        return 1;
+    }
+
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n; ++i) {
+        bench_random_bignum(&keys[i], bench_skewed_len(&rng), &rng);
+    }
+    qsort(keys, n, sizeof(bignum_t), cmp_qsort);
+    for (size_t i = 0; i < PROBE_POOL; ++i) {
+        if (bench_rng_next(&rng) % 100 < miss) {
+            bench_random_bignum(&probes[i], bench_skewed_len(&rng), &rng);
+        } else {
+            probes[i] = keys[bench_rng_next(&rng) % n];
+        }
+    }
+    for (uint64_t i = 0; i < lookups; ++i) {
+        order[i] = (size_t)(bench_rng_next(&rng) % PROBE_POOL);
+    }
+
+    bignum_bloom_t bloom;
+    bignum_fuse_t  fuse;
+    if (bignum_bloom_init(&bloom, n, bits) != BIGNUM_FILTER_OK) {
+        fprintf(stderr, "bignum_bloom_init failed\n");
+        return 1;
+    }
+    for (uint64_t i = 0; i < n; ++i) {
+        bignum_bloom_add(&bloom, &keys[i]);
+    }
+    if (bignum_fuse_build(&fuse, keys, n) != BIGNUM_FILTER_OK) {
+        fprintf(stderr, "bignum_fuse_build failed\n");
+        bignum_bloom_free(&bloom);
+        return 1;
+    }
+    size_t absent = 0, bloom_fp = 0, fuse_fp = 0;
+    for (size_t i = 0; i < PROBE_POOL; ++i) {
+        if (!bsearch_has(keys, n, &probes[i])) {
+            absent++;
+            bloom_fp += (size_t)bignum_bloom_contains(&bloom, &probes[i]);
+            fuse_fp  += (size_t)bignum_fuse_contains(&fuse, &probes[i]);
+        }
+    }
+    fprintf(stderr, "filter: n=%llu bloom %.1f MB (fp %.3f%%), fuse %.1f MB (fp %.3f%%)\n",
+            (unsigned long long)n,
+            (double)bignum_bloom_serialized_size(&bloom) / 1e6,
+            absent ? 100.0 * (double)bloom_fp / (double)absent : 0.0,
+            (double)bignum_fuse_serialized_size(&fuse) / 1e6,
+            absent ? 100.0 * (double)fuse_fp / (double)absent : 0.0);
+
+    FILE *out = stdout;
+    if (path != NULL && (out = fopen(path, "w")) == NULL) {
+        perror(path);
+        bignum_bloom_free(&bloom);
+        bignum_fuse_free(&fuse);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(out, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    size_t acc = 0, check;
+
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; i < lookups; ++i) {
+        acc += (size_t)bsearch_has(keys, n, &probes[order[i]]);
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "bsearch/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 1, label, &reg, lookups);
+
+    check = 0;
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; i < lookups; ++i) {
+        const bignum_t *x = &probes[order[i]];
+        check += (size_t)(bignum_bloom_contains(&bloom, x) && bsearch_has(keys, n, x));
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "bloom+bsearch/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, lookups);
+    if (check != acc) { fprintf(stderr, "bloom: result mismatch\n"); }
+
+    check = 0;
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; i < lookups; ++i) {
+        const bignum_t *x = &probes[order[i]];
+        check += (size_t)(bignum_fuse_contains(&fuse, x) && bsearch_has(keys, n, x));
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "fuse+bsearch/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, lookups);
+    if (check != acc) { fprintf(stderr, "fuse: result mismatch\n"); }
+
+    /* Пакетные варианты: запросы копируются в поток по CHUNK штук, как из входного буфера. */
+    for (int kind = 0; kind < 2; ++kind) {
+        for (int only = 0; only < 2; ++only) {
+            check = 0;
+            bench_region_begin(&hw, &reg);
+            for (uint64_t i = 0; i < lookups; i += CHUNK) {
+                for (size_t k = 0; k < CHUNK; ++k) {
+                    stream[k] = probes[order[i + k]];
+                }
+                if (kind == 0) {
+                    bignum_bloom_contains_batch(&bloom, stream, CHUNK, maybe);
+                } else {
+                    bignum_fuse_contains_batch(&fuse, stream, CHUNK, maybe);
+                }
+                for (size_t k = 0; k < CHUNK; ++k) {
+                    check += only ? maybe[k] : (size_t)(maybe[k] && bsearch_has(keys, n, &stream[k]));
+                }
+            }
+            bench_region_end(&hw, &reg);
+            snprintf(label, sizeof(label), "%s%s/n=%llu", kind ? "fuse" : "bloom",
+                     only ? "_only" : "_batch+bsearch", (unsigned long long)n);
+            bench_report_row(out, fmt, 0, label, &reg, lookups);
+            if (!only && check != acc) {
+                fprintf(stderr, "%s batch: result mismatch\n", kind ? "fuse" : "bloom");
+            }
+            g_sink += check;
+        }
+    }
+
+    bench_report_end(out, fmt);
+    g_sink += acc;
+
+    bench_hw_close(&hw);
+    if (out != stdout) {
+        fclose(out);
+    }
+    bignum_bloom_free(&bloom);
+    bignum_fuse_free(&fuse);
+    free(keys);
+    free(probes);
+    free(stream);
+    free(maybe);
+    free(order);
+    return 0;
+}
@@ -0,0 +1,274 @@
+/**
+ * @file    bench_bignum_cmp_hmap.c
+ * @brief   Бенчмарк хеш-таблицы: узловая таблица с цепочками против bignum_hmap.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Базовая линия повторяет типичную связку «`std::unordered_map` + хеш всего
+ *   `words` + `bignum_cmp` как равенство»: цепочки из отдельно выделенных
+ *   узлов, хеш по всем `BIGNUM_CAPACITY` словам, сравнение каждого узла цепочки
+ *   через `bignum_cmp`. Ей противопоставляется `bignum_hmap_*`.
+ *
+ *   Строки (для каждой из двух таблиц):
+ *   - `insert`      — вставка N ключей в пустую таблицу (с ростом);
+ *   - `lookup_hit`  — поиск существующих ключей;
+ *   - `lookup_miss` — поиск отсутствующих ключей.
+ *
+ *   Длины ключей — смесь `skewed` (см. bench_inputs.h). Печатаются ns, циклы и
+ *   промахи L1D/LLC на операцию (если счётчики доступны).
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_hmap [--n=N] [--lookups=N] [--seed=S]
+ *                             [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_hmap REPORT_NAME=baseline BENCH_ARGS="--n=1000000"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_hmap.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N       1000000ull
+#define DEFAULT_LOOKUPS 2000000ull
+
+static volatile size_t g_sink;
+
+/* ---- Базовая линия: цепочки узлов, хеш по всему массиву words ---- */
+
+typedef struct chain_node {
+    struct chain_node *next;
+    uint64_t           hash;
+    uint64_t           value;
+    bignum_t           key;
+} chain_node_t;
+
+typedef struct {
+    chain_node_t **buckets;
+    size_t         nbuckets;
+    size_t         size;
+} chain_map_t;
+
+static uint64_t chain_hash(const bignum_t *x)
+{
+    uint64_t h = 0xCBF29CE484222325ull ^ x->len;
+    for (size_t i = 0; i < BIGNUM_CAPACITY; ++i) {
+        h = (h ^ x->words[i]) * 0x100000001B3ull;
+    }
+    return bignum_hash_fmix64(h);
+}
+
+static int chain_init(chain_map_t *m)
+{
+    m->nbuckets = 16;
+    m->size     = 0;
+    m->buckets  = calloc(m->nbuckets, sizeof(chain_node_t *));
+    return m->buckets != NULL;
+}
+
+static void chain_free(chain_map_t *m)
+{
+    for (size_t b = 0; b < m->nbuckets; ++b) {
+        chain_node_t *p = m->buckets[b];
+        while (p != NULL) {
+            chain_node_t *next = p->next;
+            free(p);
+            p = next;
+        }
+    }
+    free(m->buckets);
+}
+
+static chain_node_t *chain_find(const chain_map_t *m, const bignum_t *key)
+{
+    uint64_t h = chain_hash(key);
+    for (chain_node_t *p = m->buckets[h & (m->nbuckets - 1)]; p != NULL; p = p->next) {
+        if (bignum_cmp(&p->key, key) == 0) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+static int chain_insert(chain_map_t *m, const bignum_t *key, uint64_t value)
+{
+    if (chain_find(m, key) != NULL) {
+        return 1;
+    }
+    if (m->size + 1 > m->nbuckets) {
+        /* Коэффициент загрузки 1.0, как у std::unordered_map по умолчанию. */
+        size_t nb = m->nbuckets * 2;
+        chain_node_t **buckets = calloc(nb, sizeof(chain_node_t *));
+        if (buckets == NULL) {
+            return 0;
+        }
+        for (size_t b = 0; b < m->nbuckets; ++b) {
+            chain_node_t *p = m->buckets[b];
+            while (p != NULL) {
+                chain_node_t *next = p->next;
+                p->next = buckets[p->hash & (nb - 1)];
+                buckets[p->hash & (nb - 1)] = p;
+                p = next;
+            }
+        }
+        free(m->buckets);
+        m->buckets  = buckets;
+        m->nbuckets = nb;
+    }
+    chain_node_t *node = malloc(sizeof(*node));
+    if (node == NULL) {
+        return 0;
+    }
+    node->hash  = chain_hash(key);
+    node->value = value;
+    node->key   = *key;
+    node->next  = m->buckets[node->hash & (m->nbuckets - 1)];
+    m->buckets[node->hash & (m->nbuckets - 1)] = node;
+    m->size++;
+    return 1;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--lookups=N] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, lookups = DEFAULT_LOOKUPS, seed = 0;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n       = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--lookups=", 10) == 0) { lookups = strtoull(arg + 10, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed    = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || lookups == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    /* keys[0 … n-1] вставляются, keys[n … 2n-1] — промахи. */
+    bignum_t *keys  = malloc(sizeof(bignum_t) * n * 2);
+    size_t   *order = malloc(sizeof(size_t) * lookups);
+    if (!keys || !order) {
+        perror("Failed to allocate memory for test data");
+        free(keys); free(order);
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n * 2; ++i) {
+        bench_random_bignum(&keys[i], bench_skewed_len(&rng), &rng);
+    }
+    for (uint64_t i = 0; i < lookups; ++i) {
+        order[i] = (size_t)(bench_rng_next(&rng) % n);
+    }
+
+    FILE *out = stdout;
+    if (path != NULL && (out = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(keys); free(order);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(out, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    size_t acc = 0;
+    int ok = 1;
+
+    chain_map_t cm;
+    ok = chain_init(&cm);
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; ok && i < n; ++i) {
+        ok = chain_insert(&cm, &keys[i], i);
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "chain_insert/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 1, label, &reg, n);
+
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; ok && i < lookups; ++i) {
+        const chain_node_t *p = chain_find(&cm, &keys[order[i]]);
+        acc += (p != NULL) ? p->value : 0;
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "chain_lookup_hit/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, lookups);
+
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; ok && i < lookups; ++i) {
+        acc += (chain_find(&cm, &keys[n + order[i]]) != NULL);
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "chain_lookup_miss/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, lookups);
+    chain_free(&cm);
+
+    bignum_hmap_t hm;
+    ok = ok && bignum_hmap_init(&hm, 0, 1) == BIGNUM_HMAP_OK;
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; ok && i < n; ++i) {
+        ok = bignum_hmap_insert(&hm, &keys[i], i, NULL) >= 0;
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "hmap_insert/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, n);
+
+    size_t check = 0;
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; ok && i < lookups; ++i) {
+        size_t idx;
+        check += (bignum_hmap_find(&hm, &keys[order[i]], &idx) == 1) ? hm.values[idx] : 0;
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "hmap_lookup_hit/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, lookups);
+
+    bench_region_begin(&hw, &reg);
+    for (uint64_t i = 0; ok && i < lookups; ++i) {
+        check += (size_t)bignum_hmap_find(&hm, &keys[n + order[i]], NULL);
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "hmap_lookup_miss/n=%llu", (unsigned long long)n);
+    bench_report_row(out, fmt, 0, label, &reg, lookups);
+
+    bench_report_end(out, fmt);
+    if (!ok) {
+        fprintf(stderr, "hmap: out of memory\n");
+    } else if (check != acc) {
+        fprintf(stderr, "hmap: result mismatch against chained table\n");
+    }
+    g_sink = acc + check;
+
+    bench_hw_close(&hw);
+    if (out != stdout) {
+        fclose(out);
+    }
+    bignum_hmap_free(&hm);
+    free(keys);
+    free(order);
+    return ok ? 0 : 1;
+}
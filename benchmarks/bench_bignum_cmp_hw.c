@@ -0,0 +1,143 @@
+/**
+ * @file    bench_bignum_cmp_hw.c
+ * @brief   Бенчмарк bignum_cmp с внутрипроцессными аппаратными счётчиками.
+ * @author  git@bayborodov.com
+ * @version 1.1.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   В отличие от bench_bignum_cmp.c, который рассчитан на `perf record`,
+ *   этот бенчмарк сам читает счётчики `perf_event_open` вокруг горячего
+ *   цикла и время по `rdtscp`, и выдаёт числа на вызов: ns, тики TSC,
+ *   циклы, инструкции, промахи ветвлений, промахи L1D/LLC.
+ *   Root не нужен (см. bench_harness.h).
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *   - rev 1.1 (16.10.2026): Распределение `skewed`.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_hw [--dist=random|same_len|equal|skewed] [--len=N] [--depth=D]
+ *                           [--pool=N] [--iters=N] [--reps=N] [--seed=S]
+ *                           [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_hw BENCH_ARGS="--dist=same_len --len=32 --depth=16"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_POOL  8192
+#define DEFAULT_ITERS 20000000ull
+#define DEFAULT_REPS  5
+
+static volatile int g_sink;
+
+/** Горячий цикл: `iters` вызовов по кругу пула. */
+static void run_loop(const bignum_t *a, const bignum_t *b, size_t pool, uint64_t iters)
+{
+    int acc = 0;
+    size_t idx = 0;
+    for (uint64_t i = 0; i < iters; ++i) {
+        acc += bignum_cmp(&a[idx], &b[idx]);
+        if (++idx == pool) {
+            idx = 0;
+        }
+    }
+    g_sink = acc;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--dist=random|same_len|equal|skewed] [--len=N] [--depth=D] [--pool=N]\n"
+            "          [--iters=N] [--reps=N] [--seed=S] [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    bench_input_cfg_t cfg = { BENCH_DIST_RANDOM, BIGNUM_CAPACITY, 0, 0 };
+    size_t      pool   = DEFAULT_POOL;
+    uint64_t    iters  = DEFAULT_ITERS;
+    unsigned    reps   = DEFAULT_REPS;
+    bench_fmt_t fmt    = BENCH_FMT_TEXT;
+    const char *path   = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--dist=", 7) == 0)   { if (!bench_parse_dist(arg + 7, &cfg.dist)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--len=", 6) == 0)    { cfg.len   = strtoull(arg + 6, NULL, 10); }
+        else if (strncmp(arg, "--depth=", 8) == 0)  { cfg.depth = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)   { cfg.seed  = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--pool=", 7) == 0)   { pool  = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--iters=", 8) == 0)  { iters = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--reps=", 7) == 0)   { reps  = (unsigned)strtoul(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0) { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)    { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (pool == 0 || iters == 0 || reps == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // --- Фаза 1: Предварительная генерация данных ---
+    bignum_t *a = malloc(sizeof(bignum_t) * pool);
+    bignum_t *b = malloc(sizeof(bignum_t) * pool);
+    if (!a || !b) {
+        perror("Failed to allocate memory for test data");
+        free(a);
+        free(b);
+        return 1;
+    }
+    bench_fill_pairs(a, b, pool, &cfg);
+
+    FILE *out = stdout;
+    if (path != NULL && (out = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(a);
+        free(b);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+
+    // --- Фаза 2: Прогрев и измеряемые повторы ---
+    run_loop(a, b, pool, pool * 4);
+
+    char label[96];
+    bench_report_begin(out, fmt);
+    for (unsigned r = 0; r < reps; ++r) {
+        bench_region_t reg;
+        bench_region_begin(&hw, &reg);
+        run_loop(a, b, pool, iters);
+        bench_region_end(&hw, &reg);
+
+        if (cfg.dist == BENCH_DIST_RANDOM || cfg.dist == BENCH_DIST_SKEWED) {
+            snprintf(label, sizeof(label), "%s/rep=%u", bench_dist_name(cfg.dist), r);
+        } else {
+            snprintf(label, sizeof(label), "%s/len=%zu/depth=%zu/rep=%u",
+                     bench_dist_name(cfg.dist), cfg.len, cfg.depth, r);
+        }
+        bench_report_row(out, fmt, r == 0, label, &reg, iters);
+    }
+    bench_report_end(out, fmt);
+
+    // --- Фаза 3: Очистка ---
+    bench_hw_close(&hw);
+    if (out != stdout) {
+        fclose(out);
+    }
+    free(a);
+    free(b);
+    return 0;
+}
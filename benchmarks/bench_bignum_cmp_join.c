@@ -0,0 +1,197 @@
+/**
+ * @file    bench_bignum_cmp_join.c
+ * @brief   Бенчмарк merge-join и операций над множествами: цикл слияния с
+ *          bignum_cmp на каждом шаге против модуля join.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Два отсортированных массива: `a` из N ключей и `b` из `N / ratio` ключей
+ *   (длины — смесь `skewed`, см. bench_inputs.h); `--match` процентов ключей
+ *   `b` взяты из `a`. Каждая конфигурация запускается для `ratio = 1`
+ *   (сбалансированные входы) и для `--ratio` (перекошенные, galloping).
+ *   Строки (вызов = один элемент обоих входов, `N + N / ratio`):
+ *   - `naive_intersect` — классический цикл слияния, `bignum_cmp` на шаге (базовая линия);
+ *   - `intersection`    — `bignum_set_intersection`;
+ *   - `union`           — `bignum_set_union`;
+ *   - `merge_join`      — `bignum_merge_join`;
+ *   - `merge_join_mt/tN` — `bignum_merge_join_mt` на N потоках (`--threads`).
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_join [--n=N] [--ratio=R] [--match=PCT] [--threads=1,2,4,8]
+ *                             [--seed=S] [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_join REPORT_NAME=baseline BENCH_ARGS="--n=4000000 --ratio=1000"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_join.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N     1000000ull
+#define DEFAULT_RATIO 1000ull
+#define DEFAULT_MATCH 50
+#define MAX_SWEEP     16
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--ratio=R] [--match=PCT] [--threads=1,2,4,8] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, ratio = DEFAULT_RATIO, seed = 0;
+    unsigned match = DEFAULT_MATCH;
+    unsigned threads[MAX_SWEEP] = { 1, 2, 4, 8 };
+    size_t nthreads = 4;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n     = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--ratio=", 8) == 0)   { ratio = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--match=", 8) == 0)   { match = (unsigned)strtoul(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--threads=", 10) == 0) {
+            nthreads = 0;
+            for (const char *p = arg + 10; *p != '\0' && nthreads < MAX_SWEEP; ) {
+                char *end;
+                threads[nthreads++] = (unsigned)strtoul(p, &end, 10);
+                p = (*end == ',') ? end + 1 : end;
+                if (end == p && *end != '\0') { usage(argv[0]); return 1; }
+            }
+        }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || ratio == 0 || ratio > n || match > 100) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *a = malloc(sizeof(bignum_t) * n);
+    bignum_t *b = malloc(sizeof(bignum_t) * n);
+    const bignum_t **refs = malloc(sizeof(*refs) * 2 * n);
+    bignum_join_pair_t *pairs = malloc(sizeof(*pairs) * n);
+    if (!a || !b || !refs || !pairs) {
+        perror("Failed to allocate memory for test data");
+        free(a); free(b); free((void *)refs); free(pairs);
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n; ++i) {
+        bench_random_bignum(&a[i], bench_skewed_len(&rng), &rng);
+    }
+    qsort(a, n, sizeof(bignum_t), cmp_qsort);
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(a); free(b); free((void *)refs); free(pairs);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    const uint64_t ratios[2] = { 1, ratio };
+    for (size_t r = 0; r < (ratio > 1 ? 2u : 1u); ++r) {
+        size_t nb = (size_t)(n / ratios[r]);
+        for (size_t j = 0; j < nb; ++j) {
+            if (bench_rng_next(&rng) % 100 < match) {
+                b[j] = a[bench_rng_next(&rng) % n];
+            } else {
+                bench_random_bignum(&b[j], bench_skewed_len(&rng), &rng);
+            }
+        }
+        qsort(b, nb, sizeof(bignum_t), cmp_qsort);
+
+        char label[64];
+        bench_region_t reg;
+        size_t calls = n + nb, ref = 0, count = 0;
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0, j = 0; i < n && j < nb; ) {
+            int c = bignum_cmp(&a[i], &b[j]);
+            if (c < 0) {
+                ++i;
+            } else if (c > 0) {
+                ++j;
+            } else {
+                refs[ref++] = &a[i];
+                ++i;
+                ++j;
+            }
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "naive_intersect/ratio=%llu", (unsigned long long)ratios[r]);
+        bench_report_row(fp, fmt, r == 0, label, &reg, calls);
+
+        bench_region_begin(&hw, &reg);
+        bignum_set_intersection(a, n, b, nb, refs, 2 * n, &count);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "intersection/ratio=%llu", (unsigned long long)ratios[r]);
+        bench_report_row(fp, fmt, 0, label, &reg, calls);
+        if (count != ref) {
+            fprintf(stderr, "intersection: result mismatch against naive loop\n");
+        }
+
+        bench_region_begin(&hw, &reg);
+        bignum_set_union(a, n, b, nb, refs, 2 * n, &count);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "union/ratio=%llu", (unsigned long long)ratios[r]);
+        bench_report_row(fp, fmt, 0, label, &reg, calls);
+
+        bench_region_begin(&hw, &reg);
+        bignum_merge_join(a, n, b, nb, pairs, n, &count);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "merge_join/ratio=%llu", (unsigned long long)ratios[r]);
+        bench_report_row(fp, fmt, 0, label, &reg, calls);
+
+        for (size_t t = 0; t < nthreads; ++t) {
+            size_t mt_count = 0;
+            bench_region_begin(&hw, &reg);
+            bignum_merge_join_mt(a, n, b, nb, threads[t], pairs, n, &mt_count);
+            bench_region_end(&hw, &reg);
+            snprintf(label, sizeof(label), "merge_join_mt/t%u/ratio=%llu", threads[t],
+                     (unsigned long long)ratios[r]);
+            bench_report_row(fp, fmt, 0, label, &reg, calls);
+            if (mt_count != count) {
+                fprintf(stderr, "merge_join_mt/t%u: result mismatch against merge_join\n", threads[t]);
+            }
+        }
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    free(a);
+    free(b);
+    free((void *)refs);
+    free(pairs);
+    return 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file    bench_bignum_cmp_matrix.c
+ * @brief   Матрица бенчмарков bignum_cmp по входным распределениям.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   bench_bignum_cmp.c берёт `len` равномерно из 1..BIGNUM_CAPACITY, поэтому почти каждый
+ *   вызов выходит на `.diff_len`, а цикл по словам почти не измеряется.
+ *   Эта матрица прогоняет ядро по ячейкам, в которых решают разные пути:
+ *   Длины L — степени двойки 1, 2, 4, … до BIGNUM_CAPACITY и сама
+ *   BIGNUM_CAPACITY (make CAPACITY=N меняет набор ячеек):
+ *   - `equal/len=L`            — полный проход цикла по L словам;
+ *   - `same_len/len=L/depth=D` — выход на `.diff_words` на D-м слове от старшего;
+ *   - `random`                 — прежнее распределение (`.diff_len`);
+ *   - `skewed`                 — реалистичная смесь длин (см. bench_inputs.h).
+ *
+ *   Для каждой ячейки печатаются ns/call и tsc/call, а также циклы и прочие
+ *   счётчики на вызов, если они доступны (см. bench_harness.h). Это позволяет
+ *   оценивать изменения ядра (развёртку, SIMD, prefetch) именно там, где они
+ *   должны сработать.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_matrix [--dist=NAME] [--pool=N] [--iters=N] [--seed=S]
+ *                               [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_matrix REPORT_NAME=baseline
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+// Пул 1024 пар (~0.5 МБ) помещается в L2, чтобы ячейки мерили ядро, а не DRAM.
+#define DEFAULT_POOL  1024
+#define DEFAULT_ITERS 5000000ull
+
+static volatile int g_sink;
+
+static void run_loop(const bignum_t *a, const bignum_t *b, size_t pool, uint64_t iters)
+{
+    int acc = 0;
+    size_t idx = 0;
+    for (uint64_t i = 0; i < iters; ++i) {
+        acc += bignum_cmp(&a[idx], &b[idx]);
+        if (++idx == pool) {
+            idx = 0;
+        }
+    }
+    g_sink = acc;
+}
+
+/** Общее состояние прогона матрицы. */
+typedef struct {
+    bench_hw_t  hw;
+    bignum_t   *a;
+    bignum_t   *b;
+    size_t      pool;
+    uint64_t    iters;
+    uint64_t    seed;
+    bench_fmt_t fmt;
+    FILE       *out;
+    int         rows;
+} matrix_t;
+
+static void run_cell(matrix_t *m, bench_dist_t dist, size_t len, size_t depth)
+{
+    bench_input_cfg_t cfg = { dist, len, depth, m->seed };
+    char label[96];
+
+    bench_fill_pairs(m->a, m->b, m->pool, &cfg);
+    run_loop(m->a, m->b, m->pool, m->pool * 4);   /* прогрев кэша и предсказателя */
+
+    bench_region_t reg;
+    bench_region_begin(&m->hw, &reg);
+    run_loop(m->a, m->b, m->pool, m->iters);
+    bench_region_end(&m->hw, &reg);
+
+    switch (dist) {
+    case BENCH_DIST_SAME_LEN:
+        snprintf(label, sizeof(label), "same_len/len=%zu/depth=%zu", len, depth);
+        break;
+    case BENCH_DIST_EQUAL:
+        snprintf(label, sizeof(label), "equal/len=%zu", len);
+        break;
+    default:
+        snprintf(label, sizeof(label), "%s", bench_dist_name(dist));
+        break;
+    }
+    bench_report_row(m->out, m->fmt, m->rows == 0, label, &reg, m->iters);
+    m->rows++;
+}
+
+/** Длины ячеек: 1, 2, 4, … <= BIGNUM_CAPACITY и сама BIGNUM_CAPACITY. */
+static size_t matrix_lens(size_t *lens)
+{
+    size_t n = 0;
+    for (size_t len = 1; len <= BIGNUM_CAPACITY; len *= 2) {
+        lens[n++] = len;
+    }
+    if (lens[n - 1] != BIGNUM_CAPACITY) {
+        lens[n++] = BIGNUM_CAPACITY;
+    }
+    return n;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--dist=random|same_len|equal|skewed] [--pool=N] [--iters=N] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    size_t lens[sizeof(size_t) * 8 + 1];
+    size_t nlens = matrix_lens(lens);
+    matrix_t m;
+    memset(&m, 0, sizeof(m));
+    m.pool  = DEFAULT_POOL;
+    m.iters = DEFAULT_ITERS;
+    m.fmt   = BENCH_FMT_TEXT;
+    m.out   = stdout;
+
+    int only = -1;   /* -1 — все распределения */
+    const char *path = NULL;
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        bench_dist_t d;
+        if      (strncmp(arg, "--dist=", 7) == 0)   { if (!bench_parse_dist(arg + 7, &d)) { usage(argv[0]); return 1; } only = (int)d; }
+        else if (strncmp(arg, "--pool=", 7) == 0)   { m.pool  = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--iters=", 8) == 0)  { m.iters = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)   { m.seed  = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0) { if (!bench_parse_fmt(arg + 9, &m.fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)    { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (m.pool == 0 || m.iters == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    m.a = malloc(sizeof(bignum_t) * m.pool);
+    m.b = malloc(sizeof(bignum_t) * m.pool);
+    if (!m.a || !m.b) {
+        perror("Failed to allocate memory for test data");
+        free(m.a);
+        free(m.b);
+        return 1;
+    }
+    if (path != NULL && (m.out = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(m.a);
+        free(m.b);
+        return 1;
+    }
+
+    bench_hw_open(&m.hw);
+    bench_report_begin(m.out, m.fmt);
+
+    if (only < 0 || only == BENCH_DIST_EQUAL) {
+        for (size_t i = 0; i < nlens; ++i) {
+            run_cell(&m, BENCH_DIST_EQUAL, lens[i], 0);
+        }
+    }
+    if (only < 0 || only == BENCH_DIST_SAME_LEN) {
+        for (size_t i = 0; i < nlens; ++i) {
+            size_t len = lens[i];
+            /* Глубины 0, 1, len/4, len/2, len-1 без повторов. */
+            size_t depths[] = { 0, 1, len / 4, len / 2, len - 1 };
+            size_t prev = (size_t)-1;
+            for (size_t j = 0; j < sizeof(depths) / sizeof(depths[0]); ++j) {
+                if (depths[j] >= len || (prev != (size_t)-1 && depths[j] <= prev)) {
+                    continue;
+                }
+                run_cell(&m, BENCH_DIST_SAME_LEN, len, depths[j]);
+                prev = depths[j];
+            }
+        }
+    }
+    if (only < 0 || only == BENCH_DIST_RANDOM) {
+        run_cell(&m, BENCH_DIST_RANDOM, 0, 0);
+    }
+    if (only < 0 || only == BENCH_DIST_SKEWED) {
+        run_cell(&m, BENCH_DIST_SKEWED, 0, 0);
+    }
+
+    bench_report_end(m.out, m.fmt);
+    bench_hw_close(&m.hw);
+    if (m.out != stdout) {
+        fclose(m.out);
+    }
+    free(m.a);
+    free(m.b);
+    return 0;
+}
@@ -0,0 +1,323 @@
+/**
+ * @file    bench_bignum_cmp_mq.c
+ * @brief   Бенчмарк MultiQueue: пропускная способность по числу потоков против
+ *          двоичной кучи под одной блокировкой и качество (ошибка ранга).
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Очередь заполняется N ключами (длины — смесь `skewed`, см. bench_inputs.h),
+ *   затем каждый из T потоков выполняет `--ops / T` пар «вставка + извлечение
+ *   наибольшего» (модель аукциона: ставки приходят и забираются). Строки
+ *   (вызов = одна операция, по всем потокам):
+ *   - `locked_heap/tN` — `pthread_mutex` + двоичная куча `bignum_t` с `bignum_cmp`
+ *                        (базовая линия);
+ *   - `mq/tN`          — `bignum_mq_*` с `m = 2 * T` кучами.
+ *
+ *   Качество печатается в stderr: для однопоточного извлечения всех N ключей
+ *   из MultiQueue с `m = 2 * T` — средний и максимальный ранг извлечённого
+ *   ключа среди оставшихся (0 — точная очередь).
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_mq [--n=N] [--ops=OPS] [--threads=1,2,4,8,16] [--seed=S]
+ *                           [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_mq REPORT_NAME=baseline BENCH_ARGS="--threads=1,2,4,8,16"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_mq.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N   100000ull
+#define DEFAULT_OPS 2000000ull
+#define MAX_SWEEP   16
+#define POOL        1024                /* горячий набор новых ставок (в L2) */
+
+/** Базовая линия: max-куча `bignum_t` под `pthread_mutex`. */
+typedef struct {
+    pthread_mutex_t lock;
+    bignum_t       *heap;
+    size_t          size, cap;
+} locked_heap_t;
+
+static void lh_push(locked_heap_t *h, const bignum_t *x)
+{
+    pthread_mutex_lock(&h->lock);
+    if (h->size < h->cap) {
+        size_t i = h->size++;
+        while (i > 0 && bignum_cmp(&h->heap[(i - 1) / 2], x) < 0) {
+            h->heap[i] = h->heap[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        h->heap[i] = *x;
+    }
+    pthread_mutex_unlock(&h->lock);
+}
+
+static int lh_pop(locked_heap_t *h, bignum_t *out)
+{
+    pthread_mutex_lock(&h->lock);
+    if (h->size == 0) {
+        pthread_mutex_unlock(&h->lock);
+        return 0;
+    }
+    *out = h->heap[0];
+    bignum_t last = h->heap[--h->size];
+    size_t i = 0, n = h->size;
+    for (;;) {
+        size_t c = 2 * i + 1;
+        if (c >= n) {
+            break;
+        }
+        if (c + 1 < n && bignum_cmp(&h->heap[c + 1], &h->heap[c]) > 0) {
+            ++c;
+        }
+        if (bignum_cmp(&h->heap[c], &last) <= 0) {
+            break;
+        }
+        h->heap[i] = h->heap[c];
+        i = c;
+    }
+    if (n > 0) {
+        h->heap[i] = last;
+    }
+    pthread_mutex_unlock(&h->lock);
+    return 1;
+}
+
+typedef struct {
+    locked_heap_t  *lh;
+    bignum_mq_t    *mq;
+    const bignum_t *pool;
+    size_t          ops, offset;
+} worker_t;
+
+static volatile size_t g_sink;
+
+static void *worker(void *arg)
+{
+    worker_t *w = arg;
+    bignum_t out;
+    size_t sink = 0;
+    for (size_t i = 0; i < w->ops; ++i) {
+        const bignum_t *x = &w->pool[(w->offset + i) % POOL];
+        if (w->mq != NULL) {
+            bignum_mq_push(w->mq, x);
+            sink += bignum_mq_pop(w->mq, &out) == BIGNUM_MQ_OK;
+        } else {
+            lh_push(w->lh, x);
+            sink += (size_t)lh_pop(w->lh, &out);
+        }
+    }
+    g_sink += sink;
+    return NULL;
+}
+
+/** Запускает `t` потоков и возвращает 0 при успехе. */
+static int run_threads(unsigned t, worker_t *tmpl, size_t ops)
+{
+    pthread_t tids[256];
+    worker_t  args[256];
+    for (unsigned i = 0; i < t; ++i) {
+        args[i] = *tmpl;
+        args[i].ops = ops / t;
+        args[i].offset = (size_t)i * 7919;
+        if (pthread_create(&tids[i], NULL, worker, &args[i]) != 0) {
+            return -1;
+        }
+    }
+    for (unsigned i = 0; i < t; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    return 0;
+}
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+/** Ошибка ранга однопоточного извлечения `n` ключей из MultiQueue с `m` кучами. */
+static void rank_error(const bignum_t *keys, size_t n, size_t m, double *mean, size_t *max)
+{
+    bignum_t *sorted = malloc(sizeof(bignum_t) * n);
+    unsigned char *gone = calloc(n, 1);
+    bignum_mq_t q;
+    *mean = 0;
+    *max  = 0;
+    if (sorted == NULL || gone == NULL || bignum_mq_init(&q, m, n, BIGNUM_MQ_MAX) != BIGNUM_MQ_OK) {
+        free(sorted); free(gone);
+        return;
+    }
+    memcpy(sorted, keys, sizeof(bignum_t) * n);
+    qsort(sorted, n, sizeof(bignum_t), cmp_qsort);
+    for (size_t i = 0; i < n; ++i) {
+        bignum_mq_push(&q, &keys[i]);
+    }
+    size_t top = n, total = 0;                  /* sorted[top-1] — наибольший оставшийся */
+    bignum_t out;
+    while (bignum_mq_pop(&q, &out) == BIGNUM_MQ_OK) {
+        /* Позиция извлечённого: последний ещё не извлечённый равный ключ. */
+        size_t lo = 0, hi = n;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (bignum_cmp(&sorted[mid], &out) <= 0) lo = mid + 1; else hi = mid;
+        }
+        size_t pos = lo - 1, rank = 0;
+        while (gone[pos]) {
+            --pos;
+        }
+        for (size_t r = pos + 1; r < top; ++r) {
+            rank += !gone[r];
+        }
+        gone[pos] = 1;
+        while (top > 0 && gone[top - 1]) {
+            --top;
+        }
+        total += rank;
+        *max = rank > *max ? rank : *max;
+    }
+    *mean = (double)total / (double)n;
+    bignum_mq_free(&q);
+    free(sorted);
+    free(gone);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--ops=OPS] [--threads=1,2,4,8,16] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, ops = DEFAULT_OPS, seed = 0;
+    unsigned threads[MAX_SWEEP] = { 1, 2, 4, 8, 16 };
+    size_t nthreads = 5;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n   = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--ops=", 6) == 0)     { ops = strtoull(arg + 6, NULL, 10); }
+        else if (strncmp(arg, "--threads=", 10) == 0) {
+            nthreads = 0;
+            for (const char *p = arg + 10; *p != '\0' && nthreads < MAX_SWEEP; ) {
+                char *end;
+                threads[nthreads++] = (unsigned)strtoul(p, &end, 10);
+                p = (*end == ',') ? end + 1 : end;
+                if (end == p && *end != '\0') { usage(argv[0]); return 1; }
+            }
+        }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    for (size_t t = 0; t < nthreads; ++t) {
+        if (threads[t] == 0 || threads[t] > 256) { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || ops == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *keys = malloc(sizeof(bignum_t) * n);
+    bignum_t *pool = malloc(sizeof(bignum_t) * POOL);
+    locked_heap_t lh = { .heap = malloc(sizeof(bignum_t) * (n + 512)), .cap = n + 512 };
+    if (!keys || !pool || !lh.heap) {
+        perror("Failed to allocate memory for test data");
+        free(keys); free(pool); free(lh.heap);
+        return 1;
+    }
+    pthread_mutex_init(&lh.lock, NULL);
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n; ++i) {
+        bench_random_bignum(&keys[i], bench_skewed_len(&rng), &rng);
+    }
+    for (size_t i = 0; i < POOL; ++i) {
+        bench_random_bignum(&pool[i], bench_skewed_len(&rng), &rng);
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(keys); free(pool); free(lh.heap);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    for (size_t t = 0; t < nthreads; ++t) {
+        unsigned T = threads[t];
+        size_t   calls = (size_t)(ops / T) * T * 2;
+
+        lh.size = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            lh_push(&lh, &keys[i]);
+        }
+        worker_t tmpl = { &lh, NULL, pool, 0, 0 };
+        bench_region_begin(&hw, &reg);
+        int err = run_threads(T, &tmpl, ops);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "locked_heap/t%u", T);
+        if (err == 0) {
+            bench_report_row(fp, fmt, t == 0, label, &reg, calls);
+        }
+
+        bignum_mq_t mq;
+        if (bignum_mq_init(&mq, 2 * (size_t)T, n + 512, BIGNUM_MQ_MAX) != BIGNUM_MQ_OK) {
+            fprintf(stderr, "mq/t%u: init failed\n", T);
+            continue;
+        }
+        for (uint64_t i = 0; i < n; ++i) {
+            bignum_mq_push(&mq, &keys[i]);
+        }
+        tmpl.mq = &mq;
+        bench_region_begin(&hw, &reg);
+        err = run_threads(T, &tmpl, ops);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "mq/t%u", T);
+        if (err == 0) {
+            bench_report_row(fp, fmt, 0, label, &reg, calls);
+        }
+        bignum_mq_free(&mq);
+
+        double mean;
+        size_t max;
+        rank_error(keys, (size_t)n, 2 * (size_t)T, &mean, &max);
+        fprintf(stderr, "mq/t%u (m=%u): rank error mean %.2f, max %zu over %llu pops\n",
+                T, 2 * T, mean, max, (unsigned long long)n);
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    pthread_mutex_destroy(&lh.lock);
+    free(keys);
+    free(pool);
+    free(lh.heap);
+    return 0;
+}
@@ -2,44 +2,71 @@
  * @file    bench_bignum_cmp_mt.c
  * @brief   Многопоточный микробенчмарк для профилирования bignum_cmp.
  * @author  git@bayborodov.com
- * @version 1.0.0
- * @date    20.10.2025
+ * @version 1.2.0
+ * @date    16.10.2026
  *
  * @details
  *   Для чистоты измерений все случайные данные генерируются заранее
- *   в основном потоке и передаются в рабочие потоки. Каждый поток
- *   выполняет свой набор вызовов bignum_cmp, используя
- *   общий пул предварительно сгенерированных данных.
+ *   в основном потоке и передаются в рабочие потоки.
+ *
+ *   Бенчмарк проходит по числу потоков (1, 2, 4, … до THREAD_COUNT или
+ *   по списку `--threads`) и по режиму пула:
+ *   - `shared`  — все потоки читают один пул (горячие ключи, общие кэш-линии);
+ *   - `private` — каждый поток работает со своей копией пула, размещённой
+ *                 им самим (first touch).
+ *   Разница между режимами при одинаковом числе потоков показывает цену
+ *   межъядерного обмена кэш-линиями; её рост — регрессия (например, запись
+ *   в разделяемые данные на пути чтения).
+ *
+ *   Все потоки проходят пул в одном и том же порядке индексов, поэтому в
+ *   режиме `shared` они конкурируют за одни и те же ключи.
+ *
+ *   Задержка измеряется пачками: `rdtscp` читается один раз на `--batch`
+ *   вызовов, в гистограмму (bench_histogram.h) пишется время пачки, а
+ *   перцентили пересчитываются на одну операцию. Так накладные расходы
+ *   измерения остаются в пределах нескольких тактов на вызов.
+ *   Выводятся пропускная способность и p50/p90/p99/p99.9/max в ns.
  *
  * @history
  *   - rev 1.0 (12.08.2025): Первоначальная версия.
  *   - rev 1.1 (13.08.2025): Реализована предварительная генерация данных
  *                           в main для исключения rand() из потоков.
+ *   - rev 1.2 (16.10.2026): Гистограммы задержек по потокам с пакетным rdtscp,
+ *                           проход по числу потоков, режимы shared/private,
+ *                           вывод p50/p99/p99.9; потоки закреплены за CPU.
  *
  * # Сборка
  * gcc -g -O2 -I include -no-pie -fno-omit-frame-pointer -pthread \
  *   benchmarks/bench_bignum_cmp_mt.c build/bignum_cmp.o \
  *   -o bin/bench_bignum_cmp_mt
  *
+ * # Запуск
+ *   bin/bench_bignum_cmp_mt [--threads=1,2,4,8] [--mode=shared|private|both]
+ *                           [--iters=N] [--batch=B] [--pool=N]
+ *                           [--dist=random|same_len|equal|skewed] [--len=N] [--depth=D]
+ *                           [--format=text|csv]
+ *
  * # Запуск perf
  * /usr/local/bin/perf record -F 9999 -o benchmarks/reports/report_bench_bignum_cmp_mt -g -- \
  *   bin/bench_bignum_cmp_mt
  */
 
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <time.h>
 #include <pthread.h>
+#include <sched.h>
 #include <bignum.h>
 #include "bignum_cmp.h"
-
-// --- Локальные определения для компиляции ---
-#define BIGNUM_CAPACITY 32
-#define BIGNUM_BITS (BIGNUM_CAPACITY * 64)
+#include "bench_harness.h"
+#include "bench_histogram.h"
+#include "bench_inputs.h"
 
 #ifndef ITER_PER_THREAD
-#  define ITER_PER_THREAD (20000000u * 20)
+#  define ITER_PER_THREAD 10000000u
 #endif
 
 #ifndef THREAD_COUNT
@@ -47,100 +74,324 @@
 #endif
 
 #define PREGEN_DATA_COUNT 8192
-#define MAX_SHIFT (BIGNUM_BITS - 1)
+#define DEFAULT_BATCH     16
+#define MAX_SWEEP         16
+
+typedef enum { POOL_SHARED = 0, POOL_PRIVATE = 1 } pool_mode_t;
+
+/**
+ * Стартовый затвор прогона. В отличие от барьера его можно открыть с отказом:
+ * если pthread_create не удался, уже запущенные потоки выходят, не дожидаясь
+ * недостающих участников.
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    unsigned        ready;     // Потоков, дошедших до старта
+    int             state;     // 0 — ждать, 1 — старт, -1 — отмена
+} start_gate_t;
 
 // Структура для передачи данных в поток
 typedef struct {
-    unsigned thread_id;
-    unsigned iters;
-    const bignum_t* a; // Указатель на общий пул исходных чисел a
-    const bignum_t* b; // Указатель на общий пул исходных чисел b
-    unsigned data_count;     // Размер пула
+    bench_hist_t       hist;       // Гистограмма задержек пачек (первой — ради выравнивания)
+    unsigned           thread_id;
+    int                cpu;        // CPU для закрепления, -1 — без закрепления
+    uint64_t           iters;
+    unsigned           batch;
+    pool_mode_t        mode;
+    const bignum_t    *a;          // Указатель на общий пул исходных чисел a
+    const bignum_t    *b;          // Указатель на общий пул исходных чисел b
+    size_t             data_count; // Размер пула
+    start_gate_t      *start;
+    uint64_t           elapsed;    // Тики TSC от старта до конца цикла
+    int                sink;
 } thread_arg_t;
 
-/** Инициализация случайного bignum_t */
-static void init_random_bignum(bignum_t *num) {
-    int used = (rand() % BIGNUM_CAPACITY) + 1;
-    num->len = used;
-    for (int i = 0; i < used; ++i) {
-        num->words[i] = ((uint64_t)rand() << 32) | rand();
+/** Отмечает готовность потока и ждёт открытия затвора; 0 — прогон отменён. */
+static int gate_wait(start_gate_t *g)
+{
+    pthread_mutex_lock(&g->lock);
+    g->ready++;
+    pthread_cond_broadcast(&g->cond);
+    while (g->state == 0) {
+        pthread_cond_wait(&g->cond, &g->lock);
     }
-    for (int i = used; i < BIGNUM_CAPACITY; ++i) {
-        num->words[i] = 0;
+    int go = g->state > 0;
+    pthread_mutex_unlock(&g->lock);
+    return go;
+}
+
+/** Открывает затвор (`state` 1) или отменяет прогон (`state` -1). */
+static void gate_open(start_gate_t *g, unsigned nthreads, int state)
+{
+    pthread_mutex_lock(&g->lock);
+    while (state > 0 && g->ready < nthreads) {
+        pthread_cond_wait(&g->cond, &g->lock);
     }
+    g->state = state;
+    pthread_cond_broadcast(&g->cond);
+    pthread_mutex_unlock(&g->lock);
 }
 
 /** Функция, исполняемая каждым потоком */
 static void* thread_func(void *arg) {
-    const thread_arg_t *t = arg;
-
-    for (unsigned i = 0; i < t->iters; ++i) {
-        // Используем общий пул данных, циклически
-        // Смещаем индекс на thread_id, чтобы потоки реже работали с одними и теми же данными
-        unsigned data_idx = (i + t->thread_id) % t->data_count;
+    thread_arg_t *t = arg;
+    const bignum_t *a = t->a;
+    const bignum_t *b = t->b;
+    bignum_t *own = NULL;
 
-        bignum_t a_dst = t->a[data_idx];
-        bignum_t b_dst = t->b[data_idx];
+    if (t->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(t->cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+    if (t->mode == POOL_PRIVATE) {
+        // Копия размещается самим потоком — страницы попадают в его NUMA-узел
+        own = malloc(sizeof(bignum_t) * t->data_count * 2);
+        if (own == NULL) {
+            gate_wait(t->start);
+            return (void*)1;
+        }
+        memcpy(own, a, sizeof(bignum_t) * t->data_count);
+        memcpy(own + t->data_count, b, sizeof(bignum_t) * t->data_count);
+        a = own;
+        b = own + t->data_count;
+    }
+    bench_hist_reset(&t->hist);
 
-        bignum_cmp(&a_dst, &b_dst);
+    // Все потоки проходят пул в одном порядке: в режиме shared они
+    // одновременно читают одни и те же горячие ключи
+    size_t idx = 0;
+    int acc = 0;
 
-        if (a_dst.len == 0xDEADBEEF) {
-            return (void*)1;
+    if (!gate_wait(t->start)) {
+        free(own);
+        return NULL;
+    }
+    uint64_t t_start = bench_rdtscp();
+    for (uint64_t done = 0; done < t->iters; done += t->batch) {
+        uint64_t t0 = bench_rdtscp();
+        for (unsigned j = 0; j < t->batch; ++j) {
+            acc += bignum_cmp(&a[idx], &b[idx]);
+            if (++idx == t->data_count) {
+                idx = 0;
+            }
         }
+        bench_hist_record(&t->hist, bench_rdtscp() - t0);
     }
+    t->elapsed = bench_rdtscp() - t_start;
+    t->sink = acc;
+
+    free(own);
     return NULL;
 }
 
-int main(void) {
+/** Частота TSC в тиках на наносекунду (калибровка по CLOCK_MONOTONIC). */
+static double calibrate_tsc_per_ns(void)
+{
+    struct timespec t0, t1, pause = { 0, 100 * 1000 * 1000 };
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    uint64_t c0 = bench_rdtscp();
+    nanosleep(&pause, NULL);
+    uint64_t c1 = bench_rdtscp();
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double)(c1 - c0) / (double)bench_ts_diff_ns(&t0, &t1);
+}
+
+/** CPU, на которых разрешено работать процессу (учитывает taskset). */
+static int allowed_cpus(int *cpus, int max)
+{
+    cpu_set_t set;
+    int n = 0;
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+        return 0;
+    }
+    for (int c = 0; c < CPU_SETSIZE && n < max; ++c) {
+        if (CPU_ISSET(c, &set)) {
+            cpus[n++] = c;
+        }
+    }
+    return n;
+}
+
+/** Разбирает список "1,2,4,8". */
+static int parse_threads(const char *s, unsigned *out, int max)
+{
+    int n = 0;
+    while (*s != '\0' && n < max) {
+        char *end;
+        unsigned long v = strtoul(s, &end, 10);
+        if (end == s || v == 0) {
+            return 0;
+        }
+        out[n++] = (unsigned)v;
+        s = (*end == ',') ? end + 1 : end;
+    }
+    return n;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--threads=1,2,4] [--mode=shared|private|both] [--iters=N] [--batch=B]\n"
+            "          [--pool=N] [--dist=random|same_len|equal|skewed] [--len=N] [--depth=D]\n"
+            "          [--format=text|csv]\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    unsigned sweep[MAX_SWEEP];
+    int      sweep_n  = 0;
+    int      mode_lo  = POOL_SHARED, mode_hi = POOL_PRIVATE;
+    uint64_t iters    = ITER_PER_THREAD;
+    unsigned batch    = DEFAULT_BATCH;
+    size_t   pool     = PREGEN_DATA_COUNT;
+    bench_fmt_t fmt   = BENCH_FMT_TEXT;
+    bench_input_cfg_t cfg = { BENCH_DIST_RANDOM, BIGNUM_CAPACITY, 0, 0 };
+
+    for (unsigned n = 1; n <= THREAD_COUNT && sweep_n < MAX_SWEEP; n *= 2) {
+        sweep[sweep_n++] = n;
+    }
+    if (sweep[sweep_n - 1] != THREAD_COUNT && sweep_n < MAX_SWEEP) {
+        sweep[sweep_n++] = THREAD_COUNT;
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--threads=", 10) == 0) { if ((sweep_n = parse_threads(arg + 10, sweep, MAX_SWEEP)) == 0) { usage(argv[0]); return 1; } }
+        else if (strcmp(arg, "--mode=shared") == 0)   { mode_lo = mode_hi = POOL_SHARED; }
+        else if (strcmp(arg, "--mode=private") == 0)  { mode_lo = mode_hi = POOL_PRIVATE; }
+        else if (strcmp(arg, "--mode=both") == 0)     { mode_lo = POOL_SHARED; mode_hi = POOL_PRIVATE; }
+        else if (strncmp(arg, "--iters=", 8) == 0)    { iters = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--batch=", 8) == 0)    { batch = (unsigned)strtoul(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--pool=", 7) == 0)     { pool  = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--dist=", 7) == 0)     { if (!bench_parse_dist(arg + 7, &cfg.dist)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--len=", 6) == 0)      { cfg.len   = strtoull(arg + 6, NULL, 10); }
+        else if (strncmp(arg, "--depth=", 8) == 0)    { cfg.depth = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)   { if (!bench_parse_fmt(arg + 9, &fmt) || fmt == BENCH_FMT_JSON) { usage(argv[0]); return 1; } }
+        else { usage(argv[0]); return 1; }
+    }
+    if (batch == 0 || pool == 0 || iters < batch) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // В режиме csv в stdout идут только строки таблицы, служебные сообщения — в stderr
+    FILE *info = (fmt == BENCH_FMT_CSV) ? stderr : stdout;
+
     // --- Фаза 1: Предварительная генерация данных в основном потоке ---
-    printf("Pregenerating %u data sets for %u threads...\n", PREGEN_DATA_COUNT, THREAD_COUNT);
-    bignum_t* a = malloc(sizeof(bignum_t) * PREGEN_DATA_COUNT);
-    bignum_t* b = malloc(sizeof(bignum_t) * PREGEN_DATA_COUNT);
+    fprintf(info, "Pregenerating %zu data sets (dist=%s)...\n", pool, bench_dist_name(cfg.dist));
+    bignum_t* a = malloc(sizeof(bignum_t) * pool);
+    bignum_t* b = malloc(sizeof(bignum_t) * pool);
 
+    unsigned max_threads = 0;
+    for (int i = 0; i < sweep_n; ++i) {
+        if (sweep[i] > max_threads) max_threads = sweep[i];
+    }
+    thread_arg_t *args = aligned_alloc(64, sizeof(thread_arg_t) * max_threads);
+    pthread_t *threads = malloc(sizeof(pthread_t) * max_threads);
+    bench_hist_t *total = aligned_alloc(64, sizeof(bench_hist_t));
 
-    if (!a || !b) {
+    if (!a || !b || !args || !threads || !total) {
         perror("Failed to allocate memory for test data");
+        free(a); free(b); free(args); free(threads); free(total);
         return 1;
     }
+    bench_fill_pairs(a, b, pool, &cfg);
 
-    srand((unsigned)time(NULL));
-    for (unsigned i = 0; i < PREGEN_DATA_COUNT; ++i) {
-        init_random_bignum(&a[i]);
-        init_random_bignum(&b[i]);
-    }
-
-    // --- Фаза 2: Запуск потоков и профилирование ---
-    printf("Starting benchmark with %u threads, %u iterations each...\n", THREAD_COUNT, ITER_PER_THREAD);
-    pthread_t threads[THREAD_COUNT];
-    thread_arg_t args[THREAD_COUNT];
-
-    for (unsigned i = 0; i < THREAD_COUNT; ++i) {
-        args[i].thread_id = i;
-        args[i].iters     = ITER_PER_THREAD;
-        args[i].a   = a;
-        args[i].b    = b;
-        args[i].data_count = PREGEN_DATA_COUNT;
-        if (pthread_create(&threads[i], NULL, thread_func, &args[i]) != 0) {
-            perror("pthread_create");
-            free(a);
-            free(b);
-            return 1;
-        }
+    int cpus[CPU_SETSIZE];
+    int ncpus = allowed_cpus(cpus, CPU_SETSIZE);
+    double tsc_per_ns = calibrate_tsc_per_ns();
+
+    // --- Фаза 2: Проход по числу потоков и режимам пула ---
+    fprintf(info, "Batch=%u calls per rdtscp sample, %llu iterations per thread, TSC %.3f GHz\n\n",
+            batch, (unsigned long long)iters, tsc_per_ns);
+    if (fmt == BENCH_FMT_CSV) {
+        printf("threads,mode,mops,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+    } else {
+        printf("%7s %8s %10s %9s %9s %9s %9s %9s\n",
+               "threads", "mode", "Mops/s", "p50,ns", "p90,ns", "p99,ns", "p99.9,ns", "max,ns");
     }
 
-    for (unsigned i = 0; i < THREAD_COUNT; ++i) {
-        void *res;
-        pthread_join(threads[i], &res);
-        if (res != NULL) {
-            fprintf(stderr, "Error in thread %u\n", i);
+    int rc = 0;
+    for (int s = 0; s < sweep_n && rc == 0; ++s) {
+        for (int mode = mode_lo; mode <= mode_hi && rc == 0; ++mode) {
+            unsigned nthreads = sweep[s];
+            start_gate_t start = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, 0 };
+
+            for (unsigned i = 0; i < nthreads; ++i) {
+                args[i].thread_id  = i;
+                args[i].cpu        = (ncpus > 0) ? cpus[i % (unsigned)ncpus] : -1;
+                args[i].iters      = iters - iters % batch;
+                args[i].batch      = batch;
+                args[i].mode       = (pool_mode_t)mode;
+                args[i].a          = a;
+                args[i].b          = b;
+                args[i].data_count = pool;
+                args[i].start      = &start;
+                int err = pthread_create(&threads[i], NULL, thread_func, &args[i]);
+                if (err != 0) {
+                    fprintf(stderr, "pthread_create: %s\n", strerror(err));
+                    // Запущенные потоки ждут на затворе: отпускаем их и дожидаемся до free
+                    gate_open(&start, i, -1);
+                    for (unsigned k = 0; k < i; ++k) {
+                        pthread_join(threads[k], NULL);
+                    }
+                    pthread_cond_destroy(&start.cond);
+                    pthread_mutex_destroy(&start.lock);
+                    free(a); free(b); free(args); free(threads); free(total);
+                    return 1;
+                }
+            }
+            gate_open(&start, nthreads, 1);
+
+            bench_hist_reset(total);
+            uint64_t max_elapsed = 0;
+            for (unsigned i = 0; i < nthreads; ++i) {
+                void *res;
+                pthread_join(threads[i], &res);
+                if (res != NULL) {
+                    fprintf(stderr, "Error in thread %u\n", i);
+                    rc = 1;
+                }
+                bench_hist_merge(total, &args[i].hist);
+                if (args[i].elapsed > max_elapsed) {
+                    max_elapsed = args[i].elapsed;
+                }
+            }
+            pthread_cond_destroy(&start.cond);
+            pthread_mutex_destroy(&start.lock);
+
+            // Перцентили пачек → на одну операцию, тики → ns
+            double scale = 1.0 / ((double)batch * tsc_per_ns);
+            double ops   = (double)args[0].iters * nthreads;
+            double mops  = ops / ((double)max_elapsed / tsc_per_ns) * 1e3;
+            const char *mode_name = (mode == POOL_SHARED) ? "shared" : "private";
+            double p50  = (double)bench_hist_percentile(total, 50.0) * scale;
+            double p90  = (double)bench_hist_percentile(total, 90.0) * scale;
+            double p99  = (double)bench_hist_percentile(total, 99.0) * scale;
+            double p999 = (double)bench_hist_percentile(total, 99.9) * scale;
+            double pmax = (double)total->max * scale;
+
+            if (fmt == BENCH_FMT_CSV) {
+                printf("%u,%s,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n",
+                       nthreads, mode_name, mops, p50, p90, p99, p999, pmax);
+            } else {
+                printf("%7u %8s %10.2f %9.2f %9.2f %9.2f %9.2f %9.2f\n",
+                       nthreads, mode_name, mops, p50, p90, p99, p999, pmax);
+            }
         }
     }
-    
-    printf("Benchmark finished.\n");
+
+    fprintf(info, "\nBenchmark finished.\n");
 
     // --- Фаза 3: Очистка ---
     free(a);
     free(b);
+    free(args);
+    free(threads);
+    free(total);
 
-    return 0;
+    return rc;
 }
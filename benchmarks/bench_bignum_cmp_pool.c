@@ -0,0 +1,237 @@
+/**
+ * @file    bench_bignum_cmp_pool.c
+ * @brief   Бенчмарк пакетного сравнения: потоки на каждый вызов против
+ *          `bignum_parallel_for` на пуле.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Вызов — `out[i] = bignum_cmp(&a[i % P], &b[i % P])` для `i ∈ [0, n)`, где
+ *   `P = min(n, 65536)` пар со смесью длин `skewed`. Вызовы повторяются, пока
+ *   не наберётся `--ops` сравнений. Строки (операция = одно сравнение):
+ *   - `spawn/nN/tT` — `[0, n)` делится на T частей, T - 1 потоков создаются
+ *                     `pthread_create` на каждый вызов (как `_mt`-функции до
+ *                     пула), часть 0 выполняет вызывающий (базовая линия);
+ *   - `pool/nN/tT`  — `bignum_parallel_for(n, grain, ...)` на пуле из T потоков
+ *                     (`bignum_pool_set_threads(T)`), `grain = max(n / (8T), 256)`.
+ *
+ *   Размер пула по умолчанию ограничен маской CPU, поэтому под `taskset -c 0-3`
+ *   больше четырёх потоков пул не закрепляет; `--threads` задаёт размер явно.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_pool [--ops=OPS] [--n=1000,65536,1048576] [--threads=1,2,4,8]
+ *                             [--seed=S] [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_pool REPORT_NAME=baseline BENCH_ARGS="--threads=1,2,4,8,16"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_pool.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_OPS 20000000ull
+#define MAX_SWEEP   16
+#define MAX_PAIRS   65536
+
+typedef struct {
+    const bignum_t *a, *b;
+    int            *out;
+    size_t          mask;               /**< `P - 1`, `P` — степень двойки. */
+} batch_t;
+
+static void cmp_range(size_t begin, size_t end, void *arg)
+{
+    const batch_t *c = arg;
+    for (size_t i = begin; i < end; ++i) {
+        c->out[i] = bignum_cmp(&c->a[i & c->mask], &c->b[i & c->mask]);
+    }
+}
+
+typedef struct {
+    const batch_t *c;
+    size_t         begin, end;
+} spawn_job_t;
+
+static void *spawn_worker(void *arg)
+{
+    spawn_job_t *job = arg;
+    cmp_range(job->begin, job->end, (void *)job->c);
+    return NULL;
+}
+
+/** Один вызов с созданием потоков; `0` при ошибке. */
+static int spawn_call(const batch_t *c, size_t n, unsigned t)
+{
+    pthread_t   tids[256];
+    spawn_job_t jobs[256];
+    unsigned    started = 0;
+    if (t == 0 || t > 256) {
+        return 0;
+    }
+    for (unsigned i = 0; i < t; ++i) {
+        jobs[i] = (spawn_job_t){ c, n * i / t, n * (i + 1) / t };
+    }
+    for (unsigned i = 1; i < t; ++i) {
+        if (pthread_create(&tids[i], NULL, spawn_worker, &jobs[i]) != 0) {
+            break;
+        }
+        started = i;
+    }
+    spawn_worker(&jobs[0]);
+    for (unsigned i = 1; i <= started; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    return started + 1 == t;
+}
+
+static int parse_list(const char *p, size_t *vals, size_t *count)
+{
+    *count = 0;
+    while (*p != '\0' && *count < MAX_SWEEP) {
+        char *end;
+        vals[(*count)++] = (size_t)strtoull(p, &end, 10);
+        if (end == p) {
+            return 0;
+        }
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return *count > 0;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--ops=OPS] [--n=1000,65536,1048576] [--threads=1,2,4,8] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t ops = DEFAULT_OPS, seed = 0;
+    size_t sizes[MAX_SWEEP] = { 1000, 65536, 1048576 }, nsizes = 3;
+    size_t threads[MAX_SWEEP] = { 1, 2, 4, 8 }, nthreads = 4;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--ops=", 6) == 0)     { ops = strtoull(arg + 6, NULL, 10); }
+        else if (strncmp(arg, "--n=", 4) == 0)       { if (!parse_list(arg + 4, sizes, &nsizes)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--threads=", 10) == 0) { if (!parse_list(arg + 10, threads, &nthreads)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    size_t nmax = 0;
+    for (size_t s = 0; s < nsizes; ++s) {
+        if (sizes[s] == 0) { usage(argv[0]); return 1; }
+        nmax = sizes[s] > nmax ? sizes[s] : nmax;
+    }
+    for (size_t t = 0; t < nthreads; ++t) {
+        if (threads[t] == 0 || threads[t] > 256) { usage(argv[0]); return 1; }
+    }
+    if (ops == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *a = malloc(sizeof(bignum_t) * MAX_PAIRS);
+    bignum_t *b = malloc(sizeof(bignum_t) * MAX_PAIRS);
+    int    *out = malloc(sizeof(int) * nmax);
+    if (a == NULL || b == NULL || out == NULL) {
+        perror("Failed to allocate memory for test data");
+        free(a);
+        free(b);
+        free(out);
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < MAX_PAIRS; ++i) {
+        bench_random_bignum(&a[i], bench_skewed_len(&rng), &rng);
+        bench_random_bignum(&b[i], bench_skewed_len(&rng), &rng);
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(a);
+        free(b);
+        free(out);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    int first = 1;
+    for (size_t s = 0; s < nsizes; ++s) {
+        size_t n = sizes[s];
+        size_t p = 1;
+        while (p * 2 <= n && p * 2 <= MAX_PAIRS) {
+            p *= 2;
+        }
+        batch_t c = { a, b, out, p - 1 };
+        size_t reps = (size_t)(ops / n) + 1;
+        for (size_t t = 0; t < nthreads; ++t) {
+            unsigned T = (unsigned)threads[t];
+            int ok = 1;
+
+            bench_region_begin(&hw, &reg);
+            for (size_t r = 0; r < reps && ok; ++r) {
+                ok = spawn_call(&c, n, T);
+            }
+            bench_region_end(&hw, &reg);
+            snprintf(label, sizeof(label), "spawn/n%zu/t%u", n, T);
+            if (ok) {
+                bench_report_row(fp, fmt, first, label, &reg, reps * n);
+                first = 0;
+            }
+
+            if (bignum_pool_set_threads(T) != BIGNUM_POOL_OK) {
+                continue;
+            }
+            size_t grain = n / (8 * (size_t)T);
+            grain = grain > 256 ? grain : 256;
+            bignum_pool_threads();                          /* запуск пула вне замера */
+            ok = 1;
+            bench_region_begin(&hw, &reg);
+            for (size_t r = 0; r < reps && ok; ++r) {
+                ok = bignum_parallel_for(n, grain, cmp_range, &c) == BIGNUM_POOL_OK;
+            }
+            bench_region_end(&hw, &reg);
+            snprintf(label, sizeof(label), "pool/n%zu/t%u", n, T);
+            if (ok) {
+                bench_report_row(fp, fmt, first, label, &reg, reps * n);
+                first = 0;
+            }
+        }
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    bignum_pool_shutdown();
+    free(a);
+    free(b);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,240 @@
+/**
+ * @file    bench_bignum_cmp_prefix.c
+ * @brief   Бенчмарк сортировки и поиска: `bignum_cmp` против кэша префиксных
+ *          ключей и `bignum_cmp_cached`.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Для каждого распределения строятся `--n` чисел:
+ *   - `skewed`   — длины из смеси `skewed` (bench_inputs.h);
+ *   - `random`   — длины равномерно 1..BIGNUM_CAPACITY;
+ *   - `same_top` — длина 8, старшее слово из 16 значений (много совпадений
+ *                  ключей, худший случай для кэша).
+ *
+ *   Строки (операция = один элемент или один запрос):
+ *   - `sort/plain/D`    — `qsort` указателей с `bignum_cmp` (базовая линия);
+ *   - `sort/cached/D`   — `bignum_prefixed_init` + `qsort` записей
+ *                         `bignum_prefixed_t` с `bignum_cmp_prefixed`;
+ *   - `search/plain/D`  — нижняя граница двоичным поиском по отсортированному
+ *                         массиву с `bignum_cmp`;
+ *   - `search/cached/D` — то же по массиву ключей с `bignum_cmp_cached`
+ *                         (ключ запроса считается один раз).
+ *
+ *   Доля сравнений, решённых одним ключом, считается отдельным
+ *   (неизмеряемым) проходом сортировки и печатается в stderr.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_prefix [--n=1000000] [--queries=1000000] [--seed=S]
+ *                               [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_prefix REPORT_NAME=baseline
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_prefix.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+typedef enum { DIST_SKEWED = 0, DIST_RANDOM, DIST_SAME_TOP, DIST_COUNT } prefix_dist_t;
+
+static const char *const dist_names[DIST_COUNT] = { "skewed", "random", "same_top" };
+
+static void fill(bignum_t *xs, size_t n, prefix_dist_t dist, uint64_t *rng)
+{
+    for (size_t i = 0; i < n; ++i) {
+        switch (dist) {
+        case DIST_SKEWED:
+            bench_random_bignum(&xs[i], bench_skewed_len(rng), rng);
+            break;
+        case DIST_RANDOM:
+            bench_random_bignum(&xs[i], (size_t)(bench_rng_next(rng) % BIGNUM_CAPACITY) + 1, rng);
+            break;
+        default: {
+            size_t len = BIGNUM_CAPACITY < 8 ? BIGNUM_CAPACITY : 8;
+            bench_random_bignum(&xs[i], len, rng);
+            xs[i].words[len - 1] = (bench_rng_next(rng) % 16 + 1) << 59;
+            break;
+        }
+        }
+    }
+}
+
+static int cmp_ptr(const void *p, const void *q)
+{
+    return bignum_cmp(*(const bignum_t *const *)p, *(const bignum_t *const *)q);
+}
+
+static int cmp_prefixed(const void *p, const void *q)
+{
+    return bignum_cmp_prefixed(p, q);
+}
+
+static uint64_t g_compares, g_fallbacks;
+
+static int cmp_prefixed_counting(const void *p, const void *q)
+{
+    const bignum_prefixed_t *a = p, *b = q;
+    g_compares++;
+    g_fallbacks += a->key == b->key;
+    return bignum_cmp_prefixed(a, b);
+}
+
+static size_t lower_bound_plain(const bignum_t *keys, size_t n, const bignum_t *x)
+{
+    size_t lo = 0;
+    while (n > 0) {
+        size_t half = n / 2;
+        if (bignum_cmp(&keys[lo + half], x) < 0) {
+            lo += half + 1;
+            n  -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+    return lo;
+}
+
+static size_t lower_bound_cached(const uint64_t *pk, const bignum_t *keys, size_t n, const bignum_t *x)
+{
+    uint64_t kx = bignum_prefix_key(x);
+    size_t lo = 0;
+    while (n > 0) {
+        size_t half = n / 2;
+        if (bignum_cmp_cached(pk[lo + half], &keys[lo + half], kx, x) < 0) {
+            lo += half + 1;
+            n  -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+    return lo;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=1000000] [--queries=1000000] [--seed=S] [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    size_t n = 1000000, nq = 1000000;
+    uint64_t seed = 0;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n = (size_t)strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--queries=", 10) == 0) { nq = (size_t)strtoull(arg + 10, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || nq == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t          *xs     = malloc(sizeof(bignum_t) * n);
+    bignum_t          *sorted = malloc(sizeof(bignum_t) * n);
+    bignum_t          *qs     = malloc(sizeof(bignum_t) * nq);
+    const bignum_t   **ptrs   = malloc(sizeof(*ptrs) * n);
+    bignum_prefixed_t *recs   = malloc(sizeof(*recs) * n);
+    uint64_t          *pk     = malloc(sizeof(uint64_t) * n);
+    if (xs == NULL || sorted == NULL || qs == NULL || ptrs == NULL || recs == NULL || pk == NULL) {
+        perror("Failed to allocate memory for test data");
+        free(xs); free(sorted); free(qs); free(ptrs); free(recs); free(pk);
+        return 1;
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(xs); free(sorted); free(qs); free(ptrs); free(recs); free(pk);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    int first = 1;
+    size_t sink = 0;
+    for (int d = 0; d < DIST_COUNT; ++d) {
+        uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+        fill(xs, n, (prefix_dist_t)d, &rng);
+        fill(qs, nq, (prefix_dist_t)d, &rng);
+
+        for (size_t i = 0; i < n; ++i) {
+            ptrs[i] = &xs[i];
+        }
+        bench_region_begin(&hw, &reg);
+        qsort(ptrs, n, sizeof(*ptrs), cmp_ptr);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "sort/plain/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+        first = 0;
+
+        bench_region_begin(&hw, &reg);
+        bignum_prefixed_init(xs, n, recs);
+        qsort(recs, n, sizeof(*recs), cmp_prefixed);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "sort/cached/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+
+        g_compares = g_fallbacks = 0;
+        bignum_prefixed_init(xs, n, recs);
+        qsort(recs, n, sizeof(*recs), cmp_prefixed_counting);
+        fprintf(stderr, "sort/%s: %llu compares, %.2f%% resolved by prefix key\n", dist_names[d],
+                (unsigned long long)g_compares,
+                g_compares ? 100.0 * (double)(g_compares - g_fallbacks) / (double)g_compares : 0.0);
+
+        for (size_t i = 0; i < n; ++i) {
+            sorted[i] = *recs[i].num;
+        }
+        bignum_prefix_keys(sorted, n, pk);
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < nq; ++i) {
+            sink += lower_bound_plain(sorted, n, &qs[i]);
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "search/plain/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, nq);
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < nq; ++i) {
+            sink -= lower_bound_cached(pk, sorted, n, &qs[i]);
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "search/cached/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, nq);
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    if (sink != 0) {
+        fprintf(stderr, "search mismatch: plain and cached lower bounds differ\n");
+    }
+    free(xs); free(sorted); free(qs); free(ptrs); free(recs); free(pk);
+    return sink != 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file    bench_bignum_cmp_runs.c
+ * @brief   Бенчмарк проверки упорядоченности: наивный цикл bignum_cmp против
+ *          bignum_is_sorted, bignum_sorted_runs и bignum_is_sorted_mt.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Массив из N ключей (длины — смесь `skewed`, см. bench_inputs.h) разбит на
+ *   `--runs` отсортированных кусков равной длины (`1` — весь массив
+ *   отсортирован, худший случай для `is_sorted`: нужен полный проход).
+ *   Строки (вызов = один элемент входа):
+ *   - `naive`         — `bignum_cmp` на каждой соседней паре (базовая линия);
+ *   - `is_sorted`     — `bignum_is_sorted`;
+ *   - `sorted_runs`   — `bignum_sorted_runs` со всеми границами серий;
+ *   - `is_sorted_mt/tN` — `bignum_is_sorted_mt` на N потоках (`--threads`).
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_runs [--n=N] [--runs=R] [--threads=1,2,4,8] [--seed=S]
+ *                             [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_runs REPORT_NAME=baseline BENCH_ARGS="--n=10000000"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_runs.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N    4000000ull
+#define DEFAULT_RUNS 1ull
+#define MAX_SWEEP    16
+
+static volatile size_t g_sink;
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--runs=R] [--threads=1,2,4,8] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, runs = DEFAULT_RUNS, seed = 0;
+    unsigned threads[MAX_SWEEP] = { 1, 2, 4, 8 };
+    size_t nthreads = 4;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n    = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--runs=", 7) == 0)    { runs = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--threads=", 10) == 0) {
+            nthreads = 0;
+            for (const char *p = arg + 10; *p != '\0' && nthreads < MAX_SWEEP; ) {
+                char *end;
+                threads[nthreads++] = (unsigned)strtoul(p, &end, 10);
+                p = (*end == ',') ? end + 1 : end;
+                if (end == p && *end != '\0') { usage(argv[0]); return 1; }
+            }
+        }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n < 2 || runs == 0 || runs > n) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *input  = malloc(sizeof(bignum_t) * n);
+    size_t   *starts = malloc(sizeof(size_t) * n);
+    if (!input || !starts) {
+        perror("Failed to allocate memory for test data");
+        free(input); free(starts);
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n; ++i) {
+        bench_random_bignum(&input[i], bench_skewed_len(&rng), &rng);
+    }
+    for (uint64_t r = 0; r < runs; ++r) {
+        uint64_t lo = n * r / runs, hi = n * (r + 1) / runs;
+        qsort(&input[lo], hi - lo, sizeof(bignum_t), cmp_qsort);
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(input); free(starts);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    size_t until = 0, count = 0, ref_until = n;
+
+    bench_region_begin(&hw, &reg);
+    for (size_t i = 1; i < n; ++i) {
+        if (bignum_cmp(&input[i - 1], &input[i]) > 0) {
+            ref_until = i;
+            break;
+        }
+    }
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "naive/runs=%llu", (unsigned long long)runs);
+    bench_report_row(fp, fmt, 1, label, &reg, n);
+
+    bench_region_begin(&hw, &reg);
+    bignum_is_sorted(input, n, &until);
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "is_sorted/runs=%llu", (unsigned long long)runs);
+    bench_report_row(fp, fmt, 0, label, &reg, n);
+    if (until != ref_until) {
+        fprintf(stderr, "is_sorted: result mismatch against naive loop\n");
+    }
+
+    bench_region_begin(&hw, &reg);
+    bignum_sorted_runs(input, n, starts, n, &count);
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "sorted_runs/runs=%llu", (unsigned long long)runs);
+    bench_report_row(fp, fmt, 0, label, &reg, n);
+    g_sink += count;
+
+    for (size_t t = 0; t < nthreads; ++t) {
+        bench_region_begin(&hw, &reg);
+        bignum_is_sorted_mt(input, n, threads[t], &until);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "is_sorted_mt/t%u/runs=%llu", threads[t], (unsigned long long)runs);
+        bench_report_row(fp, fmt, 0, label, &reg, n);
+        if (until != ref_until) {
+            fprintf(stderr, "is_sorted_mt/t%u: result mismatch against naive loop\n", threads[t]);
+        }
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    free(input);
+    free(starts);
+    return 0;
+}
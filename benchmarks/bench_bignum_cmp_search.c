@@ -0,0 +1,216 @@
+/**
+ * @file    bench_bignum_cmp_search.c
+ * @brief   Бенчмарк пакетного поиска с чередованием запросов (AMAC) против
+ *          поштучного цикла: двоичный поиск по массиву и B+-индекс.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Строит отсортированный массив из N ключей (смесь длин `skewed`) и
+ *   `QUERIES` запросов (`--miss`% случайных, остальные — ключи массива).
+ *   Запросы идут пакетами по `--batch` подряд по кругу. Строки (вызов = один
+ *   поиск):
+ *   - `bsearch/n=N`       — цикл двоичного поиска с `bignum_cmp` (базовая линия);
+ *   - `bsearch_batch/n=N` — `bignum_lower_bound_batch` на каждом пакете;
+ *   - `btree/n=N`         — цикл `bignum_btree_lower_bound`;
+ *   - `btree_batch/n=N`   — `bignum_btree_lower_bound_batch`.
+ *
+ *   Выигрыш появляется, когда ключи (или индекс) не помещаются в LLC: при
+ *   N = 1e7 массив занимает ~2.7 ГБ, индекс — ~100 МБ. В stderr печатаются
+ *   миллионы поисков в секунду по каждой строке.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_search [--n=N] [--lookups=N] [--batch=B] [--miss=PCT] [--seed=S]
+ *                               [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_search REPORT_NAME=baseline BENCH_ARGS="--n=10000000"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_btree.h"
+#include "bignum_cmp_search.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N       1000000ull
+#define DEFAULT_LOOKUPS 2000000ull
+#define DEFAULT_BATCH   256
+#define DEFAULT_MISS    50
+#define QUERIES         65536           /* запросов в кольце */
+
+static volatile size_t g_sink;
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static size_t bsearch_lower(const bignum_t *keys, size_t n, const bignum_t *x)
+{
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (bignum_cmp(&keys[mid], x) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+typedef enum { MODE_BSEARCH, MODE_BSEARCH_BATCH, MODE_BTREE, MODE_BTREE_BATCH } search_mode_t;
+
+/** Выполняет `lookups` поисков пакетами по `batch`; возвращает сумму позиций. */
+static size_t run(search_mode_t mode, const bignum_t *keys, size_t n, const bignum_btree_t *tree,
+                  const bignum_t *xs, size_t lookups, size_t batch, size_t *pos)
+{
+    size_t acc = 0, start = 0;
+    for (size_t done = 0; done < lookups; ) {
+        size_t m = batch;
+        if (m > lookups - done) {
+            m = lookups - done;
+        }
+        if (m > QUERIES - start) {
+            m = QUERIES - start;
+        }
+        const bignum_t *q = &xs[start];
+        switch (mode) {
+        case MODE_BSEARCH:
+            for (size_t i = 0; i < m; ++i) {
+                pos[i] = bsearch_lower(keys, n, &q[i]);
+            }
+            break;
+        case MODE_BSEARCH_BATCH:
+            bignum_lower_bound_batch(keys, n, q, m, pos);
+            break;
+        case MODE_BTREE:
+            for (size_t i = 0; i < m; ++i) {
+                bignum_btree_lower_bound(tree, &q[i], &pos[i]);
+            }
+            break;
+        case MODE_BTREE_BATCH:
+            bignum_btree_lower_bound_batch(tree, q, m, pos);
+            break;
+        }
+        for (size_t i = 0; i < m; ++i) {
+            acc += pos[i];
+        }
+        done += m;
+        start = (start + m) % QUERIES;
+    }
+    return acc;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--lookups=N] [--batch=B] [--miss=PCT] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, lookups = DEFAULT_LOOKUPS, batch = DEFAULT_BATCH, seed = 0;
+    unsigned miss = DEFAULT_MISS;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n       = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--lookups=", 10) == 0) { lookups = strtoull(arg + 10, NULL, 10); }
+        else if (strncmp(arg, "--batch=", 8) == 0)   { batch   = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--miss=", 7) == 0)    { miss    = (unsigned)strtoul(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed    = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || lookups == 0 || batch == 0 || batch > QUERIES || miss > 100) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *keys = malloc(sizeof(bignum_t) * n);
+    bignum_t *xs   = malloc(sizeof(bignum_t) * QUERIES);
+    size_t   *pos  = malloc(sizeof(size_t) * batch);
+    if (!keys || !xs || !pos) {
+        perror("Failed to allocate memory for test data");
+        free(keys); free(xs); free(pos);
+        return 1;
+    }
+
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n; ++i) {
+        bench_random_bignum(&keys[i], bench_skewed_len(&rng), &rng);
+    }
+    qsort(keys, n, sizeof(bignum_t), cmp_qsort);
+    for (size_t i = 0; i < QUERIES; ++i) {
+        if (bench_rng_next(&rng) % 100 < miss) {
+            bench_random_bignum(&xs[i], bench_skewed_len(&rng), &rng);
+        } else {
+            xs[i] = keys[bench_rng_next(&rng) % n];
+        }
+    }
+
+    bignum_btree_t tree;
+    if (bignum_btree_build(&tree, keys, n) != BIGNUM_BTREE_OK) {
+        fprintf(stderr, "bignum_btree_build failed\n");
+        free(keys); free(xs); free(pos);
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (path != NULL && (out = fopen(path, "w")) == NULL) {
+        perror(path);
+        bignum_btree_free(&tree);
+        free(keys); free(xs); free(pos);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(out, fmt);
+
+    static const char *names[] = { "bsearch", "bsearch_batch", "btree", "btree_batch" };
+    char label[64];
+    bench_region_t reg;
+    size_t expect = 0;
+    for (int mode = MODE_BSEARCH; mode <= MODE_BTREE_BATCH; ++mode) {
+        bench_region_begin(&hw, &reg);
+        size_t acc = run((search_mode_t)mode, keys, n, &tree, xs, lookups, batch, pos);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "%s/n=%llu", names[mode], (unsigned long long)n);
+        bench_report_row(out, fmt, mode == MODE_BSEARCH, label, &reg, lookups);
+        fprintf(stderr, "%s: %.2f Mlookups/s\n", label, (double)lookups / (reg.ns / 1e3));
+        if (mode == MODE_BSEARCH) {
+            expect = acc;
+        } else if (acc != expect) {
+            fprintf(stderr, "%s: result mismatch against binary search\n", label);
+        }
+        g_sink = acc;
+    }
+
+    bench_report_end(out, fmt);
+    bench_hw_close(&hw);
+    if (out != stdout) {
+        fclose(out);
+    }
+    bignum_btree_free(&tree);
+    free(keys);
+    free(xs);
+    free(pos);
+    return 0;
+}
@@ -0,0 +1,262 @@
+/**
+ * @file    bench_bignum_cmp_shared.c
+ * @brief   Бенчмарк чтения изменяемого общего значения: масштабирование по числу
+ *          читателей для mutex, rwlock и seqlock (`bignum_cmp_snapshot`).
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Один писатель непрерывно увеличивает общий «итог» (`--len` слов) и
+ *   публикует его, делая между записями `--gap` холостых итераций. R читателей
+ *   выполняют `--ops / R` сравнений итога с порогами из небольшого пула
+ *   (у порогов то же старшее слово, поэтому сравнение доходит до второго).
+ *   Строки (вызов = одно сравнение, по всем читателям):
+ *   - `mutex/rN`   — `pthread_mutex` вокруг `bignum_cmp` (базовая линия);
+ *   - `rwlock/rN`  — `pthread_rwlock`, читатели под `rdlock`;
+ *   - `seqlock/rN` — `bignum_shared_t` и `bignum_cmp_snapshot`.
+ *
+ *   В stderr печатается, сколько записей писатель успел сделать за прогон.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_shared [--ops=OPS] [--len=L] [--gap=G] [--threads=1,2,4,8,16]
+ *                               [--seed=S] [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_shared REPORT_NAME=baseline BENCH_ARGS="--threads=1,2,4,8,16"
+ */
+
+#define _GNU_SOURCE
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_shared.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_OPS 4000000ull
+#define DEFAULT_LEN 8
+#define DEFAULT_GAP 1000
+#define MAX_SWEEP   16
+#define POOL        256                 /* порогов */
+
+typedef enum { KIND_MUTEX, KIND_RWLOCK, KIND_SEQLOCK } kind_t;
+
+typedef struct {
+    kind_t            kind;
+    pthread_mutex_t   mutex;
+    pthread_rwlock_t  rwlock;
+    bignum_t          plain;            /**< Значение для mutex и rwlock. */
+    bignum_shared_t   shared;           /**< Значение для seqlock. */
+    atomic_int        stop;
+    uint64_t          writes;
+    unsigned          gap;
+} shared_state_t;
+
+typedef struct {
+    shared_state_t *st;
+    const bignum_t *pool;
+    size_t          ops, offset;
+} reader_t;
+
+static volatile size_t g_sink;
+
+static void *writer(void *arg)
+{
+    shared_state_t *st = arg;
+    bignum_t total = st->plain;
+    uint64_t writes = 0;
+    while (!atomic_load_explicit(&st->stop, memory_order_relaxed)) {
+        for (size_t i = 0; i < total.len && ++total.words[i] == 0; ++i) {
+        }
+        switch (st->kind) {
+        case KIND_MUTEX:
+            pthread_mutex_lock(&st->mutex);
+            st->plain = total;
+            pthread_mutex_unlock(&st->mutex);
+            break;
+        case KIND_RWLOCK:
+            pthread_rwlock_wrlock(&st->rwlock);
+            st->plain = total;
+            pthread_rwlock_unlock(&st->rwlock);
+            break;
+        case KIND_SEQLOCK:
+            bignum_shared_store(&st->shared, &total);
+            break;
+        }
+        ++writes;
+        for (volatile unsigned g = 0; g < st->gap; ++g) {
+        }
+    }
+    st->writes = writes;
+    return NULL;
+}
+
+static void *reader(void *arg)
+{
+    reader_t *r = arg;
+    shared_state_t *st = r->st;
+    size_t sink = 0;
+    for (size_t i = 0; i < r->ops; ++i) {
+        const bignum_t *thr = &r->pool[(r->offset + i) % POOL];
+        switch (st->kind) {
+        case KIND_MUTEX:
+            pthread_mutex_lock(&st->mutex);
+            sink += (size_t)(bignum_cmp(&st->plain, thr) > 0);
+            pthread_mutex_unlock(&st->mutex);
+            break;
+        case KIND_RWLOCK:
+            pthread_rwlock_rdlock(&st->rwlock);
+            sink += (size_t)(bignum_cmp(&st->plain, thr) > 0);
+            pthread_rwlock_unlock(&st->rwlock);
+            break;
+        case KIND_SEQLOCK:
+            sink += (size_t)(bignum_cmp_snapshot(&st->shared, thr, NULL) > 0);
+            break;
+        }
+    }
+    g_sink += sink;
+    return NULL;
+}
+
+/** Запускает писателя и `t` читателей; замер — от старта до конца читателей. */
+static int run(shared_state_t *st, unsigned t, const bignum_t *pool, size_t ops,
+               bench_hw_t *hw, bench_region_t *reg)
+{
+    pthread_t wtid, tids[256];
+    reader_t  args[256];
+    atomic_store(&st->stop, 0);
+    if (pthread_create(&wtid, NULL, writer, st) != 0) {
+        return -1;
+    }
+    int err = 0;
+    unsigned started = 0;
+    bench_region_begin(hw, reg);
+    for (unsigned i = 0; i < t; ++i) {
+        args[i] = (reader_t){ st, pool, ops / t, (size_t)i * 61 };
+        if (pthread_create(&tids[i], NULL, reader, &args[i]) != 0) {
+            err = -1;
+            break;
+        }
+        started = i + 1;
+    }
+    for (unsigned i = 0; i < started; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    bench_region_end(hw, reg);
+    atomic_store(&st->stop, 1);
+    pthread_join(wtid, NULL);
+    return err;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--ops=OPS] [--len=L] [--gap=G] [--threads=1,2,4,8,16] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t ops = DEFAULT_OPS, seed = 0;
+    size_t len = DEFAULT_LEN;
+    unsigned gap = DEFAULT_GAP;
+    unsigned threads[MAX_SWEEP] = { 1, 2, 4, 8, 16 };
+    size_t nthreads = 5;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--ops=", 6) == 0)     { ops = strtoull(arg + 6, NULL, 10); }
+        else if (strncmp(arg, "--len=", 6) == 0)     { len = (size_t)strtoull(arg + 6, NULL, 10); }
+        else if (strncmp(arg, "--gap=", 6) == 0)     { gap = (unsigned)strtoul(arg + 6, NULL, 10); }
+        else if (strncmp(arg, "--threads=", 10) == 0) {
+            nthreads = 0;
+            for (const char *p = arg + 10; *p != '\0' && nthreads < MAX_SWEEP; ) {
+                char *end;
+                threads[nthreads++] = (unsigned)strtoul(p, &end, 10);
+                p = (*end == ',') ? end + 1 : end;
+                if (end == p && *end != '\0') { usage(argv[0]); return 1; }
+            }
+        }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    for (size_t t = 0; t < nthreads; ++t) {
+        if (threads[t] == 0 || threads[t] > 256) { usage(argv[0]); return 1; }
+    }
+    if (ops == 0 || len < 2 || len > BIGNUM_CAPACITY) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *pool = malloc(sizeof(bignum_t) * POOL);
+    shared_state_t *st = calloc(1, sizeof(shared_state_t));
+    if (!pool || !st) {
+        perror("Failed to allocate memory for test data");
+        free(pool); free(st);
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    bignum_t total;
+    bench_random_bignum(&total, len, &rng);
+    for (size_t i = 0; i < POOL; ++i) {
+        pool[i] = total;
+        pool[i].words[len - 2] = bench_rng_next(&rng);
+    }
+    pthread_mutex_init(&st->mutex, NULL);
+    pthread_rwlock_init(&st->rwlock, NULL);
+    st->gap = gap;
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(pool); free(st);
+        return 1;
+    }
+
+    static const char *const names[] = { "mutex", "rwlock", "seqlock" };
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    for (size_t t = 0; t < nthreads; ++t) {
+        unsigned R = threads[t];
+        size_t   calls = (size_t)(ops / R) * R;
+        for (kind_t k = KIND_MUTEX; k <= KIND_SEQLOCK; ++k) {
+            st->kind  = k;
+            st->plain = total;
+            bignum_shared_init(&st->shared, &total);
+            int err = run(st, R, pool, (size_t)ops, &hw, &reg);
+            snprintf(label, sizeof(label), "%s/r%u", names[k], R);
+            if (err == 0) {
+                bench_report_row(fp, fmt, t == 0 && k == KIND_MUTEX, label, &reg, calls);
+            }
+            fprintf(stderr, "%s: %llu writes\n", label, (unsigned long long)st->writes);
+        }
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    pthread_rwlock_destroy(&st->rwlock);
+    pthread_mutex_destroy(&st->mutex);
+    free(pool);
+    free(st);
+    return 0;
+}
@@ -0,0 +1,300 @@
+/**
+ * @file    bench_bignum_cmp_str.c
+ * @brief   Бенчмарк сравнения со строкой: разбор в `bignum_t` + `bignum_cmp`
+ *          против `bignum_cmp_hexstr` / `bignum_cmp_decstr`.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Моделируется проверка присланных сумм против лимитов: `--n` пар
+ *   (лимит, строка) для каждого распределения:
+ *   - `small` — лимит 2–4 слова, суммы до 12 цифр (типичный поток);
+ *   - `near`  — сумма равна лимиту или отличается на ±1 в младшем слове
+ *               (совпадают все старшие цифры — худший случай, полный разбор);
+ *   - `long`  — лимит и сумма случайной длины 1..BIGNUM_CAPACITY слов.
+ *
+ *   Строки (операция = одно сравнение):
+ *   - `hex/parse/D`, `dec/parse/D`   — разбор строки в `bignum_t` и
+ *                                      `bignum_cmp` (базовая линия);
+ *   - `hex/direct/D`, `dec/direct/D` — `bignum_cmp_hexstr` / `bignum_cmp_decstr`.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_str [--n=200000] [--seed=S] [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_str REPORT_NAME=baseline
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_str.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+__extension__ typedef unsigned __int128 u128;
+
+#define STR_MAX  (BIGNUM_CAPACITY * 20 + 2)
+#define POW10_19 10000000000000000000ull
+
+typedef enum { DIST_SMALL = 0, DIST_NEAR, DIST_LONG, DIST_COUNT } str_dist_t;
+
+static const char *const dist_names[DIST_COUNT] = { "small", "near", "long" };
+
+/* ---- Базовая линия: полный разбор ---- */
+
+static int mul_add(bignum_t *x, uint64_t m, uint64_t add)
+{
+    uint64_t carry = add;
+    for (size_t i = 0; i < x->len; ++i) {
+        u128 t = (u128)x->words[i] * m + carry;
+        x->words[i] = (uint64_t)t;
+        carry       = (uint64_t)(t >> 64);
+    }
+    if (carry != 0) {
+        if (x->len == BIGNUM_CAPACITY) {
+            return 0;
+        }
+        x->words[x->len++] = carry;
+    }
+    return 1;
+}
+
+static int parse_dec(const char *s, size_t n, bignum_t *x)
+{
+    x->len = 0;
+    for (size_t i = 0; i < n;) {
+        size_t   k = (n - i) % 19 ? (n - i) % 19 : 19;
+        uint64_t v = 0, m = 1;
+        for (size_t j = 0; j < k; ++j, ++i) {
+            if ((unsigned)s[i] - '0' > 9) {
+                return 0;
+            }
+            v  = v * 10 + (uint64_t)(s[i] - '0');
+            m *= 10;
+        }
+        if (x->len == 0) {
+            if (v != 0) {
+                x->words[0] = v;
+                x->len      = 1;
+            }
+        } else if (!mul_add(x, m, v)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int parse_hex(const char *s, size_t n, bignum_t *x)
+{
+    size_t words = (n + 15) / 16;
+    if (words > BIGNUM_CAPACITY) {
+        return 0;
+    }
+    for (size_t w = 0; w < words; ++w) {
+        size_t   end = n - 16 * w, beg = end > 16 ? end - 16 : 0;
+        uint64_t v   = 0;
+        for (size_t i = beg; i < end; ++i) {
+            unsigned c = (unsigned char)s[i], d = c - '0', l = (c | 0x20u) - 'a';
+            if (d > 9 && l > 5) {
+                return 0;
+            }
+            v = v << 4 | (d <= 9 ? d : l + 10);
+        }
+        x->words[w] = v;
+    }
+    x->len = words;
+    while (x->len > 0 && x->words[x->len - 1] == 0) {
+        x->len--;
+    }
+    return 1;
+}
+
+/* ---- Печать ---- */
+
+static size_t to_hex(const bignum_t *x, char *out)
+{
+    if (x->len == 0) {
+        out[0] = '0';
+        return 1;
+    }
+    size_t n = (size_t)sprintf(out, "%llx", (unsigned long long)x->words[x->len - 1]);
+    for (size_t i = x->len - 1; i > 0; --i) {
+        n += (size_t)sprintf(out + n, "%016llx", (unsigned long long)x->words[i - 1]);
+    }
+    return n;
+}
+
+static size_t to_dec(const bignum_t *x, char *out)
+{
+    uint64_t chunks[BIGNUM_CAPACITY * 2];
+    size_t   nc = 0;
+    bignum_t q  = *x;
+    while (q.len > 0) {
+        uint64_t r = 0;
+        for (size_t i = q.len; i > 0; --i) {
+            u128 cur = (u128)r << 64 | q.words[i - 1];
+            q.words[i - 1] = (uint64_t)(cur / POW10_19);
+            r              = (uint64_t)(cur % POW10_19);
+        }
+        while (q.len > 0 && q.words[q.len - 1] == 0) {
+            q.len--;
+        }
+        chunks[nc++] = r;
+    }
+    if (nc == 0) {
+        out[0] = '0';
+        return 1;
+    }
+    size_t n = (size_t)sprintf(out, "%llu", (unsigned long long)chunks[nc - 1]);
+    for (size_t i = nc - 1; i > 0; --i) {
+        n += (size_t)sprintf(out + n, "%019llu", (unsigned long long)chunks[i - 1]);
+    }
+    return n;
+}
+
+static void fill(bignum_t *lim, bignum_t *amt, size_t n, str_dist_t dist, uint64_t *rng)
+{
+    for (size_t i = 0; i < n; ++i) {
+        switch (dist) {
+        case DIST_SMALL: {
+            size_t len = 2 + (size_t)(bench_rng_next(rng) % 3);
+            bench_random_bignum(&lim[i], len < BIGNUM_CAPACITY ? len : BIGNUM_CAPACITY, rng);
+            memset(&amt[i], 0, sizeof(amt[i]));
+            amt[i].words[0] = bench_rng_next(rng) % 1000000000000ull;
+            amt[i].len      = amt[i].words[0] != 0;
+            break;
+        }
+        case DIST_NEAR:
+            bench_random_bignum(&lim[i], (size_t)(bench_rng_next(rng) % BIGNUM_CAPACITY) + 1, rng);
+            amt[i] = lim[i];
+            if (amt[i].words[0] != 0 && amt[i].words[0] != UINT64_MAX) {
+                amt[i].words[0] += (uint64_t)(bench_rng_next(rng) % 3) - 1;
+            }
+            break;
+        default:
+            bench_random_bignum(&lim[i], (size_t)(bench_rng_next(rng) % BIGNUM_CAPACITY) + 1, rng);
+            bench_random_bignum(&amt[i], (size_t)(bench_rng_next(rng) % BIGNUM_CAPACITY) + 1, rng);
+            break;
+        }
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [--n=200000] [--seed=S] [--format=text|csv|json] [--out=FILE]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    size_t n = 200000;
+    uint64_t seed = 0;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)      { n = (size_t)strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--seed=", 7) == 0)   { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0) { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)    { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *lim  = malloc(sizeof(bignum_t) * n);
+    bignum_t *amt  = malloc(sizeof(bignum_t) * n);
+    size_t   *hoff = malloc(sizeof(size_t) * (n + 1));
+    size_t   *doff = malloc(sizeof(size_t) * (n + 1));
+    char     *hbuf = malloc(STR_MAX * n);
+    char     *dbuf = malloc(STR_MAX * n);
+    if (lim == NULL || amt == NULL || hoff == NULL || doff == NULL || hbuf == NULL || dbuf == NULL) {
+        perror("Failed to allocate memory for test data");
+        free(lim); free(amt); free(hoff); free(doff); free(hbuf); free(dbuf);
+        return 1;
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(lim); free(amt); free(hoff); free(doff); free(hbuf); free(dbuf);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    int first = 1;
+    long sink_parse = 0, sink_direct = 0;
+    for (int d = 0; d < DIST_COUNT; ++d) {
+        uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+        fill(lim, amt, n, (str_dist_t)d, &rng);
+        hoff[0] = doff[0] = 0;
+        for (size_t i = 0; i < n; ++i) {
+            hoff[i + 1] = hoff[i] + to_hex(&amt[i], hbuf + hoff[i]);
+            doff[i + 1] = doff[i] + to_dec(&amt[i], dbuf + doff[i]);
+        }
+
+        bignum_t x;
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < n; ++i) {
+            if (parse_hex(hbuf + hoff[i], hoff[i + 1] - hoff[i], &x)) {
+                sink_parse += bignum_cmp(&lim[i], &x);
+            }
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "hex/parse/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+        first = 0;
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < n; ++i) {
+            sink_direct += bignum_cmp_hexstr(&lim[i], hbuf + hoff[i], hoff[i + 1] - hoff[i]);
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "hex/direct/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < n; ++i) {
+            if (parse_dec(dbuf + doff[i], doff[i + 1] - doff[i], &x)) {
+                sink_parse += bignum_cmp(&lim[i], &x);
+            }
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "dec/parse/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+
+        bench_region_begin(&hw, &reg);
+        for (size_t i = 0; i < n; ++i) {
+            sink_direct += bignum_cmp_decstr(&lim[i], dbuf + doff[i], doff[i + 1] - doff[i]);
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "dec/direct/%s", dist_names[d]);
+        bench_report_row(fp, fmt, first, label, &reg, n);
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    if (sink_parse != sink_direct) {
+        fprintf(stderr, "result mismatch: parse and direct compares differ\n");
+    }
+    free(lim); free(amt); free(hoff); free(doff); free(hbuf); free(dbuf);
+    return sink_parse != sink_direct;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file    bench_bignum_cmp_topk.c
+ * @brief   Бенчмарк top-k: полная сортировка qsort против nth_element, partial_sort и кучи.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Массив из N ключей (длины — смесь `skewed`, см. bench_inputs.h); `--dups`
+ *   процентов элементов заменяются одним из 16 «горячих» значений, чтобы
+ *   получить длинные серии равных ключей. Строки (вызов = один элемент входа):
+ *   - `qsort`        — `qsort` + `bignum_cmp` всего массива (базовая линия);
+ *   - `partial_sort` — `bignum_partial_sort` для k наименьших;
+ *   - `nth_element`  — `bignum_nth_element` на позиции `n - k`;
+ *   - `topk`         — потоковая куча `bignum_topk` (k наибольших);
+ *   - `topk_mt/tN`   — `bignum_topk_mt` на N потоках (`--threads`).
+ *
+ *   Сортирующие строки портят порядок входа, поэтому каждая получает свежую
+ *   копию; время копирования в замер не входит.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_topk [--n=N] [--k=K] [--dups=PCT] [--threads=1,2,4,8] [--seed=S]
+ *                             [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_topk REPORT_NAME=baseline BENCH_ARGS="--n=10000000 --k=1000"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_topk.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N    1000000ull
+#define DEFAULT_K    1000ull
+#define DEFAULT_DUPS 30
+#define MAX_SWEEP    16
+
+static volatile size_t g_sink;
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--k=K] [--dups=PCT] [--threads=1,2,4,8] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, k = DEFAULT_K, seed = 0;
+    unsigned dups = DEFAULT_DUPS;
+    unsigned threads[MAX_SWEEP] = { 1, 2, 4, 8 };
+    size_t nthreads = 4;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n    = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--k=", 4) == 0)       { k    = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--dups=", 7) == 0)    { dups = (unsigned)strtoul(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--threads=", 10) == 0) {
+            nthreads = 0;
+            for (const char *p = arg + 10; *p != '\0' && nthreads < MAX_SWEEP; ) {
+                char *end;
+                threads[nthreads++] = (unsigned)strtoul(p, &end, 10);
+                p = (*end == ',') ? end + 1 : end;
+                if (end == p && *end != '\0') { usage(argv[0]); return 1; }
+            }
+        }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n == 0 || k == 0 || k > n || dups > 100) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *input = malloc(sizeof(bignum_t) * n);
+    bignum_t *work  = malloc(sizeof(bignum_t) * n);
+    bignum_t *out   = malloc(sizeof(bignum_t) * k);
+    if (!input || !work || !out) {
+        perror("Failed to allocate memory for test data");
+        free(input); free(work); free(out);
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    bignum_t hot[16];
+    for (size_t i = 0; i < 16; ++i) {
+        bench_random_bignum(&hot[i], bench_skewed_len(&rng), &rng);
+    }
+    for (uint64_t i = 0; i < n; ++i) {
+        if (bench_rng_next(&rng) % 100 < dups) {
+            input[i] = hot[bench_rng_next(&rng) % 16];
+        } else {
+            bench_random_bignum(&input[i], bench_skewed_len(&rng), &rng);
+        }
+    }
+
+    FILE *fp = stdout;
+    if (path != NULL && (fp = fopen(path, "w")) == NULL) {
+        perror(path);
+        free(input); free(work); free(out);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(fp, fmt);
+
+    char label[64];
+    bench_region_t reg;
+    size_t count = 0;
+
+    memcpy(work, input, sizeof(bignum_t) * n);
+    bench_region_begin(&hw, &reg);
+    qsort(work, n, sizeof(bignum_t), cmp_qsort);
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "qsort/n=%llu", (unsigned long long)n);
+    bench_report_row(fp, fmt, 1, label, &reg, n);
+    bignum_t kth_largest = work[n - k];   /* эталон для проверки остальных строк */
+
+    memcpy(work, input, sizeof(bignum_t) * n);
+    bench_region_begin(&hw, &reg);
+    bignum_partial_sort(work, n, (size_t)k);
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "partial_sort/k=%llu", (unsigned long long)k);
+    bench_report_row(fp, fmt, 0, label, &reg, n);
+    g_sink += work[k - 1].len;
+
+    memcpy(work, input, sizeof(bignum_t) * n);
+    bench_region_begin(&hw, &reg);
+    bignum_nth_element(work, n, (size_t)(n - k));
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "nth_element/k=%llu", (unsigned long long)k);
+    bench_report_row(fp, fmt, 0, label, &reg, n);
+    if (bignum_cmp(&work[n - k], &kth_largest) != 0) {
+        fprintf(stderr, "nth_element: result mismatch against qsort\n");
+    }
+
+    bench_region_begin(&hw, &reg);
+    bignum_topk(input, n, (size_t)k, out, &count);
+    bench_region_end(&hw, &reg);
+    snprintf(label, sizeof(label), "topk/k=%llu", (unsigned long long)k);
+    bench_report_row(fp, fmt, 0, label, &reg, n);
+    if (count != k || bignum_cmp(&out[k - 1], &kth_largest) != 0) {
+        fprintf(stderr, "topk: result mismatch against qsort\n");
+    }
+
+    for (size_t t = 0; t < nthreads; ++t) {
+        bench_region_begin(&hw, &reg);
+        bignum_topk_mt(input, n, (size_t)k, threads[t], out, &count);
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "topk_mt/t%u/k=%llu", threads[t], (unsigned long long)k);
+        bench_report_row(fp, fmt, 0, label, &reg, n);
+        if (count != k || bignum_cmp(&out[k - 1], &kth_largest) != 0) {
+            fprintf(stderr, "topk_mt/t%u: result mismatch against qsort\n", threads[t]);
+        }
+    }
+
+    bench_report_end(fp, fmt);
+    bench_hw_close(&hw);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    free(input);
+    free(work);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,205 @@
+/**
+ * @file    bench_bignum_cmp_zonemap.c
+ * @brief   Бенчмарк диапазонного сканирования столбца: полный проход против зональной карты.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Столбец из N ключей (длины — смесь `skewed`, см. bench_inputs.h) в одной из
+ *   раскладок (`--layout`):
+ *   - `clustered` — отсортированные ключи, перемешанные внутри окон по
+ *     4 блока (типично для данных, дописываемых по времени);
+ *   - `random`    — полностью случайный порядок (худший случай для карты).
+ *
+ *   Предикаты `lo <= x <= hi` строятся по квантилям столбца:
+ *   - `selective`     — 0.1% строк;
+ *   - `non_selective` — 50% строк.
+ *
+ *   Для каждого предиката печатаются строки `scan` (bignum_cmp на каждой
+ *   строке) и `zonemap` (`bignum_zonemap_select`); вызовы считаются в строках
+ *   столбца, т.е. ns/call — стоимость на строку. В stderr — доля строк,
+ *   которые карте пришлось сравнивать.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   bin/bench_bignum_cmp_zonemap [--n=N] [--block=ROWS] [--queries=Q]
+ *                                [--layout=clustered|random] [--seed=S]
+ *                                [--format=text|csv|json] [--out=FILE]
+ *
+ *   make bench_zonemap REPORT_NAME=baseline BENCH_ARGS="--layout=random"
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <bignum.h>
+#include "bignum_cmp.h"
+#include "bignum_cmp_zonemap.h"
+#include "bench_harness.h"
+#include "bench_inputs.h"
+
+#define DEFAULT_N       1000000ull
+#define DEFAULT_QUERIES 20
+
+static volatile size_t g_sink;
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static void shuffle(bignum_t *a, size_t n, uint64_t *rng)
+{
+    for (size_t i = n; i > 1; --i) {
+        size_t j = (size_t)(bench_rng_next(rng) % i);
+        bignum_t t = a[i - 1];
+        a[i - 1] = a[j];
+        a[j] = t;
+    }
+}
+
+static size_t scan_count(const bignum_t *col, size_t n, const bignum_t *lo, const bignum_t *hi)
+{
+    size_t c = 0;
+    for (size_t r = 0; r < n; ++r) {
+        c += (size_t)(bignum_cmp(&col[r], lo) >= 0 && bignum_cmp(&col[r], hi) <= 0);
+    }
+    return c;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [--n=N] [--block=ROWS] [--queries=Q] [--layout=clustered|random] [--seed=S]\n"
+            "          [--format=text|csv|json] [--out=FILE]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t n = DEFAULT_N, queries = DEFAULT_QUERIES, seed = 0, block = BIGNUM_ZONEMAP_DEFAULT_BLOCK;
+    int clustered = 1;
+    bench_fmt_t fmt = BENCH_FMT_TEXT;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if      (strncmp(arg, "--n=", 4) == 0)       { n       = strtoull(arg + 4, NULL, 10); }
+        else if (strncmp(arg, "--block=", 8) == 0)   { block   = strtoull(arg + 8, NULL, 10); }
+        else if (strncmp(arg, "--queries=", 10) == 0) { queries = strtoull(arg + 10, NULL, 10); }
+        else if (strcmp(arg, "--layout=clustered") == 0) { clustered = 1; }
+        else if (strcmp(arg, "--layout=random") == 0)    { clustered = 0; }
+        else if (strncmp(arg, "--seed=", 7) == 0)    { seed    = strtoull(arg + 7, NULL, 10); }
+        else if (strncmp(arg, "--format=", 9) == 0)  { if (!bench_parse_fmt(arg + 9, &fmt)) { usage(argv[0]); return 1; } }
+        else if (strncmp(arg, "--out=", 6) == 0)     { path = arg + 6; }
+        else { usage(argv[0]); return 1; }
+    }
+    if (n < 2000 || queries == 0 || block == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bignum_t *col    = malloc(sizeof(bignum_t) * n);
+    bignum_t *sorted = malloc(sizeof(bignum_t) * n);
+    if (!col || !sorted) {
+        perror("Failed to allocate memory for test data");
+        free(col); free(sorted);
+        return 1;
+    }
+    uint64_t rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+    for (uint64_t i = 0; i < n; ++i) {
+        bench_random_bignum(&sorted[i], bench_skewed_len(&rng), &rng);
+    }
+    qsort(sorted, n, sizeof(bignum_t), cmp_qsort);
+    memcpy(col, sorted, sizeof(bignum_t) * n);
+    if (clustered) {
+        size_t w = (size_t)block * 4;
+        for (size_t i = 0; i < n; i += w) {
+            shuffle(&col[i], (n - i < w) ? n - i : w, &rng);
+        }
+    } else {
+        shuffle(col, n, &rng);
+    }
+
+    bignum_zonemap_t zm;
+    if (bignum_zonemap_init(&zm, (size_t)block) != BIGNUM_ZONEMAP_OK ||
+        bignum_zonemap_append(&zm, col, n) != BIGNUM_ZONEMAP_OK) {
+        fprintf(stderr, "bignum_zonemap_append failed\n");
+        free(col); free(sorted);
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (path != NULL && (out = fopen(path, "w")) == NULL) {
+        perror(path);
+        bignum_zonemap_free(&zm);
+        free(col); free(sorted);
+        return 1;
+    }
+
+    bench_hw_t hw;
+    bench_hw_open(&hw);
+    bench_report_begin(out, fmt);
+
+    static const struct { const char *name; unsigned permille; } preds[] = {
+        { "selective", 1 }, { "non_selective", 500 }
+    };
+    const char *layout = clustered ? "clustered" : "random";
+    char label[80];
+    bench_region_t reg;
+
+    for (size_t p = 0; p < sizeof(preds) / sizeof(preds[0]); ++p) {
+        size_t width = (size_t)(n * preds[p].permille / 1000);
+        size_t *lo_at = malloc(sizeof(size_t) * queries);
+        if (lo_at == NULL) {
+            break;
+        }
+        for (uint64_t q = 0; q < queries; ++q) {
+            lo_at[q] = (size_t)(bench_rng_next(&rng) % (n - width));
+        }
+
+        size_t acc = 0, check = 0, scanned_total = 0;
+        bench_region_begin(&hw, &reg);
+        for (uint64_t q = 0; q < queries; ++q) {
+            acc += scan_count(col, n, &sorted[lo_at[q]], &sorted[lo_at[q] + width]);
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "scan/%s/%s", layout, preds[p].name);
+        bench_report_row(out, fmt, p == 0, label, &reg, queries * n);
+
+        bench_region_begin(&hw, &reg);
+        for (uint64_t q = 0; q < queries; ++q) {
+            size_t count = 0, scanned = 0;
+            bignum_zonemap_select(&zm, col, &sorted[lo_at[q]], &sorted[lo_at[q] + width],
+                                  NULL, &count, &scanned);
+            check += count;
+            scanned_total += scanned;
+        }
+        bench_region_end(&hw, &reg);
+        snprintf(label, sizeof(label), "zonemap/%s/%s", layout, preds[p].name);
+        bench_report_row(out, fmt, 0, label, &reg, queries * n);
+
+        if (check != acc) {
+            fprintf(stderr, "zonemap: result mismatch against full scan\n");
+        }
+        fprintf(stderr, "zonemap/%s/%s: compared %.2f%% of rows\n", layout, preds[p].name,
+                100.0 * (double)scanned_total / ((double)queries * (double)n));
+        g_sink += acc + check;
+        free(lo_at);
+    }
+
+    bench_report_end(out, fmt);
+    bench_hw_close(&hw);
+    if (out != stdout) {
+        fclose(out);
+    }
+    bignum_zonemap_free(&zm);
+    free(col);
+    free(sorted);
+    return 0;
+}
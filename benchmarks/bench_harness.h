@@ -0,0 +1,274 @@
+/**
+ * @file    bench_harness.h
+ * @brief   Внутрипроцессный харнесс аппаратных счётчиков для бенчмарков bignum_cmp.
+ * @author  git@bayborodov.com
+ * @version 1.1.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Заменяет обёртку `sudo sysctl` + `perf record` там, где нужны не
+ *   процентные отчёты по символам, а абсолютные числа на вызов:
+ *   циклы, инструкции, промахи предсказания ветвлений, промахи L1D и LLC.
+ *
+ *   Счётчики открываются через `perf_event_open` только для user-space
+ *   (`exclude_kernel`, `exclude_hv`), поэтому root не нужен при
+ *   `kernel.perf_event_paranoid <= 2`. Если счётчик недоступен (запрет,
+ *   виртуальная машина без PMU), он помечается как отсутствующий, а
+ *   измерение продолжается только по `rdtscp` и `CLOCK_MONOTONIC`.
+ *
+ *   Все функции `static inline`, поэтому бенчмарк может использовать только
+ *   часть харнесса. Перед включением должен быть определён `_GNU_SOURCE`.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *   - rev 1.1 (16.10.2026): Функции `static inline` для частичного использования (MT-бенчмарк).
+ *
+ * # Использование
+ *   bench_hw_t hw;
+ *   bench_hw_open(&hw);
+ *   bench_region_t r;
+ *   bench_region_begin(&hw, &r);
+ *   ... N вызовов ...
+ *   bench_region_end(&hw, &r);
+ *   bench_report_row(out, fmt, 1, "label", &r, N);
+ *   bench_hw_close(&hw);
+ */
+
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <x86intrin.h>
+
+/** Индексы отслеживаемых событий. */
+enum {
+    BENCH_EV_CYCLES = 0,
+    BENCH_EV_INSTRUCTIONS,
+    BENCH_EV_BRANCH_MISSES,
+    BENCH_EV_L1D_MISSES,
+    BENCH_EV_LLC_MISSES,
+    BENCH_EV_COUNT
+};
+
+static inline const char *bench_ev_name(int ev)
+{
+    static const char *const names[BENCH_EV_COUNT] = {
+        "cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses"
+    };
+    return names[ev];
+}
+
+/** Набор открытых счётчиков; `fd[i] < 0` — событие недоступно. */
+typedef struct {
+    int fd[BENCH_EV_COUNT];
+} bench_hw_t;
+
+/** Результат одного измеренного региона. */
+typedef struct {
+    uint64_t tsc;                    /**< Тики TSC (`rdtscp`). */
+    uint64_t ns;                     /**< Наносекунды (`CLOCK_MONOTONIC`). */
+    double   ev[BENCH_EV_COUNT];     /**< Значения счётчиков (с поправкой на мультиплексирование). */
+    int      ev_valid[BENCH_EV_COUNT];
+    /* Внутреннее состояние начала региона. */
+    uint64_t tsc0;
+    struct timespec t0;
+} bench_region_t;
+
+/** Формат вывода результатов. */
+typedef enum {
+    BENCH_FMT_TEXT = 0,
+    BENCH_FMT_CSV,
+    BENCH_FMT_JSON
+} bench_fmt_t;
+
+static inline int bench_perf_open(uint32_t type, uint64_t config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = type;
+    attr.config         = config;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;   /* без этого при paranoid=2 нужен root */
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/**
+ * @brief Открывает все счётчики, которые разрешены в текущем окружении.
+ * @return Количество успешно открытых счётчиков (0 — работаем только по TSC).
+ */
+static inline int bench_hw_open(bench_hw_t *hw)
+{
+    const uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D
+                                 | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                 | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    int opened = 0;
+
+    hw->fd[BENCH_EV_CYCLES]        = bench_perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    hw->fd[BENCH_EV_INSTRUCTIONS]  = bench_perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    hw->fd[BENCH_EV_BRANCH_MISSES] = bench_perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    hw->fd[BENCH_EV_L1D_MISSES]    = bench_perf_open(PERF_TYPE_HW_CACHE, l1d_read_miss);
+    hw->fd[BENCH_EV_LLC_MISSES]    = bench_perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+    for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+        if (hw->fd[i] >= 0) {
+            ++opened;
+        }
+    }
+    if (opened < BENCH_EV_COUNT) {
+        long paranoid = -100;
+        FILE *f = fopen("/proc/sys/kernel/perf_event_paranoid", "r");
+        if (f != NULL) {
+            if (fscanf(f, "%ld", &paranoid) != 1) paranoid = -100;
+            fclose(f);
+        }
+        fprintf(stderr, "bench: %d/%d hardware counters available (perf_event_paranoid=%ld); "
+                        "missing ones are reported as null\n", opened, BENCH_EV_COUNT, paranoid);
+    }
+    return opened;
+}
+
+static inline void bench_hw_close(bench_hw_t *hw)
+{
+    for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+        if (hw->fd[i] >= 0) {
+            close(hw->fd[i]);
+            hw->fd[i] = -1;
+        }
+    }
+}
+
+static inline uint64_t bench_rdtscp(void)
+{
+    unsigned aux;
+    uint64_t t = __rdtscp(&aux);
+    _mm_lfence();              /* не даём последующим инструкциям начаться раньше чтения TSC */
+    return t;
+}
+
+static inline uint64_t bench_ts_diff_ns(const struct timespec *a, const struct timespec *b)
+{
+    return (uint64_t)(b->tv_sec - a->tv_sec) * 1000000000ull
+         + (uint64_t)b->tv_nsec - (uint64_t)a->tv_nsec;
+}
+
+/** @brief Начинает измеряемый регион: сбрасывает и включает счётчики, фиксирует TSC и время. */
+static inline void bench_region_begin(const bench_hw_t *hw, bench_region_t *r)
+{
+    memset(r, 0, sizeof(*r));
+    for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+        if (hw->fd[i] >= 0) {
+            ioctl(hw->fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(hw->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &r->t0);
+    r->tsc0 = bench_rdtscp();
+}
+
+/** @brief Завершает регион и собирает значения счётчиков. */
+static inline void bench_region_end(const bench_hw_t *hw, bench_region_t *r)
+{
+    uint64_t tsc1 = bench_rdtscp();
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+        if (hw->fd[i] >= 0) {
+            ioctl(hw->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    r->tsc = tsc1 - r->tsc0;
+    r->ns  = bench_ts_diff_ns(&r->t0, &t1);
+
+    for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+        uint64_t v[3];   /* value, time_enabled, time_running */
+        if (hw->fd[i] < 0 || read(hw->fd[i], v, sizeof(v)) != (ssize_t)sizeof(v) || v[2] == 0) {
+            continue;
+        }
+        r->ev[i]       = (double)v[0] * ((double)v[1] / (double)v[2]);
+        r->ev_valid[i] = 1;
+    }
+}
+
+/** @brief Печатает заголовок таблицы (CSV) или открывающую скобку массива (JSON). */
+static inline void bench_report_begin(FILE *out, bench_fmt_t fmt)
+{
+    if (fmt == BENCH_FMT_CSV) {
+        fprintf(out, "label,calls,ns_per_call,tsc_per_call");
+        for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+            fprintf(out, ",%s_per_call", bench_ev_name(i));
+        }
+        fputc('\n', out);
+    } else if (fmt == BENCH_FMT_JSON) {
+        fputs("[\n", out);
+    } else {
+        fprintf(out, "%-40s %12s %10s %10s %10s %10s %10s %10s %10s\n", "label", "calls",
+                "ns/call", "tsc/call", "cyc/call", "ins/call", "brm/call", "l1dm/call", "llcm/call");
+    }
+}
+
+/**
+ * @brief Печатает одну строку результатов в пересчёте на вызов.
+ * @param first Для JSON: 1, если это первая запись (без ведущей запятой).
+ */
+static inline void bench_report_row(FILE *out, bench_fmt_t fmt, int first,
+                             const char *label, const bench_region_t *r, uint64_t calls)
+{
+    double c = (double)calls;
+
+    if (fmt == BENCH_FMT_CSV) {
+        fprintf(out, "%s,%llu,%.4f,%.4f", label, (unsigned long long)calls,
+                (double)r->ns / c, (double)r->tsc / c);
+        for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+            if (r->ev_valid[i]) fprintf(out, ",%.4f", r->ev[i] / c);
+            else                fputc(',', out);
+        }
+        fputc('\n', out);
+    } else if (fmt == BENCH_FMT_JSON) {
+        fprintf(out, "%s  {\"label\": \"%s\", \"calls\": %llu, \"ns_per_call\": %.4f, \"tsc_per_call\": %.4f",
+                first ? "" : ",\n", label, (unsigned long long)calls,
+                (double)r->ns / c, (double)r->tsc / c);
+        for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+            if (r->ev_valid[i]) fprintf(out, ", \"%s_per_call\": %.4f", bench_ev_name(i), r->ev[i] / c);
+            else                fprintf(out, ", \"%s_per_call\": null", bench_ev_name(i));
+        }
+        fputc('}', out);
+    } else {
+        fprintf(out, "%-40s %12llu %10.3f %10.3f", label, (unsigned long long)calls,
+                (double)r->ns / c, (double)r->tsc / c);
+        for (int i = 0; i < BENCH_EV_COUNT; ++i) {
+            if (r->ev_valid[i]) fprintf(out, " %10.3f", r->ev[i] / c);
+            else                fprintf(out, " %10s", "-");
+        }
+        fputc('\n', out);
+    }
+}
+
+/** @brief Закрывает массив JSON. */
+static inline void bench_report_end(FILE *out, bench_fmt_t fmt)
+{
+    if (fmt == BENCH_FMT_JSON) {
+        fputs("\n]\n", out);
+    }
+}
+
+/** @brief Разбирает имя формата: "text", "csv", "json". */
+static inline int bench_parse_fmt(const char *s, bench_fmt_t *fmt)
+{
+    if (strcmp(s, "text") == 0) { *fmt = BENCH_FMT_TEXT; return 1; }
+    if (strcmp(s, "csv") == 0)  { *fmt = BENCH_FMT_CSV;  return 1; }
+    if (strcmp(s, "json") == 0) { *fmt = BENCH_FMT_JSON; return 1; }
+    return 0;
+}
+
+#endif /* BENCH_HARNESS_H */
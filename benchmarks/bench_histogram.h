@@ -0,0 +1,107 @@
+/**
+ * @file    bench_histogram.h
+ * @brief   Лог-линейная гистограмма задержек в стиле HDR для бенчмарков.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Значения (тики TSC) раскладываются по корзинам с фиксированной
+ *   относительной точностью: до 64 — точные корзины, дальше на каждую
+ *   степень двойки приходится 32 корзины, т.е. погрешность не превышает
+ *   1/32 (~3%). Весь диапазон uint64_t покрывается 1920 счётчиками
+ *   (15 КБ), запись — это `lzcnt`, сдвиг и инкремент, без ветвлений по
+ *   диапазону. Гистограммы разных потоков складываются поэлементно.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ */
+
+#ifndef BENCH_HISTOGRAM_H
+#define BENCH_HISTOGRAM_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define BENCH_HIST_SUB_BITS 6
+#define BENCH_HIST_SUB      (1u << BENCH_HIST_SUB_BITS)       /* 64 */
+#define BENCH_HIST_HALF     (BENCH_HIST_SUB >> 1)              /* 32 */
+#define BENCH_HIST_BUCKETS  (BENCH_HIST_SUB + (64 - BENCH_HIST_SUB_BITS) * BENCH_HIST_HALF)
+
+/** Гистограмма; выравнивание по кэш-линии исключает false sharing между потоками. */
+typedef struct {
+    _Alignas(64) uint64_t counts[BENCH_HIST_BUCKETS];
+    uint64_t total;
+    uint64_t max;
+} bench_hist_t;
+
+static inline void bench_hist_reset(bench_hist_t *h)
+{
+    memset(h, 0, sizeof(*h));
+}
+
+static inline unsigned bench_hist_index(uint64_t v)
+{
+    if (v < BENCH_HIST_SUB) {
+        return (unsigned)v;
+    }
+    unsigned msb   = 63u - (unsigned)__builtin_clzll(v);
+    unsigned shift = msb - (BENCH_HIST_SUB_BITS - 1);
+    return BENCH_HIST_SUB + (shift - 1) * BENCH_HIST_HALF
+         + (unsigned)(v >> shift) - BENCH_HIST_HALF;
+}
+
+/** Верхняя граница значений, попадающих в корзину `idx`. */
+static inline uint64_t bench_hist_value(unsigned idx)
+{
+    if (idx < BENCH_HIST_SUB) {
+        return idx;
+    }
+    unsigned k     = idx - BENCH_HIST_SUB;
+    unsigned shift = k / BENCH_HIST_HALF + 1;
+    uint64_t m     = (uint64_t)(k % BENCH_HIST_HALF) + BENCH_HIST_HALF;
+    return (m << shift) + ((1ull << shift) - 1);
+}
+
+static inline void bench_hist_record(bench_hist_t *h, uint64_t v)
+{
+    h->counts[bench_hist_index(v)]++;
+    h->total++;
+    if (v > h->max) {
+        h->max = v;
+    }
+}
+
+static inline void bench_hist_merge(bench_hist_t *dst, const bench_hist_t *src)
+{
+    for (unsigned i = 0; i < BENCH_HIST_BUCKETS; ++i) {
+        dst->counts[i] += src->counts[i];
+    }
+    dst->total += src->total;
+    if (src->max > dst->max) {
+        dst->max = src->max;
+    }
+}
+
+/** Значение перцентиля `q` (0..100); для пустой гистограммы — 0. */
+static inline uint64_t bench_hist_percentile(const bench_hist_t *h, double q)
+{
+    if (h->total == 0) {
+        return 0;
+    }
+    uint64_t rank = (uint64_t)((q / 100.0) * (double)h->total + 0.5);
+    if (rank == 0) {
+        rank = 1;
+    }
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < BENCH_HIST_BUCKETS; ++i) {
+        seen += h->counts[i];
+        if (seen >= rank) {
+            uint64_t v = bench_hist_value(i);
+            return (v < h->max) ? v : h->max;
+        }
+    }
+    return h->max;
+}
+
+#endif /* BENCH_HISTOGRAM_H */
@@ -0,0 +1,164 @@
+/**
+ * @file    bench_inputs.h
+ * @brief   Генераторы входных распределений для бенчмарков bignum_cmp.
+ * @author  git@bayborodov.com
+ * @version 1.2.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Равномерно случайный `len` в 1..BIGNUM_CAPACITY почти всегда завершает
+ *   сравнение на `.diff_len`. Генераторы ниже позволяют управлять тем,
+ *   какой путь ядра измеряется:
+ *   - `random`   — прежнее поведение (случайные `len`);
+ *   - `same_len` — равные `len`, первое различие на заданной глубине от старшего слова;
+ *   - `equal`    — полностью равные операнды (полный проход цикла);
+ *   - `skewed`   — реалистичная смесь: короткие числа преобладают, длины
+ *                  тяготеют к 1..4 и 4/8/16/32 слов, половина пар имеет равный
+ *                  `len` со случайной глубиной первого различия.
+ *
+ *   Все функции `static inline`, генератор — xorshift64* с явным seed, чтобы
+ *   данные не зависели от `rand()` и были воспроизводимы между прогонами.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *   - rev 1.1 (16.10.2026): Добавлено распределение `skewed`.
+ *   - rev 1.2 (16.10.2026): Функции `static inline`, `bench_dist_name()` вместо массива имён.
+ */
+
+#ifndef BENCH_INPUTS_H
+#define BENCH_INPUTS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <bignum.h>
+
+/** Тип входного распределения. */
+typedef enum {
+    BENCH_DIST_RANDOM = 0,
+    BENCH_DIST_SAME_LEN,
+    BENCH_DIST_EQUAL,
+    BENCH_DIST_SKEWED
+} bench_dist_t;
+
+/** Параметры распределения. */
+typedef struct {
+    bench_dist_t dist;
+    size_t       len;    /**< Длина операндов для `same_len`/`equal` (1..BIGNUM_CAPACITY). */
+    size_t       depth;  /**< Глубина первого различия от старшего слова (0 — само старшее). */
+    uint64_t     seed;
+} bench_input_cfg_t;
+
+static inline uint64_t bench_rng_next(uint64_t *s)
+{
+    uint64_t x = *s;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *s = x;
+    return x * 0x2545F4914F6CDD1Dull;
+}
+
+/** Случайное нормализованное число длины `len`. */
+static inline void bench_random_bignum(bignum_t *x, size_t len, uint64_t *rng)
+{
+    memset(x, 0, sizeof(*x));
+    for (size_t i = 0; i < len; ++i) {
+        x->words[i] = bench_rng_next(rng);
+    }
+    if (len > 0 && x->words[len - 1] == 0) {
+        x->words[len - 1] = 1;
+    }
+    x->len = len;
+}
+
+/** Длина из смеси `skewed`: 60% — 1..4 слова, 30% — 4/8/16/32, 10% — равномерно. */
+static inline size_t bench_skewed_len(uint64_t *rng)
+{
+    static const size_t common[] = { 4, 8, 16, 32 };
+    uint64_t r = bench_rng_next(rng);
+    size_t len;
+    switch (r % 10) {
+    case 0: case 1: case 2: case 3: case 4: case 5:
+        len = (size_t)((r >> 8) % 4) + 1;
+        break;
+    case 6: case 7: case 8:
+        len = common[(r >> 8) % 4];
+        break;
+    default:
+        len = (size_t)((r >> 8) % BIGNUM_CAPACITY) + 1;
+        break;
+    }
+    return (len <= BIGNUM_CAPACITY) ? len : BIGNUM_CAPACITY;
+}
+
+/**
+ * @brief Заполняет `n` пар операндов согласно распределению.
+ * @details Для `same_len` пары отличаются ровно в слове `len - 1 - depth`,
+ *          знак различия случайный; слова старше него совпадают.
+ */
+static inline void bench_fill_pairs(bignum_t *a, bignum_t *b, size_t n, const bench_input_cfg_t *cfg)
+{
+    uint64_t rng = cfg->seed ? cfg->seed : 0x9E3779B97F4A7C15ull;
+    size_t len   = (cfg->len >= 1 && cfg->len <= BIGNUM_CAPACITY) ? cfg->len : BIGNUM_CAPACITY;
+    size_t depth = (cfg->depth < len) ? cfg->depth : len - 1;
+
+    for (size_t i = 0; i < n; ++i) {
+        switch (cfg->dist) {
+        case BENCH_DIST_SAME_LEN: {
+            bench_random_bignum(&a[i], len, &rng);
+            b[i] = a[i];
+            size_t k = len - 1 - depth;
+            uint64_t delta = (bench_rng_next(&rng) >> 1) | 1;
+            b[i].words[k] = (bench_rng_next(&rng) & 1) ? a[i].words[k] + delta : a[i].words[k] - delta;
+            if (b[i].words[len - 1] == 0) {
+                b[i].words[len - 1] = 1;
+            }
+            break;
+        }
+        case BENCH_DIST_EQUAL:
+            bench_random_bignum(&a[i], len, &rng);
+            b[i] = a[i];
+            break;
+        case BENCH_DIST_SKEWED: {
+            size_t la = bench_skewed_len(&rng);
+            bench_random_bignum(&a[i], la, &rng);
+            if (bench_rng_next(&rng) & 1) {
+                b[i] = a[i];
+                size_t k = (size_t)(bench_rng_next(&rng) % la);
+                b[i].words[k] ^= (bench_rng_next(&rng) | 1);
+                if (b[i].words[la - 1] == 0) {
+                    b[i].words[la - 1] = 1;
+                }
+            } else {
+                bench_random_bignum(&b[i], bench_skewed_len(&rng), &rng);
+            }
+            break;
+        }
+        case BENCH_DIST_RANDOM:
+        default:
+            bench_random_bignum(&a[i], (size_t)(bench_rng_next(&rng) % BIGNUM_CAPACITY) + 1, &rng);
+            bench_random_bignum(&b[i], (size_t)(bench_rng_next(&rng) % BIGNUM_CAPACITY) + 1, &rng);
+            break;
+        }
+    }
+}
+
+/** Имя распределения (для меток в отчётах). */
+static inline const char *bench_dist_name(bench_dist_t dist)
+{
+    static const char *const names[] = { "random", "same_len", "equal", "skewed" };
+    return ((unsigned)dist < sizeof(names) / sizeof(names[0])) ? names[dist] : "unknown";
+}
+
+/** @brief Разбирает имя распределения: "random", "same_len", "equal", "skewed". */
+static inline int bench_parse_dist(const char *s, bench_dist_t *dist)
+{
+    if (strcmp(s, "random") == 0)   { *dist = BENCH_DIST_RANDOM;   return 1; }
+    if (strcmp(s, "same_len") == 0) { *dist = BENCH_DIST_SAME_LEN; return 1; }
+    if (strcmp(s, "equal") == 0)    { *dist = BENCH_DIST_EQUAL;    return 1; }
+    if (strcmp(s, "skewed") == 0)   { *dist = BENCH_DIST_SKEWED;   return 1; }
+    return 0;
+}
+
+#endif /* BENCH_INPUTS_H */
@@ -0,0 +1,241 @@
+/**
+ * @file    bignum_cmp.hpp
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief C++20-обёртка над bignum_cmp: `operator<=>`, концепты и прозрачные компараторы.
+ *
+ * @details
+ *   Заголовок header-only и не требует отдельной сборки. Он заменяет
+ *   рукописные лямбды вида `[](auto& a, auto& b) { return bignum_cmp(&a, &b) < 0; }`
+ *   в `std::sort`/`std::map`:
+ *   - `bignum::basic_bignum<Capacity>` — невладеющее представление числа
+ *     (указатель на хранилище), копируется как указатель;
+ *   - `operator<=>` возвращает `std::strong_ordering`, сравнения с `uint64_t`
+ *     не требуют построения временного числа;
+ *   - `bignum::less`, `bignum::greater`, `bignum::equal_to` — прозрачные
+ *     (`is_transparent`) компараторы для гетерогенного поиска, например
+ *     `std::map<bignum_t, V, bignum::less>::find(42u)`;
+ *   - `bignum::compare()` — `constexpr`: при вычислении на этапе компиляции
+ *     используется переносимый цикл по словам, во время выполнения для
+ *     `Capacity == BIGNUM_CAPACITY` вызывается ассемблерное ядро `bignum_cmp`.
+ *
+ *   Хранилищем для `Capacity == BIGNUM_CAPACITY` служит сам `bignum_t`;
+ *   для других ёмкостей — `bignum::basic_bignum_storage<Capacity>` с той же
+ *   раскладкой (`words`, затем `len`). Ядро собрано под одну ёмкость, поэтому
+ *   для остальных сравнение всегда идёт по переносимому пути.
+ *
+ *   Представление не бывает пустым, поэтому `BIGNUM_CMP_ERROR_NULL` из ядра
+ *   здесь недостижим и в `std::strong_ordering` не отображается.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ *
+ * # Использование
+ *   std::vector<bignum_t> v = ...;
+ *   std::sort(v.begin(), v.end(), bignum::less{});
+ *
+ *   std::map<bignum_t, int, bignum::less> m;
+ *   auto it = m.find(42u);                         // без временного bignum_t
+ *
+ *   static constexpr bignum_t k = {{0, 1}, 2};     // 2^64
+ *   static_assert(bignum::bignum_view{k} > UINT64_MAX);
+ *
+ * @see     bignum_cmp.h
+ */
+
+#ifndef BIGNUM_CMP_HPP
+#define BIGNUM_CMP_HPP
+
+#if __cplusplus < 202002L
+#  error "bignum_cmp.hpp requires C++20"
+#endif
+
+#include "bignum_cmp.h"
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace bignum {
+
+/** @brief Хранилище числа ёмкостью `Capacity` слов с раскладкой `bignum_t`. */
+template <std::size_t Capacity>
+struct basic_bignum_storage {
+    std::uint64_t words[Capacity];
+    std::size_t   len;
+};
+
+/** @brief Тип, устроенный как `bignum_t`: массив слов `words` и длина `len`. */
+template <class T>
+concept bignum_layout = requires(const T &t) {
+    { t.words[0] } -> std::convertible_to<std::uint64_t>;
+    { t.len } -> std::convertible_to<std::size_t>;
+};
+
+template <std::size_t Capacity>
+class basic_bignum;
+
+namespace detail {
+
+/** Переносимое сравнение: длина, затем слова от старшего к младшему. */
+constexpr std::strong_ordering compare_words(const std::uint64_t *a, std::size_t alen,
+                                             const std::uint64_t *b, std::size_t blen) noexcept
+{
+    if (alen != blen) {
+        return alen <=> blen;
+    }
+    for (std::size_t i = alen; i-- > 0;) {
+        if (a[i] != b[i]) {
+            return a[i] <=> b[i];
+        }
+    }
+    return std::strong_ordering::equal;
+}
+
+/** Сравнение с `uint64_t`: нормализованный ноль имеет `len == 0`. */
+constexpr std::strong_ordering compare_u64(const std::uint64_t *a, std::size_t alen,
+                                           std::uint64_t v) noexcept
+{
+    if (alen > 1) {
+        return std::strong_ordering::greater;
+    }
+    return ((alen == 1) ? a[0] : 0) <=> v;
+}
+
+} // namespace detail
+
+/**
+ * @brief Невладеющее представление большого числа ёмкостью `Capacity` слов.
+ * @details Конструируется неявно из `bignum_t` (или `basic_bignum_storage`),
+ *          поэтому функции и компараторы принимают `bignum_t` напрямую.
+ *          Хранилище должно пережить представление.
+ */
+template <std::size_t Capacity>
+class basic_bignum {
+public:
+    using storage_type = std::conditional_t<Capacity == BIGNUM_CAPACITY,
+                                            bignum_t, basic_bignum_storage<Capacity>>;
+
+    static constexpr std::size_t capacity = Capacity;
+
+    constexpr basic_bignum(const storage_type &s) noexcept : p_(&s) {}
+
+    constexpr const storage_type &storage() const noexcept { return *p_; }
+    constexpr const std::uint64_t *words() const noexcept { return p_->words; }
+    constexpr std::size_t size() const noexcept { return p_->len; }
+    constexpr std::uint64_t operator[](std::size_t i) const noexcept { return p_->words[i]; }
+
+    friend constexpr std::strong_ordering operator<=>(basic_bignum a, basic_bignum b) noexcept
+    {
+        return compare(a, b);
+    }
+    friend constexpr bool operator==(basic_bignum a, basic_bignum b) noexcept
+    {
+        return (a <=> b) == 0;
+    }
+
+    friend constexpr std::strong_ordering operator<=>(basic_bignum a, std::uint64_t v) noexcept
+    {
+        return detail::compare_u64(a.words(), a.size(), v);
+    }
+    friend constexpr bool operator==(basic_bignum a, std::uint64_t v) noexcept
+    {
+        return (a <=> v) == 0;
+    }
+
+private:
+    const storage_type *p_;
+};
+
+/** Представление `bignum_t` ёмкости, с которой собрана библиотека. */
+using bignum_view = basic_bignum<BIGNUM_CAPACITY>;
+
+static_assert(bignum_layout<bignum_t>);
+static_assert(std::is_trivially_copyable_v<bignum_view>);
+
+/**
+ * @brief Трёхстороннее сравнение двух чисел.
+ * @details Во время константного вычисления — переносимый цикл; во время
+ *          выполнения при `Capacity == BIGNUM_CAPACITY` — ассемблерное ядро.
+ */
+template <std::size_t Capacity>
+constexpr std::strong_ordering compare(basic_bignum<Capacity> a, basic_bignum<Capacity> b) noexcept
+{
+    if constexpr (Capacity == BIGNUM_CAPACITY) {
+        if (!std::is_constant_evaluated()) {
+            return static_cast<int>(::bignum_cmp(&a.storage(), &b.storage())) <=> 0;
+        }
+    }
+    return detail::compare_words(a.words(), a.size(), b.words(), b.size());
+}
+
+/** @brief Операнд прозрачного компаратора: число ёмкости `Capacity` или беззнаковое целое. */
+template <class T, std::size_t Capacity>
+concept bignum_operand = std::unsigned_integral<T>
+                      || std::convertible_to<const T &, basic_bignum<Capacity>>;
+
+namespace detail {
+
+template <std::size_t Capacity, class A, class B>
+constexpr std::strong_ordering order(const A &a, const B &b) noexcept
+{
+    if constexpr (std::unsigned_integral<A> && std::unsigned_integral<B>) {
+        return static_cast<std::uint64_t>(a) <=> static_cast<std::uint64_t>(b);
+    } else if constexpr (std::unsigned_integral<B>) {
+        return basic_bignum<Capacity>(a) <=> static_cast<std::uint64_t>(b);
+    } else if constexpr (std::unsigned_integral<A>) {
+        return 0 <=> (basic_bignum<Capacity>(b) <=> static_cast<std::uint64_t>(a));
+    } else {
+        return compare(basic_bignum<Capacity>(a), basic_bignum<Capacity>(b));
+    }
+}
+
+} // namespace detail
+
+/** @brief Прозрачный `a < b` для `bignum_t`, представлений и `uint64_t`. */
+template <std::size_t Capacity = BIGNUM_CAPACITY>
+struct basic_less {
+    using is_transparent = void;
+
+    template <bignum_operand<Capacity> A, bignum_operand<Capacity> B>
+    constexpr bool operator()(const A &a, const B &b) const noexcept
+    {
+        return detail::order<Capacity>(a, b) < 0;
+    }
+};
+
+/** @brief Прозрачный `a > b` (например, для убывающей сортировки). */
+template <std::size_t Capacity = BIGNUM_CAPACITY>
+struct basic_greater {
+    using is_transparent = void;
+
+    template <bignum_operand<Capacity> A, bignum_operand<Capacity> B>
+    constexpr bool operator()(const A &a, const B &b) const noexcept
+    {
+        return detail::order<Capacity>(a, b) > 0;
+    }
+};
+
+/** @brief Прозрачный `a == b`. */
+template <std::size_t Capacity = BIGNUM_CAPACITY>
+struct basic_equal_to {
+    using is_transparent = void;
+
+    template <bignum_operand<Capacity> A, bignum_operand<Capacity> B>
+    constexpr bool operator()(const A &a, const B &b) const noexcept
+    {
+        return detail::order<Capacity>(a, b) == 0;
+    }
+};
+
+using less     = basic_less<>;
+using greater  = basic_greater<>;
+using equal_to = basic_equal_to<>;
+
+} // namespace bignum
+
+#endif /* BIGNUM_CMP_HPP */
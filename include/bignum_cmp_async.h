@@ -0,0 +1,172 @@
+/**
+ * @file    bignum_cmp_async.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Асинхронная очередь заданий (submission/completion) для пакетных
+ *        операций над массивами `bignum_t`.
+ *
+ * @details Цикл событий не может ждать миллисекунды, пока идут сортировка,
+ *          поиск или сравнение больших массивов. Очередь устроена по образцу
+ *          io_uring, но внутри процесса:
+ *
+ *          - вызывающий кладёт задание (`bignum_async_sqe_t`) в очередь
+ *            отправки и сразу возвращается; задания выполняют рабочие потоки
+ *            очереди;
+ *          - результат (`bignum_async_cqe_t`) попадает в кольцо завершений, а
+ *            `eventfd` (поле `fd`) становится читаемым, пока кольцо не пусто, —
+ *            его можно добавить в `epoll`/`poll` цикла событий и забирать
+ *            завершения `bignum_async_reap` без блокировки;
+ *          - обратное давление: заданий в работе (в очереди, выполняется или
+ *            ждёт `reap`) не больше `entries`; сверх этого `submit` возвращает
+ *            `BIGNUM_ASYNC_BUSY` и ничего не ставит, поэтому кольцо завершений
+ *            не переполняется;
+ *          - отмена по `user_data`: ещё не начатое задание снимается сразу, у
+ *            выполняемого сравнения или поиска выставляется флаг, который
+ *            проверяется между кусками по `BIGNUM_ASYNC_CHUNK` элементов.
+ *            Начатая сортировка не прерывается.
+ *
+ *          Буферы задания принадлежат вызывающему и должны жить до его
+ *          завершения. Все функции, кроме `init`/`free`, потокобезопасны.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_pool.h, bignum_cmp_search.h, bignum_cmp_topk.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_ASYNC_H
+#define BIGNUM_CMP_ASYNC_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Сколько элементов обрабатывается между проверками флага отмены. */
+#define BIGNUM_ASYNC_CHUNK 4096
+
+/**
+ * @brief Коды состояния функций модуля async (и поле `status` завершения).
+ */
+typedef enum {
+    BIGNUM_ASYNC_OK              =  0,      /**< Успех; для `cancel` — задание снято до начала. */
+    BIGNUM_ASYNC_BUSY            =  1,      /**< В работе уже `entries` заданий; задание не принято. */
+    BIGNUM_ASYNC_CANCELED        =  2,      /**< Завершение: задание отменено, результат неполный. */
+    BIGNUM_ASYNC_RUNNING         =  3,      /**< `cancel`: задание уже выполняется, отмена запрошена;
+                                                 итог — в его завершении. */
+    BIGNUM_ASYNC_NOT_FOUND       =  4,      /**< `cancel`: задания с таким `user_data` нет. */
+    BIGNUM_ASYNC_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_ASYNC_ERROR_THREAD    = -2,      /**< Не удалось создать рабочие потоки. */
+    BIGNUM_ASYNC_ERROR_SYS       = -3,      /**< Не удалось создать `eventfd`. */
+    BIGNUM_ASYNC_ERROR_RANGE     = -4,      /**< Неизвестная операция, `entries == 0` или
+                                                 `len > BIGNUM_CAPACITY` при сортировке. */
+    BIGNUM_ASYNC_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_async_status_t;
+
+/** Операция задания. */
+typedef enum {
+    BIGNUM_ASYNC_OP_CMP = 0,     /**< `cmp_out[i] = bignum_cmp(&a[i], &b[i])`, `i < n`. */
+    BIGNUM_ASYNC_OP_SORT,        /**< Сортировка `data[0 … n-1]` по возрастанию на месте. */
+    BIGNUM_ASYNC_OP_LOWER_BOUND, /**< `bignum_lower_bound_batch(a, n, b, m, pos_out)`. */
+    BIGNUM_ASYNC_OP_UPPER_BOUND  /**< `bignum_upper_bound_batch(a, n, b, m, pos_out)`. */
+} bignum_async_op_t;
+
+/** Задание (копируется при отправке). */
+typedef struct {
+    bignum_async_op_t op;
+    uint64_t          user_data; /**< Возвращается в завершении; ключ для `cancel`. */
+    const bignum_t   *a;         /**< CMP: левые операнды; BOUND: ключи по неубыванию. */
+    const bignum_t   *b;         /**< CMP: правые операнды; BOUND: запросы. */
+    bignum_t         *data;      /**< SORT: сортируемый массив. */
+    size_t            n;         /**< CMP: пар; SORT: элементов; BOUND: ключей. */
+    size_t            m;         /**< BOUND: запросов. */
+    int              *cmp_out;   /**< CMP: `n` результатов. */
+    size_t           *pos_out;   /**< BOUND: `m` позиций. */
+} bignum_async_sqe_t;
+
+/** Завершение. */
+typedef struct {
+    uint64_t user_data;          /**< Из задания. */
+    int      status;             /**< `BIGNUM_ASYNC_OK`, `BIGNUM_ASYNC_CANCELED` или код ошибки. */
+} bignum_async_cqe_t;
+
+/** Кольца и рабочие потоки (внутреннее представление). */
+struct bignum_async_ring;
+
+/**
+ * @brief Очередь. Поля внутренние; `fd`, `entries` и `threads` — только чтение.
+ */
+typedef struct {
+    struct bignum_async_ring *ring;
+    int                       fd;      /**< `eventfd`: читаем, пока есть несобранные завершения. */
+    size_t                    entries; /**< Предел заданий в работе. */
+    unsigned                  threads; /**< Рабочих потоков. */
+} bignum_async_t;
+
+/**
+ * @brief Создаёт очередь и запускает рабочие потоки.
+ *
+ * @param[out] q       Очередь.
+ * @param[in]  entries Предел заданий в работе (`> 0`).
+ * @param[in]  threads Рабочих потоков; `0` — число ядер минус одно (не меньше 1),
+ *                     чтобы одно ядро оставалось циклу событий.
+ */
+bignum_async_status_t bignum_async_init(bignum_async_t *q, size_t entries, unsigned threads);
+
+/**
+ * @brief Останавливает очередь: неначатые задания снимаются без завершений,
+ *        выполняемым выставляется флаг отмены, потоки дожидаются.
+ *        Затем закрывает `fd` и освобождает память (`q` может быть `NULL`).
+ */
+void bignum_async_free(bignum_async_t *q);
+
+/**
+ * @brief Ставит задание в очередь.
+ * @return `BIGNUM_ASYNC_OK`, `BIGNUM_ASYNC_BUSY`, `BIGNUM_ASYNC_ERROR_RANGE`
+ *         (неизвестная операция) или `BIGNUM_ASYNC_ERROR_NULL` (`q`, `sqe` или
+ *         нужный операции буфер равен `NULL` при ненулевом размере).
+ */
+bignum_async_status_t bignum_async_submit(bignum_async_t *q, const bignum_async_sqe_t *sqe);
+
+/**
+ * @brief Ставит до `n` заданий под одной блокировкой, по порядку.
+ * @param[out] submitted Сколько принято (может быть `NULL`).
+ * @return `BIGNUM_ASYNC_OK`, если приняты все; иначе код первого непринятого
+ *         (`BIGNUM_ASYNC_BUSY` или ошибка проверки), остальные не ставятся.
+ */
+bignum_async_status_t bignum_async_submit_batch(bignum_async_t *q, const bignum_async_sqe_t *sqes,
+                                                size_t n, size_t *submitted);
+
+/**
+ * @brief Отменяет задания с данным `user_data`.
+ * @return `BIGNUM_ASYNC_OK` — снято до начала (завершение `BIGNUM_ASYNC_CANCELED`
+ *         уже в кольце), `BIGNUM_ASYNC_RUNNING`, `BIGNUM_ASYNC_NOT_FOUND` или
+ *         `BIGNUM_ASYNC_ERROR_NULL`.
+ */
+bignum_async_status_t bignum_async_cancel(bignum_async_t *q, uint64_t user_data);
+
+/**
+ * @brief Забирает до `max` завершений без ожидания; когда кольцо опустело,
+ *        сбрасывает `eventfd`.
+ * @return Число забранных завершений.
+ */
+size_t bignum_async_reap(bignum_async_t *q, bignum_async_cqe_t *out, size_t max);
+
+/**
+ * @brief Как `bignum_async_reap`, но ждёт хотя бы одного завершения (`poll` на `fd`).
+ * @return Число забранных завершений; `0` — заданий в работе нет.
+ */
+size_t bignum_async_wait(bignum_async_t *q, bignum_async_cqe_t *out, size_t max);
+
+/** @brief Заданий в работе (в очереди, выполняются или ждут `reap`). */
+size_t bignum_async_pending(const bignum_async_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_ASYNC_H */
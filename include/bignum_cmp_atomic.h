@@ -0,0 +1,105 @@
+/**
+ * @file    bignum_cmp_atomic.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Атомарные «обновить, если больше/меньше» (fetch-max/fetch-min) для
+ *        общего значения `bignum_t` — отметки максимума или минимума.
+ *
+ * @details Типичный код отметки максимума под блокировкой —
+ *          `lock; if (bignum_cmp(&cand, &max) > 0) max = cand; unlock` —
+ *          сериализует все потоки, хотя почти все кандидаты проигрывают и
+ *          ничего не меняют. Здесь:
+ *
+ *          - текущее значение — неизменяемая версия, опубликованная через
+ *            атомарный указатель; кандидат сравнивается с ней без блокировок;
+ *          - проигравший кандидат (не лучше текущего) возвращает
+ *            `BIGNUM_ATOMIC_UNCHANGED`, не записывая ничего в общие данные
+ *            (только в свою ячейку эпох, см. ниже);
+ *          - выигравший копирует себя в новую версию и ставит её CAS-ом; если
+ *            CAS не удался, сравнение повторяется с новой текущей версией,
+ *            которая может уже его побить;
+ *          - вытесненные версии освобождаются по эпохам (epoch-based
+ *            reclamation): поток на время операции занимает ячейку и
+ *            объявляет в ней глобальную эпоху; версия, снятая в эпоху `e`,
+ *            освобождается, когда глобальная эпоха дошла до `e + 2`, — к этому
+ *            моменту её не может читать ни одна операция.
+ *
+ *          Ячеек эпох не меньше `2 * число ядер` (и не меньше 64); если все
+ *          заняты, операция ждёт свободную. Все функции, кроме `init`/`free`,
+ *          потокобезопасны; `fetch_max` и `fetch_min` можно смешивать на одном
+ *          объекте.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_shared.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_ATOMIC_H
+#define BIGNUM_CMP_ATOMIC_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния функций модуля atomic.
+ */
+typedef enum {
+    BIGNUM_ATOMIC_OK              =  0,      /**< Успех; для fetch — кандидат установлен. */
+    BIGNUM_ATOMIC_UNCHANGED       =  1,      /**< Кандидат не лучше текущего; ничего не изменено. */
+    BIGNUM_ATOMIC_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_ATOMIC_ERROR_RANGE     = -2,      /**< `len > BIGNUM_CAPACITY`. */
+    BIGNUM_ATOMIC_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_atomic_status_t;
+
+/** Внутреннее состояние (текущая версия, эпохи, ячейки). */
+struct bignum_atomic_state;
+
+/**
+ * @brief Атомарное значение. Поля внутренние; `nslots` — только чтение.
+ */
+typedef struct {
+    struct bignum_atomic_state *state;   /**< Текущая версия и домен эпох. */
+    size_t                      nslots;  /**< Количество ячеек эпох. */
+} bignum_atomic_t;
+
+/**
+ * @brief Инициализирует `a` значением `x` (`NULL` — нулём).
+ * @return `BIGNUM_ATOMIC_OK`, `BIGNUM_ATOMIC_ERROR_NOMEM`, `BIGNUM_ATOMIC_ERROR_RANGE`
+ *         или `BIGNUM_ATOMIC_ERROR_NULL`.
+ */
+bignum_atomic_status_t bignum_atomic_init(bignum_atomic_t *a, const bignum_t *x);
+
+/** @brief Освобождает все версии (`a` может быть `NULL`); потоки уже не должны его использовать. */
+void bignum_atomic_free(bignum_atomic_t *a);
+
+/** @brief Копирует текущее значение в `out`. */
+bignum_atomic_status_t bignum_atomic_load(const bignum_atomic_t *a, bignum_t *out);
+
+/**
+ * @brief Устанавливает `cand`, если он больше текущего значения (`bignum_cmp`).
+ *
+ * @param[in]  a    Атомарное значение.
+ * @param[in]  cand Кандидат.
+ * @param[out] prev Значение, которое было до операции (может быть `NULL`): при
+ *                  `BIGNUM_ATOMIC_OK` — вытесненное, при `BIGNUM_ATOMIC_UNCHANGED` —
+ *                  то, которое `cand` не превзошёл.
+ *
+ * @return `BIGNUM_ATOMIC_OK`, `BIGNUM_ATOMIC_UNCHANGED` или код ошибки.
+ */
+bignum_atomic_status_t bignum_atomic_fetch_max(bignum_atomic_t *a, const bignum_t *cand, bignum_t *prev);
+
+/** @brief Как `bignum_atomic_fetch_max`, но устанавливает `cand`, если он меньше текущего. */
+bignum_atomic_status_t bignum_atomic_fetch_min(bignum_atomic_t *a, const bignum_t *cand, bignum_t *prev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_ATOMIC_H */
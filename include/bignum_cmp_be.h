@@ -0,0 +1,92 @@
+/**
+ * @file    bignum_cmp_be.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Сравнение `bignum_t` с беззнаковым big-endian числом прямо в буфере
+ *        (содержимое DER INTEGER, величины RLP, сетевой порядок байт).
+ *
+ * @details Декодеры протоколов получают числа старшим байтом вперёд и, чтобы
+ *          проверить их против границ, переводят в `bignum_t` — копия и проход
+ *          `bswap` на каждое поле. Здесь сравнение идёт по исходному буферу:
+ *
+ *          1. ведущие нулевые байты отбрасываются (по 16 за шаг на SSE2), так
+ *             что DER-байт `0x00` перед старшим битом и любые иные ведущие
+ *             нули не мешают;
+ *          2. число значащих байт сравнивается с байтовой длиной `a`;
+ *          3. при равенстве байты сравниваются от старших: по 32/16 байт с
+ *             разворотом `pshufb` (AVX2/SSSE3) до первого различия, иначе по
+ *             слову через `__builtin_bswap64` (`movbe` при `-mmovbe`).
+ *
+ *          Пустой буфер (`n == 0`) — число 0 (так кодируется нуль в RLP).
+ *          Буфер шире `BIGNUM_CAPACITY` слов допустим и больше любого `a`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp.h, bignum_cmp_ordkey.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_BE_H
+#define BIGNUM_CMP_BE_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния модуля be.
+ * @details `bignum_cmp_be_bytes` возвращает `int`: код `bignum_cmp_status_t`
+ *          (`1`, `0`, `-1`) либо код ошибки ниже; коды ошибок не пересекаются
+ *          с результатами сравнения.
+ */
+typedef enum {
+    BIGNUM_BE_OK          = 0,            /**< Успех (пакетная функция). */
+    BIGNUM_BE_ERROR_RANGE = INT_MIN + 3,  /**< `len > BIGNUM_CAPACITY`, неверные `offsets` или `na`. */
+    BIGNUM_BE_ERROR_NULL  = INT_MIN       /**< Один из обязательных указателей равен `NULL`. */
+} bignum_be_status_t;
+
+/**
+ * @brief Сравнивает `a` с беззнаковым big-endian числом из `n` байт.
+ *
+ * @param[in] a Левый операнд.
+ * @param[in] p Байты числа, старший первым (может быть `NULL` при `n == 0`).
+ * @param[in] n Количество байт.
+ *
+ * @return Как `bignum_cmp(a, x)`, где `x` — значение байт;
+ *         `BIGNUM_BE_ERROR_RANGE` или `BIGNUM_BE_ERROR_NULL`.
+ */
+int bignum_cmp_be_bytes(const bignum_t *a, const uint8_t *p, size_t n);
+
+/**
+ * @brief Пакетно сравнивает границы с полями одного буфера.
+ *
+ * @details Поле `i` занимает байты `[offsets[i], offsets[i+1])` буфера `buf`
+ *          (та же раскладка, что у `bignum_to_ordkey_batch`). При `na == 1`
+ *          единственная граница один раз переводится в big-endian, и каждое
+ *          поле сравнивается с ней через `memcmp` после отбрасывания ведущих
+ *          нулей; при `na == n` поле `i` сравнивается с `a[i]`.
+ *
+ * @param[in]  a       Границы (`na` элементов).
+ * @param[in]  na      `1` или `n`.
+ * @param[in]  buf     Буфер с полями.
+ * @param[in]  offsets `n + 1` неубывающих смещений.
+ * @param[in]  n       Количество полей.
+ * @param[out] out     `out[i] = bignum_cmp(a[i или 0], поле i)` (`1`, `0`, `-1`).
+ *
+ * @return `BIGNUM_BE_OK`; `BIGNUM_BE_ERROR_RANGE` (`out` не определён);
+ *         `BIGNUM_BE_ERROR_NULL`. При `n == 0` ничего не проверяется.
+ */
+bignum_be_status_t bignum_cmp_be_bytes_batch(const bignum_t *a, size_t na,
+                                             const uint8_t *buf, const size_t *offsets, size_t n,
+                                             int8_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_BE_H */
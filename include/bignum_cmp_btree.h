@@ -0,0 +1,165 @@
+/**
+ * @file    bignum_cmp_btree.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Статический B+-индекс по отсортированному массиву `bignum_t`.
+ *
+ * @details Поиск в обобщённом B-дереве вызывает `bignum_cmp` для каждого
+ *          разделителя, а каждый ключ `bignum_t` занимает 264 байта, т.е.
+ *          визит узла затрагивает десятки кэш-линий. Индекс строится один раз
+ *          (bulk load) над отсортированным массивом вызывающей стороны и хранит
+ *          только префиксы ключей:
+ *
+ *          - префикс ключа — пара (`len`, `words[len-1]`); порядок префиксов
+ *            согласован с `bignum_cmp`: если префиксы различаются, то ключи
+ *            упорядочены так же;
+ *          - внутренний узел — `BIGNUM_BTREE_FANOUT` разделителей в виде SoA
+ *            (`top[]`, `len[]`), 3 кэш-линии; поиск в узле — сравнение всех
+ *            разделителей сразу (SSE2/AVX2) и `popcount` маски;
+ *          - лист — диапазон из `BIGNUM_BTREE_LEAF` позиций исходного массива
+ *            и их префиксы в отдельных SoA-массивах; сами ключи не копируются;
+ *          - только при совпадении префиксов (одинаковые `len` и старшее
+ *            слово) выполняется полный `bignum_cmp` с исходным ключом.
+ *
+ *          Все поиски возвращают позиции в исходном массиве, поэтому
+ *          диапазонный запрос — это пара позиций, а обход — обычный цикл.
+ *          Массив ключей должен жить и не меняться, пока жив индекс.
+ *
+ *          Когда индекс не помещается в кэш, каждый уровень поиска — промах,
+ *          зависящий от предыдущего. `bignum_btree_lower_bound_batch` и
+ *          `bignum_btree_upper_bound_batch` ведут 16 независимых поисков
+ *          вперемешку: после шага поиск запрашивает следующий узел prefetch'ем
+ *          и уступает очередь, так что в полёте до 16 промахов сразу.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *   - rev. 2 (16.10.2026): Пакетные `*_bound_batch`.
+ *
+ * @see     bignum_cmp.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_BTREE_H
+#define BIGNUM_CMP_BTREE_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Разделителей во внутреннем узле (детей — на один больше). */
+#define BIGNUM_BTREE_FANOUT 16
+/** Ключей в листе. */
+#define BIGNUM_BTREE_LEAF   16
+/** Максимальная высота внутренней части (17^12 листов заведомо достаточно). */
+#define BIGNUM_BTREE_MAX_LEVELS 12
+
+/**
+ * @brief Коды состояния функций модуля btree.
+ */
+typedef enum {
+    BIGNUM_BTREE_OK              =  0,      /**< Успех. */
+    BIGNUM_BTREE_ERROR_UNSORTED  = -1,      /**< Ключи не отсортированы по `bignum_cmp`. */
+    BIGNUM_BTREE_ERROR_NOMEM     = -2,      /**< Не удалось выделить память. */
+    BIGNUM_BTREE_ERROR_RANGE     = -3,      /**< `n` превышает `UINT32_MAX` или `len > BIGNUM_CAPACITY`. */
+    BIGNUM_BTREE_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_btree_status_t;
+
+/** Внутренний узел: префиксы разделителей в SoA-виде, 192 байта (3 кэш-линии). */
+typedef struct {
+    uint64_t top[BIGNUM_BTREE_FANOUT]; /**< Старшие слова разделителей. */
+    int16_t  len[BIGNUM_BTREE_FANOUT]; /**< Длины разделителей; `INT16_MAX` — пустой слот. */
+    uint8_t  pad[32];                  /**< Добивка до кратного 64 размера (узлы выровнены по 64). */
+} bignum_btree_node_t;
+
+/**
+ * @brief Индекс. Поля внутренние; создаётся `bignum_btree_build`.
+ */
+typedef struct {
+    const bignum_t       *keys;       /**< Исходный отсортированный массив. */
+    size_t                n;          /**< Количество ключей. */
+    uint64_t             *leaf_top;   /**< Старшие слова ключей (с добивкой до целого листа). */
+    int16_t              *leaf_len;   /**< Длины ключей (с добивкой). */
+    bignum_btree_node_t  *nodes;      /**< Внутренние узлы, уровни от корня к листьям. */
+    uint32_t             *sep_idx;    /**< Позиция ключа-разделителя (для полного сравнения). */
+    size_t                node_count; /**< Всего внутренних узлов. */
+    size_t                level_start[BIGNUM_BTREE_MAX_LEVELS];
+    unsigned              levels;     /**< Количество внутренних уровней (0 — только листья). */
+} bignum_btree_t;
+
+/**
+ * @brief Строит индекс над отсортированным массивом.
+ *
+ * @param[out] t    Индекс.
+ * @param[in]  keys Ключи, отсортированные по неубыванию `bignum_cmp` (дубликаты допустимы).
+ * @param[in]  n    Количество ключей (может быть `0`).
+ *
+ * @return `BIGNUM_BTREE_OK`; `BIGNUM_BTREE_ERROR_UNSORTED`, `BIGNUM_BTREE_ERROR_NOMEM`,
+ *         `BIGNUM_BTREE_ERROR_RANGE` или `BIGNUM_BTREE_ERROR_NULL`
+ *         (`keys == NULL` при `n > 0`). При ошибке `t` пуст.
+ */
+bignum_btree_status_t bignum_btree_build(bignum_btree_t *t, const bignum_t *keys, size_t n);
+
+/**
+ * @brief Освобождает память индекса (массив ключей не трогает).
+ * @param[in,out] t Индекс (может быть `NULL`).
+ */
+void bignum_btree_free(bignum_btree_t *t);
+
+/**
+ * @brief Первая позиция `i`, для которой `keys[i] >= x` (или `n`).
+ * @return `BIGNUM_BTREE_OK` или `BIGNUM_BTREE_ERROR_NULL`.
+ */
+bignum_btree_status_t bignum_btree_lower_bound(const bignum_btree_t *t, const bignum_t *x, size_t *pos);
+
+/**
+ * @brief Первая позиция `i`, для которой `keys[i] > x` (или `n`).
+ * @return `BIGNUM_BTREE_OK` или `BIGNUM_BTREE_ERROR_NULL`.
+ */
+bignum_btree_status_t bignum_btree_upper_bound(const bignum_btree_t *t, const bignum_t *x, size_t *pos);
+
+/**
+ * @brief Пакетный `bignum_btree_lower_bound`: `pos[i]` для каждого `xs[i]`, `i < m`.
+ * @details Запросы выполняются с чередованием (до 16 одновременно); результат
+ *          тот же, что у поштучных вызовов.
+ * @return `BIGNUM_BTREE_OK` или `BIGNUM_BTREE_ERROR_NULL` (`xs` или `pos` равен
+ *         `NULL` при `m > 0`).
+ */
+bignum_btree_status_t bignum_btree_lower_bound_batch(const bignum_btree_t *t, const bignum_t *xs, size_t m,
+                                                     size_t *pos);
+
+/** @brief Пакетный `bignum_btree_upper_bound` (см. `bignum_btree_lower_bound_batch`). */
+bignum_btree_status_t bignum_btree_upper_bound_batch(const bignum_btree_t *t, const bignum_t *xs, size_t m,
+                                                     size_t *pos);
+
+/**
+ * @brief Точный поиск.
+ * @param[out] pos Позиция первого ключа, равного `x` (может быть `NULL`).
+ * @return `1`, если ключ найден; `0`, если нет; `BIGNUM_BTREE_ERROR_NULL`.
+ */
+int bignum_btree_find(const bignum_btree_t *t, const bignum_t *x, size_t *pos);
+
+/**
+ * @brief Диапазонный запрос `lo <= keys[i] < hi`.
+ *
+ * @details Ключи диапазона — это `keys[*first] … keys[*last - 1]`; их обход
+ *          идёт последовательно по исходному массиву.
+ *
+ * @param[in]  lo    Нижняя граница (включительно); `NULL` — от начала.
+ * @param[in]  hi    Верхняя граница (исключительно); `NULL` — до конца.
+ * @param[out] first Начало диапазона.
+ * @param[out] last  Конец диапазона (`*last >= *first`).
+ *
+ * @return `BIGNUM_BTREE_OK` или `BIGNUM_BTREE_ERROR_NULL`.
+ */
+bignum_btree_status_t bignum_btree_range(const bignum_btree_t *t, const bignum_t *lo, const bignum_t *hi,
+                                         size_t *first, size_t *last);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_BTREE_H */
@@ -0,0 +1,81 @@
+/**
+ * @file    bignum_cmp_bucket.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Распределение массива `bignum_t` по корзинам, заданным
+ *        отсортированными разделителями (bucketize / searchsorted).
+ *
+ * @details Гистограммы и диапазонное разбиение относят каждое из миллионов
+ *          чисел к одной из `k + 1` корзин; двоичный поиск по разделителям
+ *          стоит `log2(k)` вызовов `bignum_cmp` и столько же обращений к
+ *          264-байтовым ключам на элемент. Здесь:
+ *
+ *          - над разделителями один раз строится `bignum_btree_t`: неявное
+ *            дерево из узлов по 16 префиксов (`len`, старшее слово) в
+ *            SoA-виде, узел проверяется одним SIMD-сравнением и `popcount`;
+ *            при `k < 16` это один лист, при `k < 272` — корень и лист;
+ *          - индекс целиком лежит в L1/L2, поэтому на элемент приходится одна
+ *            загрузка самого элемента (её скрывает prefetch) и 1–2 узла;
+ *            `bignum_cmp` вызывается лишь при совпадении префиксов;
+ *          - `bignum_bucketize_mt` делит элементы между потоками, индекс
+ *            общий (только чтение).
+ *
+ *          Номер корзины `x` — количество разделителей `<= x` (как
+ *          `searchsorted(..., side='right')`): корзина `j` — это
+ *          `splitters[j-1] <= x < splitters[j]`, корзины `0` и `k` открыты.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_btree.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_BUCKET_H
+#define BIGNUM_CMP_BUCKET_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния функций модуля bucket.
+ */
+typedef enum {
+    BIGNUM_BUCKET_OK              =  0,      /**< Успех. */
+    BIGNUM_BUCKET_ERROR_UNSORTED  = -1,      /**< Разделители не отсортированы по `bignum_cmp`. */
+    BIGNUM_BUCKET_ERROR_NOMEM     = -2,      /**< Не удалось выделить память. */
+    BIGNUM_BUCKET_ERROR_RANGE     = -3,      /**< `len > BIGNUM_CAPACITY` или `k >= UINT32_MAX`. */
+    BIGNUM_BUCKET_ERROR_THREAD    = -4,      /**< Не удалось запустить пул потоков. */
+    BIGNUM_BUCKET_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_bucket_status_t;
+
+/**
+ * @brief Для каждого `x[i]` записывает в `out[i]` номер корзины `0 … k`.
+ *
+ * @param[in]  splitters Разделители по неубыванию `bignum_cmp` (дубликаты допустимы;
+ *                       может быть `NULL` при `k == 0`).
+ * @param[in]  k         Количество разделителей.
+ * @param[in]  x         Значения.
+ * @param[in]  n         Количество значений.
+ * @param[out] out       Номера корзин (`n` элементов).
+ *
+ * @return `BIGNUM_BUCKET_OK` или код ошибки; при ошибке содержимое `out` не определено.
+ */
+bignum_bucket_status_t bignum_bucketize(const bignum_t *splitters, size_t k,
+                                        const bignum_t *x, size_t n, uint32_t *out);
+
+/** @brief Многопоточный `bignum_bucketize` (`threads == 0` — по размеру пула `bignum_cmp_pool.h`). */
+bignum_bucket_status_t bignum_bucketize_mt(const bignum_t *splitters, size_t k,
+                                           const bignum_t *x, size_t n, unsigned threads,
+                                           uint32_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_BUCKET_H */
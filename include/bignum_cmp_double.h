@@ -0,0 +1,84 @@
+/**
+ * @file    bignum_cmp_double.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Точное сравнение `bignum_t` с числом IEEE-754 `double`.
+ *
+ * @details Сравнение с порогами в `double` через строку и `strtod` медленно и
+ *          неточно (округление при переводе). Здесь `double` не округляется и
+ *          не переводится: для конечного `d >= 1` его битовая длина целой части
+ *          равна `E + 1` (`E` — несмещённый порядок), битовая длина `a` — это
+ *          `64·(len-1) + 64 - lzcnt(words[len-1])`. Различные длины решают
+ *          сразу; при равных сравниваются 53 старших бита `a` с мантиссой, и
+ *          только при их совпадении просматриваются младшие слова `a`.
+ *
+ *          - `-0.0` равен нулю, любое отрицательное `d` и `-inf` меньше `a`,
+ *            `+inf` больше;
+ *          - дробная часть `d` учитывается точно (`a = 1` больше `0.5` и меньше
+ *            `1.5`);
+ *          - `NaN` — ошибка.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_DOUBLE_H
+#define BIGNUM_CMP_DOUBLE_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния модуля double.
+ * @details `bignum_cmp_double` возвращает `int`: код `bignum_cmp_status_t`
+ *          (`1`, `0`, `-1`) либо код ошибки ниже; коды ошибок не пересекаются
+ *          с результатами сравнения.
+ */
+typedef enum {
+    BIGNUM_DBL_OK          = 0,            /**< Успех (пакетная функция). */
+    BIGNUM_DBL_ERROR_NAN   = INT_MIN + 2,  /**< `d` — NaN. */
+    BIGNUM_DBL_ERROR_RANGE = INT_MIN + 3,  /**< `len > BIGNUM_CAPACITY`. */
+    BIGNUM_DBL_ERROR_NULL  = INT_MIN       /**< Один из обязательных указателей равен `NULL`. */
+} bignum_dbl_status_t;
+
+/**
+ * @brief Точно сравнивает `a` с `d`.
+ *
+ * @param[in] a Левый операнд.
+ * @param[in] d Правый операнд.
+ *
+ * @return `1`, `0`, `-1` — как `a` относится к `d`; `BIGNUM_DBL_ERROR_NAN`,
+ *         `BIGNUM_DBL_ERROR_RANGE` или `BIGNUM_DBL_ERROR_NULL`.
+ */
+int bignum_cmp_double(const bignum_t *a, double d);
+
+/**
+ * @brief Пакетно сравнивает пары `a[i]` и `d[i]`.
+ *
+ * @details Порядки `d` извлекаются векторно (AVX2 — 4, SSE2 — 2 за шаг)
+ *          в массив битовых длин; пары с разной битовой длиной решаются без
+ *          повторного чтения `d`, остальные — как в `bignum_cmp_double`.
+ *
+ * @param[in]  a   Числа (`n` элементов).
+ * @param[in]  d   Пороги (`n` элементов).
+ * @param[in]  n   Количество пар.
+ * @param[out] out `out[i] = bignum_cmp_double(&a[i], d[i])` (`1`, `0`, `-1`).
+ *
+ * @return `BIGNUM_DBL_OK`; `BIGNUM_DBL_ERROR_NAN` или `BIGNUM_DBL_ERROR_RANGE`
+ *         для любого элемента (`out` не определён); `BIGNUM_DBL_ERROR_NULL`.
+ */
+bignum_dbl_status_t bignum_cmp_double_batch(const bignum_t *a, const double *d, size_t n, int8_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_DOUBLE_H */
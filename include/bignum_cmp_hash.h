@@ -0,0 +1,77 @@
+/**
+ * @file    bignum_cmp_hash.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Хеш `bignum_t`, согласованный с равенством `bignum_cmp`.
+ *
+ * @details Хеширование всего массива `words` (256 байт при ёмкости 32)
+ *          стоит столько же, сколько копирование ключа, хотя значащих
+ *          слов обычно единицы. `bignum_hash64` читает только `len` слов и
+ *          саму длину, поэтому равные по `bignum_cmp` числа (в т.ч. с
+ *          мусором за `len`) имеют равные хеши.
+ *
+ *          Слова обрабатываются двумя независимыми цепочками
+ *          «xor — умножение — сдвиг» (две цепочки зависимостей вместо одной),
+ *          результат проходит финализатор murmur3 `fmix64`. Это не
+ *          криптографический хеш: от подобранных злоумышленником ключей
+ *          защищает только случайный `seed`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание.
+ *
+ * @see     bignum_cmp.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_HASH_H
+#define BIGNUM_CMP_HASH_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Финализатор murmur3 (`fmix64`): лавинное перемешивание 64 бит. */
+static inline uint64_t bignum_hash_fmix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * @brief 64-битный хеш значащих слов числа.
+ * @param[in] x    Число (не `NULL`); `len > BIGNUM_CAPACITY` усекается до ёмкости.
+ * @param[in] seed Зерно хеша.
+ */
+static inline uint64_t bignum_hash64(const bignum_t *x, uint64_t seed)
+{
+    size_t   n = (x->len <= BIGNUM_CAPACITY) ? x->len : BIGNUM_CAPACITY;
+    uint64_t a = seed ^ ((uint64_t)x->len * 0x9E3779B97F4A7C15ull);
+    uint64_t b = ~seed;
+    size_t   i = 0;
+
+    for (; i + 2 <= n; i += 2) {
+        a = (a ^ x->words[i]) * 0x9E3779B97F4A7C15ull;
+        b = (b ^ x->words[i + 1]) * 0xC2B2AE3D27D4EB4Full;
+        a ^= a >> 29;
+        b ^= b >> 31;
+    }
+    if (i < n) {
+        a = (a ^ x->words[i]) * 0x9E3779B97F4A7C15ull;
+        a ^= a >> 29;
+    }
+    return bignum_hash_fmix64(a ^ ((b << 27) | (b >> 37)));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_HASH_H */
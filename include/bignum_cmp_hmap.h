@@ -0,0 +1,114 @@
+/**
+ * @file    bignum_cmp_hmap.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Хеш-таблица (map/set) с ключами `bignum_t` в стиле Swiss table.
+ *
+ * @details Открытая адресация с контрольными байтами:
+ *          - у каждого слота есть байт `ctrl`: `EMPTY`, `DELETED` или
+ *            7-битный отпечаток `h2` хеша ключа;
+ *          - поиск читает группу из 16 контрольных байт и одним сравнением
+ *            SSE2 (`pcmpeqb`/`pmovmskb`) получает маску кандидатов; к ключам
+ *            обращаются только кандидаты, у которых совпал и 64-битный хеш;
+ *          - группы перебираются треугольной последовательностью, поиск
+ *            останавливается на группе, в которой есть `EMPTY`.
+ *
+ *          Ключи, значения и хеши лежат в плотных массивах (`keys`, `values`,
+ *          `hashes`), а слоты хранят индекс записи. Поэтому таблица слотов
+ *          компактна, рост не копирует 264-байтовые ключи по слотам, а
+ *          индекс записи стабилен до её удаления и годится как id при
+ *          интернировании. Удаление переносит последнюю запись на место
+ *          удалённой.
+ *
+ *          Хеш — `bignum_hash64` (только `len` слов), равенство — сравнение
+ *          кэшированного хеша, `len` и `memcmp` значащих слов.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_hash.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_HMAP_H
+#define BIGNUM_CMP_HMAP_H
+
+#include "bignum_cmp.h"
+#include "bignum_cmp_hash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Слотов в группе (один SSE2-регистр контрольных байт). */
+#define BIGNUM_HMAP_GROUP 16
+
+/**
+ * @brief Коды состояния функций модуля hmap.
+ */
+typedef enum {
+    BIGNUM_HMAP_OK              =  0,      /**< Успех (ключ вставлен/удалён). */
+    BIGNUM_HMAP_EXISTS          =  1,      /**< Ключ уже есть; значение не изменено. */
+    BIGNUM_HMAP_NOT_FOUND       =  2,      /**< Ключа нет. */
+    BIGNUM_HMAP_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_HMAP_ERROR_RANGE     = -2,      /**< `len > BIGNUM_CAPACITY` или более `UINT32_MAX` записей. */
+    BIGNUM_HMAP_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_hmap_status_t;
+
+/**
+ * @brief Таблица. Поля `keys`, `values`, `size` можно читать напрямую:
+ *        записи `0 … size-1` — все элементы в произвольном порядке.
+ */
+typedef struct {
+    uint8_t  *ctrl;         /**< Контрольные байты слотов. */
+    uint32_t *slots;        /**< Индекс записи для занятых слотов. */
+    bignum_t *keys;         /**< Плотный массив ключей. */
+    uint64_t *values;       /**< Плотный массив значений (`NULL` для множества). */
+    uint64_t *hashes;       /**< Кэшированные хеши записей. */
+    size_t    capacity;     /**< Слотов (степень двойки, кратная группе). */
+    size_t    size;         /**< Записей. */
+    size_t    growth_left;  /**< Сколько вставок в пустые слоты до перестройки. */
+    uint64_t  seed;         /**< Зерно хеша. */
+} bignum_hmap_t;
+
+/**
+ * @brief Создаёт пустую таблицу.
+ * @param[out] m           Таблица.
+ * @param[in]  expected    Ожидаемое число элементов (таблица не перестраивается до него).
+ * @param[in]  with_values `0` — множество (`values == NULL`), иначе отображение в `uint64_t`.
+ * @return `BIGNUM_HMAP_OK`, `BIGNUM_HMAP_ERROR_NOMEM` или `BIGNUM_HMAP_ERROR_NULL`.
+ */
+bignum_hmap_status_t bignum_hmap_init(bignum_hmap_t *m, size_t expected, int with_values);
+
+/** @brief Освобождает память таблицы (`m` может быть `NULL`). */
+void bignum_hmap_free(bignum_hmap_t *m);
+
+/**
+ * @brief Вставляет ключ, если его ещё нет.
+ * @param[in]  key   Ключ (копируется).
+ * @param[in]  value Значение (для множества игнорируется).
+ * @param[out] index Индекс записи нового или существующего ключа (может быть `NULL`).
+ * @return `BIGNUM_HMAP_OK`, `BIGNUM_HMAP_EXISTS` или код ошибки.
+ */
+bignum_hmap_status_t bignum_hmap_insert(bignum_hmap_t *m, const bignum_t *key, uint64_t value, size_t *index);
+
+/**
+ * @brief Ищет ключ.
+ * @param[out] index Индекс записи (может быть `NULL`); значение — `m->values[*index]`.
+ * @return `1`, если найден; `0`, если нет; `BIGNUM_HMAP_ERROR_NULL`.
+ */
+int bignum_hmap_find(const bignum_hmap_t *m, const bignum_t *key, size_t *index);
+
+/**
+ * @brief Удаляет ключ. Последняя запись переезжает на индекс удалённой.
+ * @return `BIGNUM_HMAP_OK`, `BIGNUM_HMAP_NOT_FOUND` или `BIGNUM_HMAP_ERROR_NULL`.
+ */
+bignum_hmap_status_t bignum_hmap_erase(bignum_hmap_t *m, const bignum_t *key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_HMAP_H */
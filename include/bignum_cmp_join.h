@@ -0,0 +1,132 @@
+/**
+ * @file    bignum_cmp_join.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Merge-join и теоретико-множественные операции (пересечение,
+ *        объединение, разность) над отсортированными массивами `bignum_t`.
+ *
+ * @details Сверка двух больших отсортированных списков обычно пишется циклом
+ *          с вызовом `bignum_cmp` на каждом шаге и ветвлением `<`/`>`, которое
+ *          на перемешанных данных предсказывается плохо. Здесь:
+ *
+ *          - сравнение шага сначала идёт по префиксу (`len`, старшее слово)
+ *            прямо в цикле; `bignum_cmp` вызывается только при совпадении
+ *            префиксов;
+ *          - продвижение индексов и выбор выводимого элемента на шагах без
+ *            совпадения не ветвятся по результату сравнения (`i += c < 0`,
+ *            условная запись в выходной буфер);
+ *          - если один массив длиннее другого более чем в `BIGNUM_JOIN_GALLOP_RATIO`
+ *            раз, цикл идёт по короткому, а в длинном позиция ищется
+ *            экспоненциальным поиском (galloping) — O(m log(n/m)) сравнений
+ *            вместо O(n + m);
+ *          - варианты `*_mt` делят длинный массив на отрезки по границам групп
+ *            равных ключей, а короткий — двоичным поиском тех же границ; потоки
+ *            пишут в свои буферы, результат склеивается по порядку.
+ *
+ *          Входы должны быть отсортированы по неубыванию `bignum_cmp`
+ *          (проверка — `bignum_is_sorted`); иначе результат не определён.
+ *          Дубликаты обрабатываются как мультимножества, как в `std::set_*`:
+ *          группа из `p` равных ключей в `a` и `q` в `b` даёт в пересечении
+ *          `min(p, q)` элементов, в объединении `max(p, q)`, в разности
+ *          `max(p - q, 0)`, а в merge-join — все `p * q` пар.
+ *
+ *          Результат пишется в буфер вызывающего с ёмкостью `cap`; `*count`
+ *          всегда содержит полный размер результата, поэтому при `*count > cap`
+ *          можно повторить вызов с буфером нужного размера. Элементы с
+ *          `len > BIGNUM_CAPACITY`, встретившиеся при сравнениях, дают
+ *          `BIGNUM_JOIN_ERROR_RANGE`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_runs.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_JOIN_H
+#define BIGNUM_CMP_JOIN_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Во сколько раз один вход должен быть длиннее другого для galloping. */
+#define BIGNUM_JOIN_GALLOP_RATIO 16
+
+/**
+ * @brief Коды состояния функций модуля join.
+ */
+typedef enum {
+    BIGNUM_JOIN_OK              =  0,      /**< Успех. */
+    BIGNUM_JOIN_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_JOIN_ERROR_RANGE     = -2,      /**< `len > BIGNUM_CAPACITY` или неизвестная операция. */
+    BIGNUM_JOIN_ERROR_THREAD    = -3,      /**< Не удалось запустить пул потоков. */
+    BIGNUM_JOIN_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_join_status_t;
+
+/** Операция над мультимножествами. */
+typedef enum {
+    BIGNUM_SET_INTERSECTION = 0,   /**< `a ∩ b`, элементы берутся из `a`. */
+    BIGNUM_SET_UNION,              /**< `a ∪ b`, при равенстве сначала элементы `a`. */
+    BIGNUM_SET_DIFFERENCE          /**< `a \ b`. */
+} bignum_set_op_t;
+
+/** Пара совпавших позиций: `a[a] == b[b]`. */
+typedef struct {
+    size_t a;   /**< Позиция в первом массиве. */
+    size_t b;   /**< Позиция во втором массиве. */
+} bignum_join_pair_t;
+
+/**
+ * @brief Все пары `(i, j)` с `a[i] == b[j]`, по возрастанию `i`, затем `j`.
+ *
+ * @param[out] pairs Буфер пар (может быть `NULL` при `cap == 0`).
+ * @param[in]  cap   Ёмкость `pairs`.
+ * @param[out] count Полное число пар.
+ */
+bignum_join_status_t bignum_merge_join(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                       bignum_join_pair_t *pairs, size_t cap, size_t *count);
+
+/** @brief Многопоточный `bignum_merge_join` (`threads == 0` — по размеру пула `bignum_cmp_pool.h`). */
+bignum_join_status_t bignum_merge_join_mt(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                          unsigned threads, bignum_join_pair_t *pairs, size_t cap,
+                                          size_t *count);
+
+/**
+ * @brief Операция `op` над `a` и `b`; результат — указатели на элементы входов
+ *        в порядке `bignum_cmp`.
+ *
+ * @param[out] out   Буфер указателей (может быть `NULL` при `cap == 0`).
+ * @param[in]  cap   Ёмкость `out`.
+ * @param[out] count Полный размер результата.
+ */
+bignum_join_status_t bignum_set_op(bignum_set_op_t op, const bignum_t *a, size_t na,
+                                   const bignum_t *b, size_t nb,
+                                   const bignum_t **out, size_t cap, size_t *count);
+
+/** @brief Многопоточный `bignum_set_op`. */
+bignum_join_status_t bignum_set_op_mt(bignum_set_op_t op, const bignum_t *a, size_t na,
+                                      const bignum_t *b, size_t nb, unsigned threads,
+                                      const bignum_t **out, size_t cap, size_t *count);
+
+/** @brief `bignum_set_op(BIGNUM_SET_INTERSECTION, …)`. */
+bignum_join_status_t bignum_set_intersection(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                             const bignum_t **out, size_t cap, size_t *count);
+
+/** @brief `bignum_set_op(BIGNUM_SET_UNION, …)`. */
+bignum_join_status_t bignum_set_union(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                      const bignum_t **out, size_t cap, size_t *count);
+
+/** @brief `bignum_set_op(BIGNUM_SET_DIFFERENCE, …)`. */
+bignum_join_status_t bignum_set_difference(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                           const bignum_t **out, size_t cap, size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_JOIN_H */
@@ -0,0 +1,113 @@
+/**
+ * @file    bignum_cmp_mq.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Ослабленная конкурентная очередь с приоритетами (MultiQueue) для
+ *        значений `bignum_t`.
+ *
+ * @details Двоичная куча под одной блокировкой упирается в эту блокировку уже
+ *          при нескольких производителях: все потоки сериализуются на корне.
+ *          MultiQueue (Rihani, Sanders, Dementiev) заменяет её на `m` куч
+ *          (обычно `m = 2 * потоков`), у каждой своя спин-блокировка:
+ *
+ *          - вставка кладёт значение в случайную кучу; занятая куча
+ *            (`trylock` не удался) просто заменяется другой случайной;
+ *          - извлечение смотрит на префиксы корней двух случайных куч (они
+ *            публикуются атомарно и читаются без блокировок) и забирает корень
+ *            лучшей из двух;
+ *          - записи кучи — 16 байт: `len`, старшее слово и номер слота со
+ *            значением; просеивание сравнивает префиксы и обращается к самим
+ *            значениям (`bignum_cmp`) только при совпадении префиксов.
+ *
+ *          Порядок ослаблен: извлечённый элемент не обязательно лучший, но его
+ *          ожидаемый ранг (число лучших элементов, оставшихся в очереди) —
+ *          O(m) и не зависит от размера очереди. При `m = 1` очередь точная.
+ *
+ *          Ёмкость ограничена: каждая куча хранит до `ceil(capacity / m)`
+ *          значений; вставка возвращает `BIGNUM_MQ_FULL`, только если заполнены
+ *          все кучи. Все функции, кроме `init`/`free`, потокобезопасны.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_topk.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_MQ_H
+#define BIGNUM_CMP_MQ_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния функций модуля mq.
+ */
+typedef enum {
+    BIGNUM_MQ_OK              =  0,      /**< Успех. */
+    BIGNUM_MQ_EMPTY           =  1,      /**< Очередь пуста (извлекать нечего). */
+    BIGNUM_MQ_FULL            =  2,      /**< Все кучи заполнены; значение не вставлено. */
+    BIGNUM_MQ_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_MQ_ERROR_RANGE     = -2,      /**< `len > BIGNUM_CAPACITY`, нулевая ёмкость
+                                              или более `UINT32_MAX` значений в куче. */
+    BIGNUM_MQ_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_mq_status_t;
+
+/** Какой конец порядка `bignum_cmp` извлекается. */
+typedef enum {
+    BIGNUM_MQ_MIN = 0,   /**< Извлекаются наименьшие значения. */
+    BIGNUM_MQ_MAX        /**< Извлекаются наибольшие значения. */
+} bignum_mq_order_t;
+
+/** Куча с блокировкой (внутреннее представление). */
+struct bignum_mq_queue;
+
+/**
+ * @brief Очередь. Поля внутренние; `nqueues` и `queue_cap` — только чтение.
+ */
+typedef struct {
+    struct bignum_mq_queue *queues;    /**< `nqueues` куч, каждая на своих кэш-линиях. */
+    size_t                  nqueues;   /**< Количество куч `m`. */
+    size_t                  queue_cap; /**< Ёмкость одной кучи. */
+    bignum_mq_order_t       order;     /**< Извлекаемый конец порядка. */
+} bignum_mq_t;
+
+/**
+ * @brief Создаёт пустую очередь.
+ *
+ * @param[out] q        Очередь.
+ * @param[in]  nqueues  Количество куч; `0` — удвоенное число ядер.
+ * @param[in]  capacity Суммарная ёмкость (`> 0`).
+ * @param[in]  order    `BIGNUM_MQ_MIN` или `BIGNUM_MQ_MAX`.
+ */
+bignum_mq_status_t bignum_mq_init(bignum_mq_t *q, size_t nqueues, size_t capacity, bignum_mq_order_t order);
+
+/** @brief Освобождает память (`q` может быть `NULL`); потоки уже не должны её использовать. */
+void bignum_mq_free(bignum_mq_t *q);
+
+/**
+ * @brief Вставляет копию `x`.
+ * @return `BIGNUM_MQ_OK`, `BIGNUM_MQ_FULL`, `BIGNUM_MQ_ERROR_RANGE` или `BIGNUM_MQ_ERROR_NULL`.
+ */
+bignum_mq_status_t bignum_mq_push(bignum_mq_t *q, const bignum_t *x);
+
+/**
+ * @brief Извлекает значение, близкое к лучшему (см. описание файла), в `out`.
+ * @return `BIGNUM_MQ_OK`, `BIGNUM_MQ_EMPTY` (все кучи были пусты при проверке)
+ *         или `BIGNUM_MQ_ERROR_NULL`.
+ */
+bignum_mq_status_t bignum_mq_pop(bignum_mq_t *q, bignum_t *out);
+
+/** @brief Количество значений (при конкурентных изменениях — приблизительно). */
+size_t bignum_mq_size(const bignum_mq_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_MQ_H */
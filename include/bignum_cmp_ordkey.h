@@ -0,0 +1,121 @@
+/**
+ * @file    bignum_cmp_ordkey.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Байтовые ключи, сохраняющие порядок `bignum_cmp` при сравнении через `memcmp`.
+ *
+ * @details Хранилища, умеющие упорядочивать только строки байт (LSM-деревья,
+ *          префиксные деревья, внешняя сортировка), не могут использовать
+ *          `bignum_cmp` как компаратор. Модуль кодирует `bignum_t` в ключ
+ *          переменной длины:
+ *
+ *          | Смещение | Размер                        | Содержимое                          |
+ *          |----------|-------------------------------|-------------------------------------|
+ *          | 0        | `BIGNUM_ORDKEY_PREFIX_SIZE`   | `len` (big-endian)                  |
+ *          | prefix   | `len * 8`                     | `words[len-1] … words[0]` (big-endian) |
+ *
+ *          Ключи разной длины различаются уже в префиксе, поэтому
+ *          лексикографический порядок байт (сначала `memcmp` по общей длине,
+ *          затем более короткий ключ меньше) совпадает с порядком `bignum_cmp`,
+ *          включая ненормализованные значения.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_ORDKEY_H
+#define BIGNUM_CMP_ORDKEY_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Размер префикса длины в байтах (1 байт, пока `len` помещается в него). */
+#if BIGNUM_CAPACITY <= UINT8_MAX
+#  define BIGNUM_ORDKEY_PREFIX_SIZE 1
+#else
+#  define BIGNUM_ORDKEY_PREFIX_SIZE 2
+#endif
+
+/** Максимальный размер ключа в байтах. */
+#define BIGNUM_ORDKEY_MAX_SIZE (BIGNUM_ORDKEY_PREFIX_SIZE + BIGNUM_CAPACITY * 8)
+
+/**
+ * @brief Коды состояния функций модуля ordkey.
+ */
+typedef enum {
+    BIGNUM_ORDKEY_OK             =  0,      /**< Успех. */
+    BIGNUM_ORDKEY_ERROR_BUFFER   = -1,      /**< Выходной буфер слишком мал. */
+    BIGNUM_ORDKEY_ERROR_FORMAT   = -2,      /**< Ключ повреждён или `len > BIGNUM_CAPACITY`. */
+    BIGNUM_ORDKEY_ERROR_NULL     = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_ordkey_status_t;
+
+/**
+ * @brief Возвращает размер ключа для числа `a` в байтах.
+ * @param[in] a Число.
+ * @return `BIGNUM_ORDKEY_PREFIX_SIZE + a->len * 8`; `0`, если `a == NULL`.
+ */
+size_t bignum_ordkey_size(const bignum_t *a);
+
+/**
+ * @brief Кодирует число в байтовый ключ.
+ *
+ * @param[in]  a       Число.
+ * @param[out] out     Буфер для ключа.
+ * @param[in]  out_cap Размер буфера в байтах.
+ * @param[out] out_len Фактический размер ключа (может быть `NULL`).
+ *
+ * @return `BIGNUM_ORDKEY_OK`; `BIGNUM_ORDKEY_ERROR_BUFFER`, если `out_cap` мал;
+ *         `BIGNUM_ORDKEY_ERROR_FORMAT`, если `a->len > BIGNUM_CAPACITY`;
+ *         `BIGNUM_ORDKEY_ERROR_NULL`, если `a` или `out` равен `NULL`.
+ */
+bignum_ordkey_status_t bignum_to_ordkey(const bignum_t *a, uint8_t *out, size_t out_cap, size_t *out_len);
+
+/**
+ * @brief Декодирует байтовый ключ обратно в число.
+ *
+ * @details Ключ самоограничен: из буфера читается ровно один ключ, его размер
+ *          возвращается в `consumed`. Слова выше `len` обнуляются.
+ *
+ * @param[out] a        Результат.
+ * @param[in]  key      Буфер с ключом.
+ * @param[in]  key_len  Доступный размер буфера в байтах.
+ * @param[out] consumed Размер прочитанного ключа (может быть `NULL`).
+ *
+ * @return `BIGNUM_ORDKEY_OK`; `BIGNUM_ORDKEY_ERROR_FORMAT`, если ключ усечён
+ *         или `len > BIGNUM_CAPACITY`; `BIGNUM_ORDKEY_ERROR_NULL`.
+ */
+bignum_ordkey_status_t bignum_from_ordkey(bignum_t *a, const uint8_t *key, size_t key_len, size_t *consumed);
+
+/**
+ * @brief Пакетно кодирует массив чисел в один непрерывный буфер.
+ *
+ * @details Ключ `i` занимает байты `[offsets[i], offsets[i+1])`. Перестановка
+ *          байт выполняется векторно (SSSE3/AVX2 `pshufb`), если сборка это
+ *          позволяет, иначе — через `bswap`.
+ *
+ * @param[in]  src     Массив чисел.
+ * @param[in]  n       Количество чисел.
+ * @param[out] out     Выходной буфер.
+ * @param[in]  out_cap Размер выходного буфера в байтах.
+ * @param[out] offsets Массив из `n + 1` смещений.
+ *
+ * @return `BIGNUM_ORDKEY_OK`; `BIGNUM_ORDKEY_ERROR_BUFFER` (буфер не изменяется
+ *         сверх уже закодированных ключей); `BIGNUM_ORDKEY_ERROR_FORMAT`;
+ *         `BIGNUM_ORDKEY_ERROR_NULL`.
+ */
+bignum_ordkey_status_t bignum_to_ordkey_batch(const bignum_t *src, size_t n,
+                                              uint8_t *out, size_t out_cap, size_t *offsets);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_ORDKEY_H */
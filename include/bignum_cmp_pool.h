@@ -0,0 +1,109 @@
+/**
+ * @file    bignum_cmp_pool.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Пул потоков библиотеки и `bignum_parallel_for` для пакетных операций.
+ *
+ * @details Многопоточные варианты модулей (`bignum_topk_mt`,
+ *          `bignum_sorted_runs_mt`, `bignum_bucketize_mt`, `bignum_merge_join_mt`
+ *          и др.) раньше создавали потоки на каждый вызов. Теперь они делят
+ *          работу через `bignum_parallel_for` на один пул на процесс:
+ *
+ *          - пул создаётся при первом обращении; размер — число CPU в маске
+ *            процесса (`sched_getaffinity`, поэтому `taskset` его ограничивает)
+ *            или значение `bignum_pool_set_threads`;
+ *          - вызывающий поток работает как участник 0, остальные — рабочие
+ *            потоки пула; если потоков не больше CPU в маске, каждый закреплён
+ *            за своим CPU;
+ *          - CPU упорядочены по узлам NUMA (`/sys/devices/system/node`), и
+ *            диапазон `[0, n)` раздаётся участникам непрерывными кусками в этом
+ *            порядке — соседние куски массива обрабатываются одним узлом;
+ *          - у каждого участника своя очередь кусков (диапазон номеров в одном
+ *            64-битном слове); владелец берёт куски с начала, а освободившийся
+ *            участник крадёт половину чужого остатка с конца — сначала у
+ *            участников своего узла NUMA, затем у остальных;
+ *          - при `n <= grain`, пуле из одного потока или вызове изнутри
+ *            задачи пула `fn(0, n, arg)` выполняется сразу в вызывающем потоке,
+ *            без синхронизации.
+ *
+ *          Вызовы из разных потоков выполняются пулом по очереди.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *   - rev. 2 (16.10.2026): `bignum_pool_parts` — общая политика числа частей `*_mt`.
+ *
+ * @see     bignum_cmp_topk.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_POOL_H
+#define BIGNUM_CMP_POOL_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния функций модуля pool.
+ */
+typedef enum {
+    BIGNUM_POOL_OK              =  0,      /**< Успех. */
+    BIGNUM_POOL_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_POOL_ERROR_THREAD    = -2,      /**< Не удалось создать рабочие потоки. */
+    BIGNUM_POOL_ERROR_NULL      = INT_MIN  /**< `fn == NULL`. */
+} bignum_pool_status_t;
+
+/** Тело цикла: обработать индексы `[begin, end)`. */
+typedef void (*bignum_parallel_fn)(size_t begin, size_t end, void *arg);
+
+/**
+ * @brief Задаёт размер пула (вместе с вызывающим потоком); `0` — по маске CPU.
+ * @details Работающий пул останавливается (после текущего `bignum_parallel_for`)
+ *          и создаётся заново при следующем обращении.
+ */
+bignum_pool_status_t bignum_pool_set_threads(unsigned threads);
+
+/** @brief Размер пула (вместе с вызывающим потоком); при необходимости запускает пул. */
+unsigned bignum_pool_threads(void);
+
+/**
+ * @brief Число частей для многопоточного варианта модуля над `n` элементами.
+ *
+ * @details Общая политика `*_mt`: `threads == 0` — размер пула, не больше
+ *          предела пула (256) и не больше `n / min_chunk`, то есть в каждой
+ *          части не меньше `min_chunk` элементов (и не больше частей, чем
+ *          элементов); при `n < min_chunk` — одна часть.
+ *
+ * @param[in] threads   Запрошенное число потоков (`0` — по пулу).
+ * @param[in] n         Число элементов.
+ * @param[in] min_chunk Наименьшая часть (`0` — 1).
+ *
+ * @return Число частей, от `1` до `threads` (при `threads == 0` — до размера пула).
+ */
+unsigned bignum_pool_parts(unsigned threads, size_t n, size_t min_chunk);
+
+/**
+ * @brief Вызывает `fn` на кусках `[0, n)` длиной `grain` параллельно.
+ *
+ * @param[in] n     Число индексов.
+ * @param[in] grain Размер куска (`0` — 1); при `n <= grain` — без пула.
+ * @param[in] fn    Тело цикла.
+ * @param[in] arg   Аргумент `fn`.
+ *
+ * @return `BIGNUM_POOL_OK` после завершения всех кусков; при ошибке запуска пула
+ *         `fn` не вызывается.
+ */
+bignum_pool_status_t bignum_parallel_for(size_t n, size_t grain, bignum_parallel_fn fn, void *arg);
+
+/** @brief Останавливает рабочие потоки и освобождает пул (следующий вызов создаст его заново). */
+void bignum_pool_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_POOL_H */
@@ -0,0 +1,124 @@
+/**
+ * @file    bignum_cmp_prefix.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Кэшируемый 64-битный префиксный ключ для быстрого отсева сравнений.
+ *
+ * @details В сортировке и в деревьях одно и то же число участвует в
+ *          `log n` сравнениях, и каждое заново читает `len` (в конце
+ *          264-байтной структуры, на другой кэш-линии) и затем
+ *          `words[len-1]`. Префиксный ключ хранит обе величины в одном слове:
+ *
+ *          - старшие `BIGNUM_PREFIX_LEN_BITS` бит — `len` (насыщение на
+ *            максимуме поля; при `len > BIGNUM_CAPACITY` ключ — `UINT64_MAX`);
+ *          - младшие — старшие биты слова `words[len-1]`.
+ *
+ *          Порядок ключей согласован с `bignum_cmp`: если ключи различаются,
+ *          их беззнаковое сравнение и есть результат. Равные ключи ничего не
+ *          решают — `bignum_cmp_cached` тогда вызывает `bignum_cmp`.
+ *
+ *          Ключ — снимок: после изменения числа его нужно пересчитать.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_ordkey.h, bignum_cmp_topk.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_PREFIX_H
+#define BIGNUM_CMP_PREFIX_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Ширина поля `len` в ключе: наименьшая, в которой помещается `BIGNUM_CAPACITY`. */
+#if BIGNUM_CAPACITY < 64
+#  define BIGNUM_PREFIX_LEN_BITS 6
+#elif BIGNUM_CAPACITY < 128
+#  define BIGNUM_PREFIX_LEN_BITS 7
+#elif BIGNUM_CAPACITY < 256
+#  define BIGNUM_PREFIX_LEN_BITS 8
+#elif BIGNUM_CAPACITY < 65536
+#  define BIGNUM_PREFIX_LEN_BITS 16
+#else
+#  error "BIGNUM_CAPACITY is too large for bignum_cmp_prefix.h"
+#endif
+
+/**
+ * @brief Коды состояния функций модуля prefix.
+ */
+typedef enum {
+    BIGNUM_PREFIX_OK              =  0,      /**< Успех. */
+    BIGNUM_PREFIX_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_prefix_status_t;
+
+/** Ссылка на число вместе с его префиксным ключом (16 байт). */
+typedef struct {
+    uint64_t        key;   /**< `bignum_prefix_key(num)`. */
+    const bignum_t *num;
+} bignum_prefixed_t;
+
+/**
+ * @brief Префиксный ключ числа.
+ * @param[in] x Число (не `NULL`).
+ */
+static inline uint64_t bignum_prefix_key(const bignum_t *x)
+{
+    const unsigned lb = BIGNUM_PREFIX_LEN_BITS;
+    size_t len = x->len;
+    if (len > BIGNUM_CAPACITY) {
+        return UINT64_MAX;
+    }
+    if (len == 0) {
+        return 0;
+    }
+    return ((uint64_t)len << (64 - lb)) | (x->words[len - 1] >> lb);
+}
+
+/**
+ * @brief Сравнивает `a` и `b` по их ключам `ka`, `kb`; при равных ключах — `bignum_cmp(a, b)`.
+ *
+ * @details Ключи должны быть актуальны. Пока ключи различаются, числа не
+ *          читаются (и могут быть `NULL`).
+ *
+ * @return Как у `bignum_cmp`.
+ */
+static inline bignum_cmp_status_t bignum_cmp_cached(uint64_t ka, const bignum_t *a,
+                                                    uint64_t kb, const bignum_t *b)
+{
+    if (ka != kb) {
+        return (bignum_cmp_status_t)((ka > kb) - (ka < kb));
+    }
+    return bignum_cmp(a, b);
+}
+
+/** @brief `bignum_cmp_cached` для двух `bignum_prefixed_t`. */
+static inline bignum_cmp_status_t bignum_cmp_prefixed(const bignum_prefixed_t *a, const bignum_prefixed_t *b)
+{
+    return bignum_cmp_cached(a->key, a->num, b->key, b->num);
+}
+
+/**
+ * @brief Считает ключи массива: `keys[i] = bignum_prefix_key(&xs[i])`.
+ * @return `BIGNUM_PREFIX_OK` или `BIGNUM_PREFIX_ERROR_NULL` (`xs` или `keys`
+ *         равен `NULL` при `n > 0`).
+ */
+bignum_prefix_status_t bignum_prefix_keys(const bignum_t *xs, size_t n, uint64_t *keys);
+
+/**
+ * @brief Заполняет `out[i] = { bignum_prefix_key(&xs[i]), &xs[i] }`.
+ * @return `BIGNUM_PREFIX_OK` или `BIGNUM_PREFIX_ERROR_NULL`.
+ */
+bignum_prefix_status_t bignum_prefixed_init(const bignum_t *xs, size_t n, bignum_prefixed_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_PREFIX_H */
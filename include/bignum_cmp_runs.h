@@ -0,0 +1,88 @@
+/**
+ * @file    bignum_cmp_runs.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Проверка упорядоченности массива `bignum_t` и поиск границ
+ *        неубывающих серий (runs).
+ *
+ * @details Проверка соседних пар вызовом `bignum_cmp` на каждую пару
+ *          упирается в задержку вызова и загрузку полных структур. Здесь:
+ *
+ *          - каждый элемент читается один раз: его префикс (`len`, старшее
+ *            слово) сравнивается с префиксом предыдущего, который уже лежит
+ *            в регистрах;
+ *          - пары обрабатываются блоками по 8 без ветвлений: флаги «убывание»,
+ *            «равные префиксы» и «`len` вне диапазона» собираются в битовые
+ *            маски, медленный путь (`bignum_cmp` для равных префиксов) нужен
+ *            только блокам с ненулевой маской — в типичных данных соседи
+ *            отличаются длиной или старшим словом;
+ *          - элементы впереди текущего блока запрашиваются prefetch'ем.
+ *
+ *          Многопоточные варианты (`*_mt`) делят массив на отрезки; пара на
+ *          стыке отрезков проверяется потоком правого отрезка. Порядок —
+ *          `bignum_cmp`, «отсортирован» означает «не убывает».
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_RUNS_H
+#define BIGNUM_CMP_RUNS_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния функций модуля runs.
+ */
+typedef enum {
+    BIGNUM_RUNS_OK              =  0,      /**< Успех. */
+    BIGNUM_RUNS_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_RUNS_ERROR_RANGE     = -2,      /**< Элемент с `len > BIGNUM_CAPACITY`. */
+    BIGNUM_RUNS_ERROR_THREAD    = -3,      /**< Не удалось запустить пул потоков. */
+    BIGNUM_RUNS_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_runs_status_t;
+
+/**
+ * @brief Проверяет, что `a[0] <= a[1] <= … <= a[n-1]`.
+ * @param[out] until Первый `i`, для которого `a[i-1] > a[i]`, или `n` (может быть `NULL`).
+ * @return `1` — отсортирован, `0` — нет, либо `BIGNUM_RUNS_ERROR_RANGE`/`BIGNUM_RUNS_ERROR_NULL`.
+ */
+int bignum_is_sorted(const bignum_t *a, size_t n, size_t *until);
+
+/**
+ * @brief Многопоточный `bignum_is_sorted` (`threads == 0` — по размеру пула `bignum_cmp_pool.h`).
+ * @return Как `bignum_is_sorted`, а также `BIGNUM_RUNS_ERROR_NOMEM`/`BIGNUM_RUNS_ERROR_THREAD`.
+ */
+int bignum_is_sorted_mt(const bignum_t *a, size_t n, unsigned threads, size_t *until);
+
+/**
+ * @brief Находит начала максимальных неубывающих серий.
+ *
+ * @details `starts[0] = 0`, далее — каждый `i`, для которого `a[i-1] > a[i]`.
+ *          Если серий больше `cap`, записываются первые `cap`, а `*count`
+ *          всё равно содержит их полное число.
+ *
+ * @param[out] starts Начала серий (может быть `NULL` при `cap == 0`).
+ * @param[in]  cap    Ёмкость `starts`.
+ * @param[out] count  Число серий (`0` для пустого массива).
+ */
+bignum_runs_status_t bignum_sorted_runs(const bignum_t *a, size_t n, size_t *starts, size_t cap, size_t *count);
+
+/** @brief Многопоточный `bignum_sorted_runs`. */
+bignum_runs_status_t bignum_sorted_runs_mt(const bignum_t *a, size_t n, unsigned threads,
+                                           size_t *starts, size_t cap, size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_RUNS_H */
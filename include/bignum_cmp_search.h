@@ -0,0 +1,75 @@
+/**
+ * @file    bignum_cmp_search.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Пакетный двоичный поиск по отсортированному массиву `bignum_t`
+ *        с чередованием запросов (AMAC).
+ *
+ * @details Если массив не помещается в кэш, каждый шаг двоичного поиска —
+ *          промах по ключу `mid`, и `bignum_cmp` ждёт его `len` (смещение
+ *          `8 * BIGNUM_CAPACITY`) и слова; следующий `mid` известен только
+ *          после сравнения, поэтому промахи одного поиска идут строго друг за
+ *          другом. Независимые поиски пакета можно перемежать:
+ *
+ *          - до 16 поисков («дорожек») ведутся одновременно; шаг дорожки
+ *            сравнивает с уже запрошенным ключом, выбирает половину,
+ *            запрашивает prefetch'ем строку `len` и начало слов нового `mid` и
+ *            уступает следующей дорожке;
+ *          - пока обходятся остальные дорожки, строки успевают прийти, так что
+ *            в полёте одновременно до 16 промахов, а не один;
+ *          - завершившая дорожка сразу берёт следующий запрос пакета.
+ *
+ *          Результат совпадает с поштучным двоичным поиском. Для индекса
+ *          `bignum_btree_t` то же делают `bignum_btree_lower_bound_batch` и
+ *          `bignum_btree_upper_bound_batch`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_btree.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_SEARCH_H
+#define BIGNUM_CMP_SEARCH_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния функций модуля search.
+ */
+typedef enum {
+    BIGNUM_SEARCH_OK              =  0,      /**< Успех. */
+    BIGNUM_SEARCH_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_search_status_t;
+
+/**
+ * @brief Для каждого `xs[i]` (`i < m`) — первая позиция `j`, где `keys[j] >= xs[i]` (или `n`).
+ *
+ * @param[in]  keys Ключи по неубыванию `bignum_cmp` (дубликаты допустимы).
+ * @param[in]  n    Количество ключей.
+ * @param[in]  xs   Запросы.
+ * @param[in]  m    Количество запросов.
+ * @param[out] pos  Результаты, `m` элементов.
+ *
+ * @return `BIGNUM_SEARCH_OK` или `BIGNUM_SEARCH_ERROR_NULL` (`keys == NULL` при
+ *         `n > 0`, `xs` или `pos` равен `NULL` при `m > 0`).
+ */
+bignum_search_status_t bignum_lower_bound_batch(const bignum_t *keys, size_t n,
+                                                const bignum_t *xs, size_t m, size_t *pos);
+
+/** @brief Как `bignum_lower_bound_batch`, но первая позиция с `keys[j] > xs[i]`. */
+bignum_search_status_t bignum_upper_bound_batch(const bignum_t *keys, size_t n,
+                                                const bignum_t *xs, size_t m, size_t *pos);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_SEARCH_H */
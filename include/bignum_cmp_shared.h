@@ -0,0 +1,106 @@
+/**
+ * @file    bignum_cmp_shared.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Разделяемое между потоками изменяемое значение `bignum_t` под
+ *        seqlock и сравнение с его согласованным снимком.
+ *
+ * @details `bignum_cmp` допускает разделение только на чтение. Если один поток
+ *          обновляет общий счётчик, а многие сравнивают его с порогами, каждое
+ *          чтение приходится брать под mutex, и читатели сериализуются на нём.
+ *          `bignum_shared_t` хранит значение вместе со счётчиком версии
+ *          (seqlock):
+ *
+ *          - запись делает версию нечётной, переписывает слова и делает её
+ *            снова чётной; несколько писателей сериализуются на самом счётчике;
+ *          - `bignum_cmp_snapshot` сравнивает прямо на живых словах, без
+ *            копирования и без записей в общую память, и принимает результат,
+ *            только если версия до и после сравнения одна и та же и чётная;
+ *            иначе сравнение повторяется. Читатели друг другу не мешают;
+ *          - сравнение заканчивается на первом различающемся слове (обычно
+ *            на `len` или старшем слове), поэтому окно для повтора узкое.
+ *
+ *          Поля читаются и пишутся только атомарными операциями (встроенные
+ *          `__atomic_*` GCC/Clang), поэтому доступы не являются гонкой данных в
+ *          смысле C11 и ThreadSanitizer их не отмечает. Helgrind атомарные
+ *          операции не моделирует; в тестах проверка для объекта отключается
+ *          через `VALGRIND_HG_DISABLE_CHECKING`.
+ *
+ *          Читатель, заставший запись, ждёт её окончания; при постоянных
+ *          записях читатель может повторять сравнение, пока записи не
+ *          прервутся (писатели не ждут читателей).
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_SHARED_H
+#define BIGNUM_CMP_SHARED_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния функций модуля shared.
+ */
+typedef enum {
+    BIGNUM_SHARED_OK              =  0,      /**< Успех. */
+    BIGNUM_SHARED_ERROR_RANGE     = -1,      /**< `len > BIGNUM_CAPACITY`. */
+    BIGNUM_SHARED_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_shared_status_t;
+
+/**
+ * @brief Значение под seqlock. Поля внутренние: доступ только через функции
+ *        модуля (после `bignum_shared_init` — и из разных потоков).
+ */
+typedef struct {
+    uint64_t seq;                        /**< Версия; нечётная — идёт запись. */
+    size_t   len;                        /**< Длина значения в словах. */
+    uint64_t words[BIGNUM_CAPACITY];     /**< Слова значения, младшее первым. */
+} bignum_shared_t;
+
+/**
+ * @brief Инициализирует `s` значением `x` (`NULL` — нулём), версия `0`.
+ * @details Не потокобезопасна: вызывается до того, как `s` станет доступен
+ *          другим потокам.
+ */
+bignum_shared_status_t bignum_shared_init(bignum_shared_t *s, const bignum_t *x);
+
+/**
+ * @brief Записывает `x` в `s`; версия увеличивается на 2.
+ * @return `BIGNUM_SHARED_OK`, `BIGNUM_SHARED_ERROR_RANGE` или `BIGNUM_SHARED_ERROR_NULL`.
+ */
+bignum_shared_status_t bignum_shared_store(bignum_shared_t *s, const bignum_t *x);
+
+/**
+ * @brief Копирует согласованный снимок `s` в `out`.
+ * @param[out] version Версия снимка (может быть `NULL`).
+ */
+bignum_shared_status_t bignum_shared_load(const bignum_shared_t *s, bignum_t *out, uint64_t *version);
+
+/**
+ * @brief Сравнивает согласованный снимок `s` с `b`, как `bignum_cmp(снимок, b)`.
+ *
+ * @param[in]  s       Разделяемое значение.
+ * @param[in]  b       Правый операнд (не должен меняться во время вызова).
+ * @param[out] version Версия, с которой сравнивали (может быть `NULL`).
+ *
+ * @return `1`, `0`, `-1` или `BIGNUM_CMP_ERROR_NULL` (`s == NULL` или `b == NULL`).
+ *         `b->len > BIGNUM_CAPACITY` сравнивается по длине, слова `b` при
+ *         этом не читаются.
+ */
+int bignum_cmp_snapshot(const bignum_shared_t *s, const bignum_t *b, uint64_t *version);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_SHARED_H */
@@ -0,0 +1,76 @@
+/**
+ * @file    bignum_cmp_str.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Сравнение `bignum_t` с шестнадцатеричной или десятичной строкой без
+ *        полного разбора строки.
+ *
+ * @details Проверка присланных пользователем сумм против лимитов обычно
+ *          разбирает строку в `bignum_t` и вызывает `bignum_cmp`; десятичный
+ *          разбор квадратичен по длине и доминирует. Здесь строка проверяется
+ *          на допустимые символы (по 16 байт за шаг на SSE2/SSSE3), а значение
+ *          разбирается лишь настолько, насколько нужно для ответа:
+ *
+ *          - hex: после отбрасывания ведущих нулей число цифр сравнивается с
+ *            числом шестнадцатеричных цифр `a`; при равенстве строка
+ *            разбирается по 16 цифр (одно слово) от старшего слова до первого
+ *            различия;
+ *          - dec: число цифр сравнивается с границами десятичной длины `a`
+ *            (по битовой длине); если это не решает, сравниваются оценки
+ *            `log2` по 19 старшим цифрам и 64 старшим битам `a`. Только если и
+ *            они ближе погрешности (совпадают примерно 9 старших цифр), строка
+ *            разбирается целиком.
+ *
+ *          Формат: hex — необязательный префикс `0x`/`0X` и хотя бы одна цифра
+ *          `0-9a-fA-F`; dec — хотя бы одна цифра `0-9`. Знак, пробелы и
+ *          разделители не допускаются. Строка задаётся длиной (`NUL` не нужен).
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp.h, bignum_cmp_stream.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_STR_H
+#define BIGNUM_CMP_STR_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Дополнительные коды состояния сравнения со строкой.
+ * @details Функции возвращают `int`: один из кодов `bignum_cmp_status_t`
+ *          (`1`, `0`, `-1`, `INT_MIN`) либо один из кодов ниже.
+ */
+typedef enum {
+    BIGNUM_CMP_STR_ERROR_SYNTAX = INT_MIN + 2,  /**< Недопустимый символ или нет цифр. */
+    BIGNUM_CMP_STR_ERROR_RANGE  = INT_MIN + 3   /**< `a->len > BIGNUM_CAPACITY`. */
+} bignum_cmp_str_status_t;
+
+/**
+ * @brief Сравнивает `a` с числом, записанным в `s` шестнадцатеричными цифрами.
+ *
+ * @param[in] a Левый операнд.
+ * @param[in] s Строка (правый операнд), `n` байт.
+ * @param[in] n Длина строки.
+ *
+ * @return Как `bignum_cmp(a, x)`, где `x` — значение строки;
+ *         `BIGNUM_CMP_STR_ERROR_SYNTAX`, `BIGNUM_CMP_STR_ERROR_RANGE` или
+ *         `BIGNUM_CMP_ERROR_NULL` (`a` или `s` равен `NULL`).
+ */
+int bignum_cmp_hexstr(const bignum_t *a, const char *s, size_t n);
+
+/** @brief Как `bignum_cmp_hexstr`, но для десятичной записи. */
+int bignum_cmp_decstr(const bignum_t *a, const char *s, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_STR_H */
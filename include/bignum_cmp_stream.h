@@ -0,0 +1,111 @@
+/**
+ * @file    bignum_cmp_stream.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Потоковое (инкрементальное) сравнение большого числа, поступающего частями.
+ *
+ * @details Число, приходящее по сети кадрами, не нужно целиком буферизовать
+ *          в `bignum_t`, чтобы сравнить его с эталоном (лимитом). Компаратор
+ *          получает объявленную длину `len` заранее, а затем принимает слова
+ *          от старшего к младшему порциями произвольного размера. Результат
+ *          становится известен, как только найдено первое различающееся слово,
+ *          и вызывающий код может прекратить чтение или отклонить значение.
+ *
+ *          Семантика результата совпадает с `bignum_cmp(x, ref)`, где `x` —
+ *          поступающее число с длиной `len`. Как и для `bignum_t`, объявленная
+ *          длина считается нормализованной (старшее слово ненулевое).
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *   - rev. 2 (16.10.2026): Проверка `ref->len` — `BIGNUM_CMP_STREAM_ERROR_RANGE`.
+ *
+ * @see     bignum_cmp.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_STREAM_H
+#define BIGNUM_CMP_STREAM_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Дополнительные коды состояния потокового компаратора.
+ * @details Функции потокового сравнения возвращают `int`: один из кодов
+ *          `bignum_cmp_status_t` (`1`, `0`, `-1`, `INT_MIN`) либо один из кодов ниже.
+ */
+typedef enum {
+    BIGNUM_CMP_STREAM_PENDING        = 2,           /**< Решение ещё не принято, нужны следующие слова. */
+    BIGNUM_CMP_STREAM_ERROR_OVERFLOW = INT_MIN + 1, /**< Подано больше слов, чем объявлено в `len`. */
+    BIGNUM_CMP_STREAM_ERROR_RANGE    = INT_MIN + 2  /**< `ref->len > BIGNUM_CAPACITY`. */
+} bignum_cmp_stream_status_t;
+
+/**
+ * @brief Состояние потокового компаратора.
+ * @details Поля считаются приватными; структура объявлена открыто только для
+ *          размещения на стеке без динамической памяти.
+ */
+typedef struct {
+    const bignum_t *ref;  /**< Эталон, с которым сравнивается поступающее число. */
+    size_t          len;  /**< Объявленная длина поступающего числа (в словах). */
+    size_t          pos;  /**< Сколько слов уже принято. */
+    int             state;/**< Текущий результат: `1`, `0`, `-1`, `BIGNUM_CMP_STREAM_PENDING` или `BIGNUM_CMP_STREAM_ERROR_RANGE`. */
+} bignum_cmp_stream_t;
+
+/**
+ * @brief Инициализирует потоковый компаратор.
+ *
+ * @details Если `len != ref->len`, результат известен сразу (как в `bignum_cmp`).
+ *          Если обе длины равны нулю, числа равны. Эталон с `len` больше
+ *          `BIGNUM_CAPACITY` отклоняется: этот код остаётся результатом и
+ *          возвращается последующими вызовами, слова эталона не читаются.
+ *
+ * @param[out] s   Состояние компаратора.
+ * @param[in]  ref Эталон (правый операнд). Должен оставаться валидным до конца сравнения.
+ * @param[in]  len Объявленная длина поступающего числа (левый операнд).
+ *
+ * @return `1`, `0`, `-1`, если результат уже известен; `BIGNUM_CMP_STREAM_PENDING`,
+ *         если нужны слова; `BIGNUM_CMP_STREAM_ERROR_RANGE`, если
+ *         `ref->len > BIGNUM_CAPACITY`; `BIGNUM_CMP_ERROR_NULL`, если `s` или `ref`
+ *         равен `NULL`.
+ */
+int bignum_cmp_stream_init(bignum_cmp_stream_t *s, const bignum_t *ref, size_t len);
+
+/**
+ * @brief Передаёт очередную порцию слов поступающего числа.
+ *
+ * @details Слова передаются от старшего к младшему: `limbs[0]` — самое старшее
+ *          слово порции. После принятия решения последующие порции только
+ *          учитываются в счётчике и не читаются.
+ *
+ * @param[in,out] s     Состояние компаратора.
+ * @param[in]     limbs Порция слов (может быть `NULL`, если `count == 0`).
+ * @param[in]     count Количество слов в порции.
+ *
+ * @return Текущее состояние (`1`, `0`, `-1`, `BIGNUM_CMP_STREAM_PENDING`,
+ *         `BIGNUM_CMP_STREAM_ERROR_RANGE`);
+ *         `BIGNUM_CMP_STREAM_ERROR_OVERFLOW`, если суммарно подано больше `len` слов;
+ *         `BIGNUM_CMP_ERROR_NULL`, если `s == NULL` или `limbs == NULL` при `count > 0`.
+ */
+int bignum_cmp_stream_update(bignum_cmp_stream_t *s, const uint64_t *limbs, size_t count);
+
+/**
+ * @brief Возвращает текущий результат без подачи новых слов.
+ *
+ * @param[in] s Состояние компаратора.
+ *
+ * @return `1`, `0`, `-1`, `BIGNUM_CMP_STREAM_PENDING` или
+ *         `BIGNUM_CMP_STREAM_ERROR_RANGE`; `BIGNUM_CMP_ERROR_NULL`, если `s == NULL`.
+ */
+int bignum_cmp_stream_result(const bignum_cmp_stream_t *s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_STREAM_H */
@@ -0,0 +1,135 @@
+/**
+ * @file    bignum_cmp_topk.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Порядковые статистики для массивов `bignum_t`: `nth_element`,
+ *        `partial_sort` и потоковый top-k (в том числе многопоточный).
+ *
+ * @details Полная сортировка `qsort` + `bignum_cmp` ради первых k элементов
+ *          делает O(n log n) сравнений и перемещает 264-байтовые структуры
+ *          на каждом обмене. Здесь:
+ *
+ *          - `bignum_nth_element` и `bignum_partial_sort` работают не с самими
+ *            числами, а с 16-байтовыми записями (`len`, старшее слово, номер
+ *            элемента). Разбиение — трёхпутевое (`< p`, `== p`, `> p`) двумя
+ *            проходами Ломуто без ветвлений; префикс опорного элемента
+ *            вычисляется один раз на разбиение, полный `bignum_cmp`
+ *            вызывается только при равенстве префиксов. Серии равных ключей
+ *            попадают в среднюю часть и больше не обрабатываются, поэтому не
+ *            ухудшают сложность. Исходный массив переставляется один раз в
+ *            конце (не более n копирований `bignum_t`). Доп. память — 16 байт
+ *            на элемент.
+ *          - `bignum_topk_*` — ограниченная min-куча k наибольших значений:
+ *            новое значение отбрасывается сравнением с префиксом корня, без
+ *            доступа к памяти кучи; в большинстве случаев это одно сравнение
+ *            длины и одно — старшего слова.
+ *          - `bignum_topk_mt` делит массив между потоками, каждый ведёт свою
+ *            кучу, затем кучи сливаются `bignum_topk_merge`.
+ *
+ *          Порядок везде — `bignum_cmp`. `nth_element`/`partial_sort` следуют
+ *          соглашениям `std::` (наименьшие впереди), top-k возвращает
+ *          наибольшие значения по убыванию.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_TOPK_H
+#define BIGNUM_CMP_TOPK_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Коды состояния функций модуля topk.
+ */
+typedef enum {
+    BIGNUM_TOPK_OK              =  0,      /**< Успех. */
+    BIGNUM_TOPK_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_TOPK_ERROR_RANGE     = -2,      /**< `len > BIGNUM_CAPACITY`, `k` вне диапазона
+                                                или более `UINT32_MAX` элементов. */
+    BIGNUM_TOPK_ERROR_THREAD    = -3,      /**< Не удалось запустить пул потоков. */
+    BIGNUM_TOPK_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_topk_status_t;
+
+/** Запись кучи: префикс значения и номер слота (внутреннее представление). */
+typedef struct {
+    uint64_t top;   /**< Старшее слово. */
+    uint32_t len;   /**< Длина. */
+    uint32_t idx;   /**< Номер слота в `slots`. */
+} bignum_topk_entry_t;
+
+/**
+ * @brief Потоковый top-k. Поля внутренние, кроме `size` и `k` (только чтение).
+ */
+typedef struct {
+    bignum_topk_entry_t *heap;   /**< Min-куча записей; `heap[0]` — наименьшее из сохранённых. */
+    bignum_t            *slots;  /**< Сохранённые значения (`k` слотов). */
+    size_t               k;      /**< Сколько наибольших значений сохраняется. */
+    size_t               size;   /**< Сколько сохранено сейчас (`<= k`). */
+} bignum_topk_t;
+
+/**
+ * @brief Переставляет `a` так, что `a[k]` — элемент, стоящий на месте `k` в
+ *        отсортированном массиве, слева — не большие, справа — не меньшие.
+ * @return `BIGNUM_TOPK_OK`, `BIGNUM_TOPK_ERROR_RANGE` (`k >= n`, длина),
+ *         `BIGNUM_TOPK_ERROR_NOMEM` или `BIGNUM_TOPK_ERROR_NULL`.
+ */
+bignum_topk_status_t bignum_nth_element(bignum_t *a, size_t n, size_t k);
+
+/**
+ * @brief Упорядочивает `k` наименьших элементов в `a[0 … k-1]` по возрастанию;
+ *        остальные — в произвольном порядке в `a[k … n-1]`.
+ * @return `BIGNUM_TOPK_OK`, `BIGNUM_TOPK_ERROR_RANGE` (`k > n`, длина),
+ *         `BIGNUM_TOPK_ERROR_NOMEM` или `BIGNUM_TOPK_ERROR_NULL`.
+ */
+bignum_topk_status_t bignum_partial_sort(bignum_t *a, size_t n, size_t k);
+
+/** @brief Создаёт пустой top-k на `k > 0` значений. */
+bignum_topk_status_t bignum_topk_init(bignum_topk_t *t, size_t k);
+
+/** @brief Учитывает значение `x` (копируется, если входит в k наибольших). */
+bignum_topk_status_t bignum_topk_push(bignum_topk_t *t, const bignum_t *x);
+
+/** @brief Учитывает `n` значений подряд. */
+bignum_topk_status_t bignum_topk_push_batch(bignum_topk_t *t, const bignum_t *xs, size_t n);
+
+/** @brief Добавляет в `dst` значения из `src` (`src` не меняется). */
+bignum_topk_status_t bignum_topk_merge(bignum_topk_t *dst, const bignum_topk_t *src);
+
+/**
+ * @brief Копирует сохранённые значения в `out` по убыванию.
+ * @param[out] out   Массив на `t->k` элементов.
+ * @param[out] count Сколько записано (`t->size`).
+ */
+bignum_topk_status_t bignum_topk_result(const bignum_topk_t *t, bignum_t *out, size_t *count);
+
+/** @brief Освобождает память (`t` может быть `NULL`). */
+void bignum_topk_free(bignum_topk_t *t);
+
+/**
+ * @brief `k` наибольших элементов `a` по убыванию в `out` (на `k` элементов).
+ * @param[out] count `min(k, n)`.
+ */
+bignum_topk_status_t bignum_topk(const bignum_t *a, size_t n, size_t k, bignum_t *out, size_t *count);
+
+/**
+ * @brief Многопоточный `bignum_topk`: `threads` частей в пуле `bignum_cmp_pool.h` (`0` — по размеру пула),
+ *        у каждой части своя куча, в конце кучи сливаются.
+ */
+bignum_topk_status_t bignum_topk_mt(const bignum_t *a, size_t n, size_t k, unsigned threads,
+                                    bignum_t *out, size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_TOPK_H */
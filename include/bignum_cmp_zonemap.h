@@ -0,0 +1,132 @@
+/**
+ * @file    bignum_cmp_zonemap.h
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Зональная карта (min/max по блокам строк) для пропуска блоков при
+ *        диапазонном сканировании неотсортированного столбца `bignum_t`.
+ *
+ * @details Столбец делится на блоки по `block_rows` строк; для каждого блока
+ *          хранится минимум и максимум по `bignum_cmp` в сжатом виде:
+ *          префикс (`len`, `words[len-1]`) и номер строки, где лежит сам ключ.
+ *          Сравнение границы запроса со сводкой сначала идёт по префиксу
+ *          (порядок префиксов согласован с `bignum_cmp`, см. bignum_cmp_btree.h);
+ *          только при совпадении префиксов читается полный ключ из столбца.
+ *
+ *          Блок классифицируется для предиката `lo <= x <= hi`:
+ *          - `max < lo` или `min > hi` — блок пропускается целиком;
+ *          - `lo <= min` и `max <= hi` — все строки подходят без сравнений;
+ *          - иначе строки блока проверяются `bignum_cmp`.
+ *
+ *          Карта не владеет столбцом: вызывающая сторона передаёт указатель на
+ *          него в каждую функцию (массив может переезжать при росте) и
+ *          дописывает строки только в конец, сообщая новый размер через
+ *          `bignum_zonemap_append`. Изменение уже учтённых строк требует
+ *          перестроения карты.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание API.
+ *
+ * @see     bignum_cmp_btree.h
+ * @since   1.1.0
+ */
+
+#ifndef BIGNUM_CMP_ZONEMAP_H
+#define BIGNUM_CMP_ZONEMAP_H
+
+#include "bignum_cmp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Размер блока по умолчанию (строк). */
+#define BIGNUM_ZONEMAP_DEFAULT_BLOCK 1024
+
+/**
+ * @brief Коды состояния функций модуля zonemap.
+ */
+typedef enum {
+    BIGNUM_ZONEMAP_OK              =  0,      /**< Успех. */
+    BIGNUM_ZONEMAP_ERROR_NOMEM     = -1,      /**< Не удалось выделить память. */
+    BIGNUM_ZONEMAP_ERROR_RANGE     = -2,      /**< `len > BIGNUM_CAPACITY`, строк больше `UINT32_MAX`,
+                                                   `block_rows == 0` или столбец стал короче. */
+    BIGNUM_ZONEMAP_ERROR_NULL      = INT_MIN  /**< Один из обязательных указателей равен `NULL`. */
+} bignum_zonemap_status_t;
+
+/**
+ * @brief Класс блока относительно предиката.
+ */
+typedef enum {
+    BIGNUM_ZONEMAP_SKIP    = 0,   /**< Ни одна строка не подходит. */
+    BIGNUM_ZONEMAP_PARTIAL = 1,   /**< Строки нужно проверить. */
+    BIGNUM_ZONEMAP_FULL    = 2    /**< Подходят все строки. */
+} bignum_zonemap_class_t;
+
+/** Сводка блока, 32 байта (две сводки на кэш-линию). */
+typedef struct {
+    uint64_t min_top;   /**< Старшее слово минимума. */
+    uint64_t max_top;   /**< Старшее слово максимума. */
+    uint32_t min_row;   /**< Строка минимума (для полного сравнения). */
+    uint32_t max_row;   /**< Строка максимума. */
+    uint16_t min_len;   /**< Длина минимума. */
+    uint16_t max_len;   /**< Длина максимума. */
+    uint32_t pad;       /**< Добивка до 32 байт. */
+} bignum_zonemap_zone_t;
+
+/**
+ * @brief Карта. Поля внутренние, кроме `rows`, `block_rows` и `nzones` (только чтение).
+ */
+typedef struct {
+    bignum_zonemap_zone_t *zones;       /**< Сводки блоков. */
+    size_t                 nzones;      /**< Число блоков (последний может быть неполным). */
+    size_t                 cap_zones;   /**< Ёмкость массива `zones`. */
+    size_t                 block_rows;  /**< Строк в блоке. */
+    size_t                 rows;        /**< Учтено строк столбца. */
+} bignum_zonemap_t;
+
+/**
+ * @brief Создаёт пустую карту.
+ * @param[in] block_rows Строк в блоке (`0` — `BIGNUM_ZONEMAP_DEFAULT_BLOCK`).
+ */
+bignum_zonemap_status_t bignum_zonemap_init(bignum_zonemap_t *z, size_t block_rows);
+
+/**
+ * @brief Учитывает строки `column[z->rows … rows-1]`, дописанные в конец столбца.
+ * @param[in] column Столбец (текущий адрес).
+ * @param[in] rows   Новая длина столбца (`>= z->rows`).
+ * @return `BIGNUM_ZONEMAP_OK` или код ошибки; при ошибке карта не меняется.
+ */
+bignum_zonemap_status_t bignum_zonemap_append(bignum_zonemap_t *z, const bignum_t *column, size_t rows);
+
+/**
+ * @brief Классифицирует блок `block` для предиката `lo <= x <= hi`.
+ * @param[in] lo Нижняя граница (включительно) или `NULL` — без границы.
+ * @param[in] hi Верхняя граница (включительно) или `NULL` — без границы.
+ * @return Класс блока; `BIGNUM_ZONEMAP_SKIP` для `block >= nzones`.
+ */
+bignum_zonemap_class_t bignum_zonemap_classify(const bignum_zonemap_t *z, const bignum_t *column, size_t block,
+                                               const bignum_t *lo, const bignum_t *hi);
+
+/**
+ * @brief Выбирает строки столбца, удовлетворяющие `lo <= x <= hi`.
+ * @param[out] rows   Номера строк по возрастанию; вмещает до `z->rows` элементов
+ *                    или `NULL`, если нужен только счёт.
+ * @param[out] count  Число подходящих строк.
+ * @param[out] scanned Число строк, сравненных `bignum_cmp` (может быть `NULL`).
+ * @return `BIGNUM_ZONEMAP_OK`, `BIGNUM_ZONEMAP_ERROR_RANGE` (граница с `len > BIGNUM_CAPACITY`)
+ *         или `BIGNUM_ZONEMAP_ERROR_NULL`.
+ */
+bignum_zonemap_status_t bignum_zonemap_select(const bignum_zonemap_t *z, const bignum_t *column,
+                                              const bignum_t *lo, const bignum_t *hi,
+                                              size_t *rows, size_t *count, size_t *scanned);
+
+/** @brief Освобождает память карты (`z` может быть `NULL`). */
+void bignum_zonemap_free(bignum_zonemap_t *z);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIGNUM_CMP_ZONEMAP_H */
@@ -1,8 +1,8 @@
 ; -----------------------------------------------------------------------------
 ; @file    bignum_cmp.asm
 ; @author  git@bayborodov.com
-; @version 1.0.7
-; @date    01.07.2026
+; @version 1.0.8
+; @date    16.10.2026
 ;
 ; @brief Ассемблерная реализация модуля сравнения больших чисел (bignum_t).
 ;
@@ -26,8 +26,44 @@
 ;                          - Исправлен баг с size_t: Длины читаются в 64-битные регистры rcx и rdx.
 ;                          - Холодный код вынесен вниз: Обработка NULL убрана из кэша инструкций горячего пути.
 ;   - rev. 7 (01.07.2026): Микрооптимизации, unrollx2
+;   - rev. 8 (16.10.2026): Раскладка bignum_t берётся из сгенерированного
+;                          bignum_layout.inc (make CAPACITY=N) вместо жёстко
+;                          заданных 32/256. Ядро выбирается по ёмкости:
+;                          полностью развёрнутое SSE2 для N <= 8, прежний
+;                          скалярный unrollx2 для средних N, векторный цикл
+;                          по 4 слова для N >= 64.
 ; -----------------------------------------------------------------------------
 
+; Раскладка bignum_t генерируется из bignum.h при сборке (tools/bignum_layout_gen.c):
+; BIGNUM_CAPACITY, BIGNUM_WORD_SIZE, BIGNUM_OFFSET_WORDS, BIGNUM_OFFSET_LEN, BIGNUM_SIZE.
+%include "bignum_layout.inc"
+
+; --- Проверки согласованности раскладки C и ассемблера ---
+%if BIGNUM_WORD_SIZE <> 8
+  %error "bignum_t.words must be 64-bit"
+%endif
+%if BIGNUM_OFFSET_WORDS <> 0
+  %error "bignum_t.words must be the first member"
+%endif
+%if BIGNUM_OFFSET_LEN < BIGNUM_CAPACITY * BIGNUM_WORD_SIZE
+  %error "bignum_t.len overlaps words"
+%endif
+
+; --- Пороги выбора ядра (можно переопределить через yasm -D) ---
+%ifndef BIGNUM_CMP_UNROLL_MAX
+  %define BIGNUM_CMP_UNROLL_MAX 8      ; N <= 8: полностью развёрнутое SSE2-ядро
+%endif
+%ifndef BIGNUM_CMP_VECTOR_MIN
+  %define BIGNUM_CMP_VECTOR_MIN 64     ; N >= 64: векторный цикл по 4 слова
+%endif
+
+%if BIGNUM_CAPACITY <= BIGNUM_CMP_UNROLL_MAX
+  ; Развёрнутое ядро читает ceil(N/2) * 16 байт от начала структуры
+  %if ((BIGNUM_CAPACITY + 1) / 2) * 16 > BIGNUM_SIZE
+    %error "unrolled kernel would read past the end of bignum_t"
+  %endif
+%endif
+
 section .text
 
 ; =============================================================================
@@ -35,7 +71,8 @@ section .text
 ;
 ; @details
 ; ### Алгоритм
-; 1.  Сохраняется регистр `rbx`, так как он является callee-saved.
+; 1.  Callee-saved регистры не используются (`rbx` и др. не сохраняются):
+;     все пути обходятся rax, rcx, rdx, r8 и xmm0–xmm3.
 ; 2.  Проверяются входные указатели `a` (в `rdi`) и `b` (в `rsi`) на `NULL`.
 ;     Если один из них `NULL`, возвращается `INT_MIN` (0x80000000).
 ; 3.  Сравнивается количество "слов" (`len`) в каждом числе.
@@ -47,7 +84,15 @@ section .text
 ;     `a->words[i]` и `b->words[i]`.
 ; 7.  При первом же различии возвращается `1` или `-1`.
 ; 8.  Если цикл завершается без нахождения различий, числа равны, возвращается `0`.
-; 9.  Перед выходом восстанавливается `rbx`.
+;
+; ### Специализация по ёмкости N = BIGNUM_CAPACITY
+; -   N <= BIGNUM_CMP_UNROLL_MAX: все N слов обоих чисел сравниваются
+;     побайтно (`pcmpeqb`/`pmovmskb`) без цикла, маска различий обрезается
+;     по `len`, `bsr` находит старшее различающееся слово, и только оно
+;     сравнивается скалярно. Ветвление не зависит от положения различия.
+; -   N >= BIGNUM_CMP_VECTOR_MIN: от старшего слова вниз по 4 слова (32 байта)
+;     за итерацию; при различии — `bsr` по маске, остаток < 4 слов — скалярно.
+; -   Иначе: скалярный цикл unrollx2 (шаги 5–8).
 ;
 ; @abi        System V AMD64 ABI
 ; @param[in] rdi: const bignum_t *a (указатель на структуру)
@@ -57,19 +102,12 @@ section .text
 ; @retval 0 (a == b)
 ; @retval -1 (a < b)
 ; @retval 0x80000000 (ошибка)
-; @clobbers   rbx, r8–r15, rcx, rdx
+; @clobbers   rax, rcx, rdx, r8, xmm0–xmm3
 ;
 ; =============================================================================
 
-; Определение смещений внутри структуры bignum_t
-%define BIGNUM_WORDS_OFFSET 0
-%define BIGNUM_LEN_OFFSET   256  ; 32 words * 8 bytes/word
 ; --- Константы ---
-BIGNUM_CAPACITY         equ 32
-BIGNUM_WORD_SIZE        equ 8
 BIGNUM_BITS             equ BIGNUM_CAPACITY * 64
-BIGNUM_OFFSET_WORDS     equ 0
-BIGNUM_OFFSET_LEN       equ BIGNUM_CAPACITY * BIGNUM_WORD_SIZE
 
 BIGNUM_CMP_GREATER      equ 1
 BIGNUM_CMP_EQ           equ 0
@@ -87,8 +125,8 @@ bignum_cmp:
     jz      .error_null
 
     ; 2. Чтение длин
-    mov     rcx, [rdi + BIGNUM_LEN_OFFSET]
-    mov     rdx, [rsi + BIGNUM_LEN_OFFSET]
+    mov     rcx, [rdi + BIGNUM_OFFSET_LEN]
+    mov     rdx, [rsi + BIGNUM_OFFSET_LEN]
 
     ; 3. Сравнение длин
     cmp     rcx, rdx
@@ -98,6 +136,85 @@ bignum_cmp:
     test    rcx, rcx
     jz      .are_equal
 
+%if BIGNUM_CAPACITY <= BIGNUM_CMP_UNROLL_MAX
+    ; 5a. Маска равных байт по всем N словам (бит i — байт i), без цикла
+  %assign i 0
+  %rep (BIGNUM_CAPACITY + 1) / 2
+    movdqu  xmm0, [rdi + i*16]
+    movdqu  xmm1, [rsi + i*16]
+    pcmpeqb xmm0, xmm1
+    %if i = 0
+    pmovmskb eax, xmm0              ; rax = маска байт слов 0..1 (старшие биты обнулены)
+    %else
+    pmovmskb r8d, xmm0
+    shl     r8, i*16
+    or      rax, r8
+    %endif
+    %assign i i+1
+  %endrep
+
+    ; Инвертируем в маску различий и оставляем только байты слов 0..len-1
+    not     rax
+    shl     ecx, 3                  ; ecx = len * 8 (1..64)
+    neg     ecx
+    add     ecx, 64                 ; ecx = 64 - len * 8 (0..56)
+    mov     rdx, -1
+    shr     rdx, cl
+    and     rax, rdx
+    jz      .are_equal
+
+    ; Старший различающийся байт → слово; сравниваем одно слово скалярно
+    bsr     rax, rax
+    shr     eax, 3
+    mov     rdx, [rdi + rax*8]
+    cmp     rdx, [rsi + rax*8]
+    jmp     .diff_words
+
+%elif BIGNUM_CAPACITY >= BIGNUM_CMP_VECTOR_MIN
+    ; 5b. Векторный цикл: 4 слова (32 байта) за итерацию, от старшего к младшему
+    cmp     rcx, 4
+    jb      .tail
+
+    align 16
+.vloop:
+    movdqu  xmm0, [rdi + rcx*8 - 32]
+    movdqu  xmm1, [rdi + rcx*8 - 16]
+    movdqu  xmm2, [rsi + rcx*8 - 32]
+    movdqu  xmm3, [rsi + rcx*8 - 16]
+    pcmpeqb xmm0, xmm2
+    pcmpeqb xmm1, xmm3
+    pmovmskb eax, xmm0
+    pmovmskb edx, xmm1
+    shl     edx, 16
+    or      eax, edx
+    xor     eax, 0xFFFFFFFF         ; маска различий; ZF=1, если окно равно
+    jnz     .vdiff
+    sub     rcx, 4
+    cmp     rcx, 4
+    jae     .vloop
+
+.tail:
+    ; Остаток 0..3 младших слов
+    test    rcx, rcx
+    jz      .are_equal
+.tloop:
+    mov     rax, [rdi + rcx*8 - 8]
+    cmp     rax, [rsi + rcx*8 - 8]
+    jne     .diff_words
+    dec     rcx
+    jnz     .tloop
+    jmp     .are_equal
+
+.vdiff:
+    ; Старший различающийся байт окна → слово words[rcx - 4 + idx]
+    bsr     eax, eax
+    shr     eax, 3
+    lea     rcx, [rcx + rax - 4]
+    mov     rax, [rdi + rcx*8]
+    cmp     rax, [rsi + rcx*8]
+    jmp     .diff_words
+
+%else
     ; 5. Горячий цикл (выровнен для кэша)
     align 16
 .loop:
@@ -114,6 +231,7 @@ bignum_cmp:
     
     dec     rcx
     jnz     .loop
+%endif
 
 .are_equal:
     xor     eax, eax                ; return 0
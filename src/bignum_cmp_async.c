@@ -0,0 +1,407 @@
+/**
+ * @file    bignum_cmp_async.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация асинхронной очереди заданий.
+ *
+ * @details Задания лежат в `entries` слотах со стеком свободных слотов.
+ *          Очередь отправки — кольцо номеров слотов, кольцо завершений —
+ *          массив `bignum_async_cqe_t`; оба на `entries` элементов и под одной
+ *          блокировкой `lock`. Счётчик `pending` растёт при отправке и
+ *          уменьшается только в `reap`, поэтому завершений никогда не больше
+ *          `entries` и кольцо завершений не переполняется.
+ *
+ *          `eventfd` пишется, когда кольцо завершений становится непустым, и
+ *          вычитывается, когда `reap` его опустошает; обе операции под `lock`,
+ *          так что `fd` читаем ровно тогда, когда есть что забрать.
+ *
+ *          Занятый слот, которого нет в очереди отправки, выполняется. Отмена
+ *          снимает слот из очереди отправки (сдвигом кольца) или выставляет
+ *          выполняемому заданию флаг `cancel`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#define _GNU_SOURCE                     /* eventfd */
+#include "bignum_cmp_async.h"
+#include "bignum_cmp_search.h"
+#include "bignum_cmp_topk.h"
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#define MAX_THREADS 256
+
+typedef struct {
+    bignum_async_sqe_t sqe;
+    atomic_int         cancel;
+    int                used;
+} async_job_t;
+
+struct bignum_async_ring {
+    pthread_mutex_t     lock;
+    pthread_cond_t      work;       /**< Рабочие ждут заданий. */
+    async_job_t        *jobs;
+    uint32_t           *free_slots;
+    size_t              nfree;
+    uint32_t           *sq;         /**< Номера слотов в порядке отправки. */
+    size_t              sq_head, sq_count;
+    bignum_async_cqe_t *cq;
+    size_t              cq_head, cq_count;
+    size_t              pending;
+    size_t              entries;
+    int                 fd;
+    int                 stop;
+    unsigned            started;
+    pthread_t          *tids;
+};
+
+/* ---- Выполнение ---- */
+
+static inline int canceled(async_job_t *job)
+{
+    return atomic_load_explicit(&job->cancel, memory_order_relaxed);
+}
+
+static int run_job(async_job_t *job)
+{
+    const bignum_async_sqe_t *s = &job->sqe;
+    if (canceled(job)) {
+        return BIGNUM_ASYNC_CANCELED;
+    }
+    switch (s->op) {
+    case BIGNUM_ASYNC_OP_CMP:
+        for (size_t i = 0; i < s->n; i += BIGNUM_ASYNC_CHUNK) {
+            if (canceled(job)) {
+                return BIGNUM_ASYNC_CANCELED;
+            }
+            size_t end = (s->n - i < BIGNUM_ASYNC_CHUNK) ? s->n : i + BIGNUM_ASYNC_CHUNK;
+            for (size_t j = i; j < end; ++j) {
+                s->cmp_out[j] = bignum_cmp(&s->a[j], &s->b[j]);
+            }
+        }
+        return BIGNUM_ASYNC_OK;
+    case BIGNUM_ASYNC_OP_SORT: {
+        bignum_topk_status_t st = bignum_partial_sort(s->data, s->n, s->n);
+        return st == BIGNUM_TOPK_OK          ? BIGNUM_ASYNC_OK
+             : st == BIGNUM_TOPK_ERROR_NOMEM ? BIGNUM_ASYNC_ERROR_NOMEM
+             : st == BIGNUM_TOPK_ERROR_RANGE ? BIGNUM_ASYNC_ERROR_RANGE
+                                             : BIGNUM_ASYNC_ERROR_NULL;
+    }
+    case BIGNUM_ASYNC_OP_LOWER_BOUND:
+    case BIGNUM_ASYNC_OP_UPPER_BOUND:
+        for (size_t i = 0; i < s->m; i += BIGNUM_ASYNC_CHUNK) {
+            if (canceled(job)) {
+                return BIGNUM_ASYNC_CANCELED;
+            }
+            size_t cnt = (s->m - i < BIGNUM_ASYNC_CHUNK) ? s->m - i : BIGNUM_ASYNC_CHUNK;
+            if (s->op == BIGNUM_ASYNC_OP_LOWER_BOUND) {
+                bignum_lower_bound_batch(s->a, s->n, s->b + i, cnt, s->pos_out + i);
+            } else {
+                bignum_upper_bound_batch(s->a, s->n, s->b + i, cnt, s->pos_out + i);
+            }
+        }
+        return BIGNUM_ASYNC_OK;
+    }
+    return BIGNUM_ASYNC_ERROR_RANGE;
+}
+
+/* ---- Кольца (под `lock`) ---- */
+
+static void post_cqe(struct bignum_async_ring *r, uint64_t user_data, int status)
+{
+    r->cq[(r->cq_head + r->cq_count) % r->entries] = (bignum_async_cqe_t){ user_data, status };
+    if (r->cq_count++ == 0) {
+        uint64_t one = 1;
+        ssize_t  rc  = write(r->fd, &one, sizeof(one));
+        (void)rc;                       /* счётчик eventfd не переполнится */
+    }
+}
+
+static void release_slot(struct bignum_async_ring *r, uint32_t slot)
+{
+    r->jobs[slot].used = 0;
+    r->free_slots[r->nfree++] = slot;
+}
+
+static void *worker_main(void *arg)
+{
+    struct bignum_async_ring *r = arg;
+    pthread_mutex_lock(&r->lock);
+    for (;;) {
+        while (!r->stop && r->sq_count == 0) {
+            pthread_cond_wait(&r->work, &r->lock);
+        }
+        if (r->stop) {
+            break;
+        }
+        uint32_t slot = r->sq[r->sq_head];
+        r->sq_head = (r->sq_head + 1) % r->entries;
+        r->sq_count--;
+        pthread_mutex_unlock(&r->lock);
+
+        int status = run_job(&r->jobs[slot]);
+
+        pthread_mutex_lock(&r->lock);
+        post_cqe(r, r->jobs[slot].sqe.user_data, status);
+        release_slot(r, slot);
+    }
+    pthread_mutex_unlock(&r->lock);
+    return NULL;
+}
+
+static bignum_async_status_t check_sqe(const bignum_async_sqe_t *s)
+{
+    if (s == NULL) {
+        return BIGNUM_ASYNC_ERROR_NULL;
+    }
+    switch (s->op) {
+    case BIGNUM_ASYNC_OP_CMP:
+        return (s->n > 0 && (s->a == NULL || s->b == NULL || s->cmp_out == NULL))
+             ? BIGNUM_ASYNC_ERROR_NULL : BIGNUM_ASYNC_OK;
+    case BIGNUM_ASYNC_OP_SORT:
+        return (s->n > 0 && s->data == NULL) ? BIGNUM_ASYNC_ERROR_NULL : BIGNUM_ASYNC_OK;
+    case BIGNUM_ASYNC_OP_LOWER_BOUND:
+    case BIGNUM_ASYNC_OP_UPPER_BOUND:
+        return ((s->n > 0 && s->a == NULL) || (s->m > 0 && (s->b == NULL || s->pos_out == NULL)))
+             ? BIGNUM_ASYNC_ERROR_NULL : BIGNUM_ASYNC_OK;
+    }
+    return BIGNUM_ASYNC_ERROR_RANGE;
+}
+
+/* ---- API ---- */
+
+bignum_async_status_t bignum_async_init(bignum_async_t *q, size_t entries, unsigned threads)
+{
+    if (q == NULL) {
+        return BIGNUM_ASYNC_ERROR_NULL;
+    }
+    memset(q, 0, sizeof(*q));
+    q->fd = -1;
+    if (entries == 0 || entries > UINT32_MAX) {
+        return BIGNUM_ASYNC_ERROR_RANGE;
+    }
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 1) ? (unsigned)(cpus - 1) : 1;
+    }
+    threads = threads > MAX_THREADS ? MAX_THREADS : threads;
+
+    struct bignum_async_ring *r = calloc(1, sizeof(*r));
+    if (r == NULL) {
+        return BIGNUM_ASYNC_ERROR_NOMEM;
+    }
+    r->jobs       = calloc(entries, sizeof(async_job_t));
+    r->free_slots = malloc(entries * sizeof(uint32_t));
+    r->sq         = malloc(entries * sizeof(uint32_t));
+    r->cq         = malloc(entries * sizeof(bignum_async_cqe_t));
+    r->tids       = malloc(threads * sizeof(pthread_t));
+    r->entries    = entries;
+    r->fd         = -1;
+    q->ring       = r;
+    if (r->jobs == NULL || r->free_slots == NULL || r->sq == NULL || r->cq == NULL || r->tids == NULL) {
+        bignum_async_free(q);
+        return BIGNUM_ASYNC_ERROR_NOMEM;
+    }
+    for (size_t s = 0; s < entries; ++s) {
+        atomic_init(&r->jobs[s].cancel, 0);
+        r->free_slots[s] = (uint32_t)(entries - 1 - s);
+    }
+    r->nfree = entries;
+    r->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (r->fd < 0) {
+        bignum_async_free(q);
+        return BIGNUM_ASYNC_ERROR_SYS;
+    }
+    pthread_mutex_init(&r->lock, NULL);
+    pthread_cond_init(&r->work, NULL);
+    for (unsigned i = 0; i < threads; ++i) {
+        if (pthread_create(&r->tids[i], NULL, worker_main, r) != 0) {
+            bignum_async_free(q);
+            return BIGNUM_ASYNC_ERROR_THREAD;
+        }
+        r->started = i + 1;
+    }
+    q->fd      = r->fd;
+    q->entries = entries;
+    q->threads = threads;
+    return BIGNUM_ASYNC_OK;
+}
+
+void bignum_async_free(bignum_async_t *q)
+{
+    if (q == NULL || q->ring == NULL) {
+        return;
+    }
+    struct bignum_async_ring *r = q->ring;
+    if (r->fd >= 0) {                   /* мьютекс и потоки создаются после eventfd */
+        pthread_mutex_lock(&r->lock);
+        r->stop = 1;
+        for (size_t s = 0; s < r->entries; ++s) {
+            atomic_store_explicit(&r->jobs[s].cancel, 1, memory_order_relaxed);
+        }
+        pthread_cond_broadcast(&r->work);
+        pthread_mutex_unlock(&r->lock);
+        for (unsigned i = 0; i < r->started; ++i) {
+            pthread_join(r->tids[i], NULL);
+        }
+        pthread_cond_destroy(&r->work);
+        pthread_mutex_destroy(&r->lock);
+        close(r->fd);
+    }
+    free(r->jobs);
+    free(r->free_slots);
+    free(r->sq);
+    free(r->cq);
+    free(r->tids);
+    free(r);
+    memset(q, 0, sizeof(*q));
+    q->fd = -1;
+}
+
+/** Ставит проверенное задание; под `lock`. */
+static bignum_async_status_t push_locked(struct bignum_async_ring *r, const bignum_async_sqe_t *sqe)
+{
+    if (r->pending == r->entries) {
+        return BIGNUM_ASYNC_BUSY;
+    }
+    uint32_t slot = r->free_slots[--r->nfree];
+    r->jobs[slot].sqe  = *sqe;
+    r->jobs[slot].used = 1;
+    atomic_store_explicit(&r->jobs[slot].cancel, 0, memory_order_relaxed);
+    r->sq[(r->sq_head + r->sq_count) % r->entries] = slot;
+    r->sq_count++;
+    r->pending++;
+    return BIGNUM_ASYNC_OK;
+}
+
+bignum_async_status_t bignum_async_submit(bignum_async_t *q, const bignum_async_sqe_t *sqe)
+{
+    return bignum_async_submit_batch(q, sqe, 1, NULL);
+}
+
+bignum_async_status_t bignum_async_submit_batch(bignum_async_t *q, const bignum_async_sqe_t *sqes,
+                                                size_t n, size_t *submitted)
+{
+    size_t done = 0;
+    if (submitted != NULL) {
+        *submitted = 0;
+    }
+    if (q == NULL || q->ring == NULL || (n > 0 && sqes == NULL)) {
+        return BIGNUM_ASYNC_ERROR_NULL;
+    }
+    struct bignum_async_ring *r = q->ring;
+    bignum_async_status_t st = BIGNUM_ASYNC_OK;
+    pthread_mutex_lock(&r->lock);
+    while (done < n) {
+        st = check_sqe(&sqes[done]);
+        if (st == BIGNUM_ASYNC_OK) {
+            st = push_locked(r, &sqes[done]);
+        }
+        if (st != BIGNUM_ASYNC_OK) {
+            break;
+        }
+        ++done;
+    }
+    if (done == 1) {
+        pthread_cond_signal(&r->work);
+    } else if (done > 1) {
+        pthread_cond_broadcast(&r->work);
+    }
+    pthread_mutex_unlock(&r->lock);
+    if (submitted != NULL) {
+        *submitted = done;
+    }
+    return st;
+}
+
+bignum_async_status_t bignum_async_cancel(bignum_async_t *q, uint64_t user_data)
+{
+    if (q == NULL || q->ring == NULL) {
+        return BIGNUM_ASYNC_ERROR_NULL;
+    }
+    struct bignum_async_ring *r = q->ring;
+    bignum_async_status_t st = BIGNUM_ASYNC_NOT_FOUND;
+    pthread_mutex_lock(&r->lock);
+    /* Неначатые: снять из очереди отправки, сохранив порядок остальных. */
+    size_t kept = 0;
+    for (size_t i = 0; i < r->sq_count; ++i) {
+        uint32_t slot = r->sq[(r->sq_head + i) % r->entries];
+        if (r->jobs[slot].sqe.user_data == user_data) {
+            post_cqe(r, user_data, BIGNUM_ASYNC_CANCELED);
+            release_slot(r, slot);
+            st = BIGNUM_ASYNC_OK;
+        } else {
+            r->sq[(r->sq_head + kept++) % r->entries] = slot;
+        }
+    }
+    r->sq_count = kept;
+    /* Выполняемые: занятые слоты, которых не осталось в очереди отправки. */
+    if (st == BIGNUM_ASYNC_NOT_FOUND) {
+        for (size_t s = 0; s < r->entries; ++s) {
+            if (r->jobs[s].used && r->jobs[s].sqe.user_data == user_data) {
+                atomic_store_explicit(&r->jobs[s].cancel, 1, memory_order_relaxed);
+                st = BIGNUM_ASYNC_RUNNING;
+            }
+        }
+    }
+    pthread_mutex_unlock(&r->lock);
+    return st;
+}
+
+size_t bignum_async_reap(bignum_async_t *q, bignum_async_cqe_t *out, size_t max)
+{
+    if (q == NULL || q->ring == NULL || out == NULL) {
+        return 0;
+    }
+    struct bignum_async_ring *r = q->ring;
+    pthread_mutex_lock(&r->lock);
+    size_t k = r->cq_count < max ? r->cq_count : max;
+    for (size_t i = 0; i < k; ++i) {
+        out[i] = r->cq[(r->cq_head + i) % r->entries];
+    }
+    r->cq_head   = (r->cq_head + k) % r->entries;
+    r->cq_count -= k;
+    r->pending  -= k;
+    if (k > 0 && r->cq_count == 0) {
+        uint64_t v;
+        ssize_t  rc = read(r->fd, &v, sizeof(v));
+        (void)rc;
+    }
+    pthread_mutex_unlock(&r->lock);
+    return k;
+}
+
+size_t bignum_async_wait(bignum_async_t *q, bignum_async_cqe_t *out, size_t max)
+{
+    if (q == NULL || q->ring == NULL || out == NULL || max == 0) {
+        return 0;
+    }
+    for (;;) {
+        size_t k = bignum_async_reap(q, out, max);
+        if (k > 0 || bignum_async_pending(q) == 0) {
+            return k;
+        }
+        struct pollfd p = { .fd = q->ring->fd, .events = POLLIN };
+        poll(&p, 1, -1);
+    }
+}
+
+size_t bignum_async_pending(const bignum_async_t *q)
+{
+    if (q == NULL || q->ring == NULL) {
+        return 0;
+    }
+    struct bignum_async_ring *r = q->ring;
+    pthread_mutex_lock(&r->lock);
+    size_t n = r->pending;
+    pthread_mutex_unlock(&r->lock);
+    return n;
+}
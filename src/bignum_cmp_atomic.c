@@ -0,0 +1,256 @@
+/**
+ * @file    bignum_cmp_atomic.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация fetch-max/fetch-min с освобождением версий по эпохам.
+ *
+ * @details Ячейка эпох — одна кэш-линия с полем `state`: `0` — свободна,
+ *          `2 * e` — занята потоком, объявившим эпоху `e` (глобальная эпоха
+ *          начинается с 1). Вход в операцию — один CAS `0 → 2 * e`, выход —
+ *          release-запись нуля. Поток начинает поиск ячейки с номера, запомненного в `_Thread_local`,
+ *          поэтому обычно занимает одну и ту же ячейку и её линия остаётся в
+ *          его кэше.
+ *
+ *          Пока ячейка занята, её список снятых версий принадлежит занявшему
+ *          потоку. Набрав `RECLAIM_BATCH` версий, поток пытается сдвинуть
+ *          глобальную эпоху (если все активные ячейки объявили текущую) и
+ *          освобождает из своего списка версии, снятые не позже `global - 2`;
+ *          следующая попытка — ещё через `RECLAIM_BATCH` версий, чтобы поток,
+ *          надолго занявший ячейку, не превращал каждую установку в обход
+ *          списка.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "bignum_cmp_atomic.h"
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MIN_SLOTS     64
+#define RECLAIM_BATCH 32                /* снятых версий в ячейке до попытки освобождения */
+
+/** Неизменяемая версия значения. */
+typedef struct atomic_node {
+    bignum_t            value;
+    uint64_t            epoch;          /**< Эпоха снятия (пишет только снявший). */
+    struct atomic_node *next;           /**< Список снятых версий ячейки. */
+} atomic_node_t;
+
+typedef struct {
+    _Alignas(64) _Atomic uint64_t state;
+    atomic_node_t *retired;
+    size_t         nretired;
+    size_t         next_reclaim;    /**< При каком `nretired` пробовать освобождать. */
+} epoch_slot_t;
+
+struct bignum_atomic_state {
+    _Alignas(64) _Atomic(atomic_node_t *) cur;
+    _Alignas(64) _Atomic uint64_t         epoch;
+    epoch_slot_t                         *slots;
+};
+
+static _Thread_local size_t tls_slot;
+
+static atomic_node_t *node_new(const bignum_t *x)
+{
+    atomic_node_t *n = malloc(sizeof(atomic_node_t));
+    if (n != NULL) {
+        n->value.len = x->len;
+        memcpy(n->value.words, x->words, x->len * sizeof(uint64_t));
+    }
+    return n;
+}
+
+/** Занимает ячейку и объявляет текущую эпоху; после возврата версии можно читать. */
+static epoch_slot_t *enter(const bignum_atomic_t *a)
+{
+    struct bignum_atomic_state *st = a->state;
+    size_t i = tls_slot % a->nslots;
+    for (size_t tries = 1;; ++tries) {
+        /*
+         * Один seq_cst CAS и занимает ячейку, и объявляет эпоху; чтение `cur`
+         * после него. Если эпоха успела сдвинуться, объявлена более ранняя —
+         * это лишь задерживает освобождение.
+         */
+        uint64_t expected = 0;
+        if (atomic_load_explicit(&st->slots[i].state, memory_order_relaxed) == 0 &&
+            atomic_compare_exchange_strong(&st->slots[i].state, &expected, 2 * atomic_load(&st->epoch))) {
+            break;
+        }
+        i = (i + 1) % a->nslots;
+        if (tries % a->nslots == 0) {
+            sched_yield();
+        }
+    }
+    tls_slot = i;
+    return &st->slots[i];
+}
+
+static inline void leave(epoch_slot_t *s)
+{
+    atomic_store_explicit(&s->state, 0, memory_order_release);
+}
+
+/** Сдвигает глобальную эпоху, если все потоки в критических секциях объявили текущую. */
+static void try_advance(const bignum_atomic_t *a)
+{
+    struct bignum_atomic_state *st = a->state;
+    uint64_t e = atomic_load(&st->epoch);
+    for (size_t i = 0; i < a->nslots; ++i) {
+        uint64_t s = atomic_load(&st->slots[i].state);
+        if (s != 0 && s != 2 * e) {
+            return;
+        }
+    }
+    atomic_compare_exchange_strong(&st->epoch, &e, e + 1);
+}
+
+/** Ставит снятую версию в список ячейки и при необходимости освобождает старые. */
+static void retire(const bignum_atomic_t *a, epoch_slot_t *s, atomic_node_t *old)
+{
+    old->epoch = atomic_load(&a->state->epoch);
+    old->next  = s->retired;
+    s->retired = old;
+    if (++s->nretired < s->next_reclaim) {
+        return;
+    }
+    try_advance(a);
+    uint64_t safe = atomic_load(&a->state->epoch);
+    atomic_node_t **p = &s->retired;
+    while (*p != NULL) {
+        atomic_node_t *n = *p;
+        if (n->epoch + 2 <= safe) {
+            *p = n->next;
+            free(n);
+            --s->nretired;
+        } else {
+            p = &n->next;
+        }
+    }
+    s->next_reclaim = s->nretired + RECLAIM_BATCH;
+}
+
+bignum_atomic_status_t bignum_atomic_init(bignum_atomic_t *a, const bignum_t *x)
+{
+    if (a == NULL) {
+        return BIGNUM_ATOMIC_ERROR_NULL;
+    }
+    memset(a, 0, sizeof(*a));
+    if (x != NULL && x->len > BIGNUM_CAPACITY) {
+        return BIGNUM_ATOMIC_ERROR_RANGE;
+    }
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t nslots = (cpus > 0 && 2 * (size_t)cpus > MIN_SLOTS) ? 2 * (size_t)cpus : MIN_SLOTS;
+
+    bignum_t zero = { .len = 0 };
+    struct bignum_atomic_state *st = aligned_alloc(64, sizeof(struct bignum_atomic_state));
+    epoch_slot_t  *slots = aligned_alloc(64, nslots * sizeof(epoch_slot_t));
+    atomic_node_t *node  = node_new(x != NULL ? x : &zero);
+    if (st == NULL || slots == NULL || node == NULL) {
+        free(st);
+        free(slots);
+        free(node);
+        return BIGNUM_ATOMIC_ERROR_NOMEM;
+    }
+    for (size_t i = 0; i < nslots; ++i) {
+        atomic_init(&slots[i].state, 0);
+        slots[i].retired  = NULL;
+        slots[i].nretired = 0;
+        slots[i].next_reclaim = RECLAIM_BATCH;
+    }
+    atomic_init(&st->cur, node);
+    atomic_init(&st->epoch, 1);
+    st->slots = slots;
+    a->state  = st;
+    a->nslots = nslots;
+    return BIGNUM_ATOMIC_OK;
+}
+
+void bignum_atomic_free(bignum_atomic_t *a)
+{
+    if (a == NULL || a->state == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < a->nslots; ++i) {
+        for (atomic_node_t *n = a->state->slots[i].retired; n != NULL; ) {
+            atomic_node_t *next = n->next;
+            free(n);
+            n = next;
+        }
+    }
+    free(atomic_load_explicit(&a->state->cur, memory_order_relaxed));
+    free(a->state->slots);
+    free(a->state);
+    memset(a, 0, sizeof(*a));
+}
+
+bignum_atomic_status_t bignum_atomic_load(const bignum_atomic_t *a, bignum_t *out)
+{
+    if (a == NULL || a->state == NULL || out == NULL) {
+        return BIGNUM_ATOMIC_ERROR_NULL;
+    }
+    epoch_slot_t *s = enter(a);
+    const atomic_node_t *cur = atomic_load(&a->state->cur);
+    out->len = cur->value.len;
+    memcpy(out->words, cur->value.words, cur->value.len * sizeof(uint64_t));
+    leave(s);
+    return BIGNUM_ATOMIC_OK;
+}
+
+/** Общая часть fetch-max (`sign = 1`) и fetch-min (`sign = -1`). */
+static bignum_atomic_status_t fetch_op(bignum_atomic_t *a, const bignum_t *cand, bignum_t *prev, int sign)
+{
+    if (a == NULL || a->state == NULL || cand == NULL) {
+        return BIGNUM_ATOMIC_ERROR_NULL;
+    }
+    if (cand->len > BIGNUM_CAPACITY) {
+        return BIGNUM_ATOMIC_ERROR_RANGE;
+    }
+    epoch_slot_t  *s    = enter(a);
+    atomic_node_t *cur  = atomic_load(&a->state->cur);
+    atomic_node_t *node = NULL;
+    bignum_atomic_status_t st;
+    for (;;) {
+        if (sign * bignum_cmp(cand, &cur->value) <= 0) {
+            st = BIGNUM_ATOMIC_UNCHANGED;
+            break;
+        }
+        if (node == NULL && (node = node_new(cand)) == NULL) {
+            leave(s);
+            return BIGNUM_ATOMIC_ERROR_NOMEM;
+        }
+        if (atomic_compare_exchange_weak_explicit(&a->state->cur, &cur, node,
+                                                  memory_order_acq_rel, memory_order_acquire)) {
+            st = BIGNUM_ATOMIC_OK;
+            break;
+        }
+    }
+    if (prev != NULL) {
+        prev->len = cur->value.len;
+        memcpy(prev->words, cur->value.words, cur->value.len * sizeof(uint64_t));
+    }
+    if (st == BIGNUM_ATOMIC_OK) {
+        retire(a, s, cur);
+    } else {
+        free(node);                     /* не опубликована */
+    }
+    leave(s);
+    return st;
+}
+
+bignum_atomic_status_t bignum_atomic_fetch_max(bignum_atomic_t *a, const bignum_t *cand, bignum_t *prev)
+{
+    return fetch_op(a, cand, prev, 1);
+}
+
+bignum_atomic_status_t bignum_atomic_fetch_min(bignum_atomic_t *a, const bignum_t *cand, bignum_t *prev)
+{
+    return fetch_op(a, cand, prev, -1);
+}
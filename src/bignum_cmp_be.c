@@ -0,0 +1,229 @@
+/**
+ * @file    bignum_cmp_be.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация сравнения с big-endian байтами без декодирования.
+ *
+ * @details
+ * ### Сравнение при равной длине
+ * 16 big-endian байт, развёрнутые одним `pshufb`, — это ровно пара слов
+ * `words[i-2], words[i-1]` в памяти (как в `bignum_cmp_ordkey.c`, только в
+ * обратную сторону). Поэтому векторный путь разворачивает 32 байта буфера
+ * (AVX2: `vpshufb` + `vpermq`) или 16 (SSSE3), сравнивает их побайтно с
+ * `words` (`pcmpeqb` + `pmovmskb`) и при несовпадении берёт старший
+ * различающийся байт: его слово и решает. Неполное старшее слово и хвост
+ * читаются по 8 байт через `__builtin_bswap64` (`movbe`).
+ *
+ * ### Пакет с одной границей
+ * Граница переводится в big-endian один раз (без ведущих нулей), дальше
+ * каждое поле — это отбрасывание нулей, сравнение длин и `memcmp`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#include "bignum_cmp_be.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#  include <immintrin.h>
+#endif
+
+static inline int sign_u64(uint64_t x, uint64_t y)
+{
+    return (x > y) - (x < y);
+}
+
+/** Отбрасывает ведущие нулевые байты. */
+static const uint8_t *skip_zeros(const uint8_t *p, size_t *n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= *n; i += 16) {
+        __m128i  v = _mm_loadu_si128((const __m128i *)(const void *)(p + i));
+        unsigned m = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) ^ 0xFFFFu;
+        if (m != 0) {
+            i += (size_t)__builtin_ctz(m);
+            *n -= i;
+            return p + i;
+        }
+    }
+#endif
+    while (i < *n && p[i] == 0) {
+        ++i;
+    }
+    *n -= i;
+    return p + i;
+}
+
+/** Длина без нулевых старших слов. */
+static inline size_t eff_len(const bignum_t *a)
+{
+    size_t len = a->len;
+    while (len > 0 && a->words[len - 1] == 0) {
+        --len;
+    }
+    return len;
+}
+
+/** Число значащих байт нормализованного `a` длины `len`. */
+static inline size_t byte_len(const bignum_t *a, size_t len)
+{
+    return len == 0 ? 0 : (len - 1) * 8 + 8 - (size_t)__builtin_clzll(a->words[len - 1]) / 8;
+}
+
+static inline uint64_t load_be64(const uint8_t *p)
+{
+    uint64_t be;
+    memcpy(&be, p, sizeof(be));
+    return __builtin_bswap64(be);
+}
+
+/** `k <= 8` байт big-endian. */
+static inline uint64_t load_be_partial(const uint8_t *p, size_t k)
+{
+    uint64_t w = 0;
+    for (size_t i = 0; i < k; ++i) {
+        w = w << 8 | p[i];
+    }
+    return w;
+}
+
+/** Сравнивает `len` младших слов `words` с `8 * len` байтами `p` (старшее слово первым). */
+static int cmp_words_be(const uint64_t *words, const uint8_t *p, size_t len)
+{
+    size_t i = len;
+
+#if defined(__AVX2__)
+    const __m256i rev32 = _mm256_setr_epi8(
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (; i >= 4; i -= 4, p += 32) {
+        __m256i  v = _mm256_loadu_si256((const __m256i *)(const void *)p);
+        __m256i  w = _mm256_loadu_si256((const __m256i *)(const void *)&words[i - 4]);
+        v = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, rev32), 0x4E);
+        uint32_t ne = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, w));
+        if (ne != 0) {
+            size_t k = i - 4 + (size_t)(31 - __builtin_clz(ne)) / 8;
+            return sign_u64(words[k], load_be64(p + 8 * (i - 1 - k)));
+        }
+    }
+#endif
+#if defined(__SSSE3__)
+    const __m128i rev16 = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (; i >= 2; i -= 2, p += 16) {
+        __m128i  v  = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)p), rev16);
+        __m128i  w  = _mm_loadu_si128((const __m128i *)(const void *)&words[i - 2]);
+        unsigned ne = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, w)) ^ 0xFFFFu;
+        if (ne != 0) {
+            size_t k = i - 2 + (size_t)(31 - __builtin_clz(ne)) / 8;
+            return sign_u64(words[k], load_be64(p + 8 * (i - 1 - k)));
+        }
+    }
+#endif
+    for (; i > 0; --i, p += 8) {
+        uint64_t x = load_be64(p);
+        if (x != words[i - 1]) {
+            return sign_u64(words[i - 1], x);
+        }
+    }
+    return BIGNUM_CMP_EQ;
+}
+
+int bignum_cmp_be_bytes(const bignum_t *a, const uint8_t *p, size_t n)
+{
+    if (a == NULL || (p == NULL && n > 0)) {
+        return BIGNUM_BE_ERROR_NULL;
+    }
+    if (a->len > BIGNUM_CAPACITY) {
+        return BIGNUM_BE_ERROR_RANGE;
+    }
+    p = skip_zeros(p, &n);
+
+    size_t len = eff_len(a);
+    size_t ab  = byte_len(a, len);
+    if (ab != n) {
+        return ab > n ? BIGNUM_CMP_GREATER : BIGNUM_CMP_LESS;
+    }
+    if (n == 0) {
+        return BIGNUM_CMP_EQ;
+    }
+
+    size_t   head = n - 8 * (len - 1);
+    uint64_t top  = load_be_partial(p, head);
+    if (top != a->words[len - 1]) {
+        return sign_u64(a->words[len - 1], top);
+    }
+    return cmp_words_be(a->words, p + head, len - 1);
+}
+
+/** Пишет значащие байты `a` (длины `len`) старшим первым; возвращает их число. */
+static size_t store_be(const bignum_t *a, size_t len, uint8_t *dst)
+{
+    size_t n = byte_len(a, len);
+    if (n == 0) {
+        return 0;
+    }
+    size_t   head = n - 8 * (len - 1);
+    uint64_t top  = __builtin_bswap64(a->words[len - 1]);
+    memcpy(dst, (const uint8_t *)&top + 8 - head, head);
+    dst += head;
+    for (size_t i = len - 1; i > 0; --i, dst += 8) {
+        uint64_t be = __builtin_bswap64(a->words[i - 1]);
+        memcpy(dst, &be, sizeof(be));
+    }
+    return n;
+}
+
+bignum_be_status_t bignum_cmp_be_bytes_batch(const bignum_t *a, size_t na,
+                                             const uint8_t *buf, const size_t *offsets, size_t n,
+                                             int8_t *out)
+{
+    if (n == 0) {
+        return BIGNUM_BE_OK;
+    }
+    if (a == NULL || buf == NULL || offsets == NULL || out == NULL) {
+        return BIGNUM_BE_ERROR_NULL;
+    }
+    if (na != 1 && na != n) {
+        return BIGNUM_BE_ERROR_RANGE;
+    }
+    for (size_t i = 0; i < na; ++i) {
+        if (a[i].len > BIGNUM_CAPACITY) {
+            return BIGNUM_BE_ERROR_RANGE;
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (offsets[i] > offsets[i + 1]) {
+            return BIGNUM_BE_ERROR_RANGE;
+        }
+    }
+
+    if (na == n) {
+        for (size_t i = 0; i < n; ++i) {
+            if (i + 1 < n) {
+                /* len следующей границы лежит в отдельной кэш-линии за words. */
+                __builtin_prefetch(&a[i + 1].len);
+            }
+            out[i] = (int8_t)bignum_cmp_be_bytes(&a[i], buf + offsets[i], offsets[i + 1] - offsets[i]);
+        }
+        return BIGNUM_BE_OK;
+    }
+
+    uint8_t bound[BIGNUM_CAPACITY * 8];
+    size_t  nb = store_be(a, eff_len(a), bound);
+    for (size_t i = 0; i < n; ++i) {
+        size_t         m = offsets[i + 1] - offsets[i];
+        const uint8_t *p = skip_zeros(buf + offsets[i], &m);
+        if (m != nb) {
+            out[i] = nb > m ? BIGNUM_CMP_GREATER : BIGNUM_CMP_LESS;
+        } else {
+            int c  = nb ? memcmp(bound, p, nb) : 0;
+            out[i] = (int8_t)((c > 0) - (c < 0));
+        }
+    }
+    return BIGNUM_BE_OK;
+}
@@ -0,0 +1,426 @@
+/**
+ * @file    bignum_cmp_btree.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация статического B+-индекса по префиксам ключей.
+ *
+ * @details Раскладка (уровни внутренних узлов хранятся от корня к листьям):
+ *          - узел `i` уровня `l` имеет детей `i * 17 + c`, `c = 0..16`, на
+ *            уровне `l + 1` (для нижнего уровня — листья);
+ *          - разделитель `j` — минимальный ключ ребёнка `j + 1`, т.е. первый
+ *            ключ его первого листа; отсутствующие дети — пустые слоты с
+ *            `len = INT16_MAX`, которые больше любого ключа;
+ *          - поиск считает разделители, строго меньшие `x` (для upper_bound —
+ *            не большие), это и есть номер ребёнка; в листе тот же счёт даёт
+ *            позицию в исходном массиве.
+ *
+ *          Совпадение префиксов (`len` и старшего слова) означает, что порядок
+ *          решают младшие слова; такие слоты образуют непрерывный отрезок
+ *          сразу после «меньших» и дорешиваются полным `bignum_cmp`.
+ *
+ *          Пакетный поиск (`*_batch`) ведёт `INFLIGHT` запросов одновременно
+ *          (AMAC): у каждого запроса-«дорожки» — уровень и номер узла; шаг
+ *          дорожки обрабатывает уже запрошенный узел, выбирает ребёнка,
+ *          запрашивает его prefetch'ем и уступает следующей дорожке. Пока
+ *          обходятся остальные дорожки, строки узла успевают прийти из памяти.
+ *          Завершившая дорожка сразу берёт следующий запрос.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ *   - rev. 2 (16.10.2026): Пакетный поиск с чередованием запросов.
+ */
+
+#include "bignum_cmp_btree.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#  include <immintrin.h>
+#endif
+
+#define CHILDREN (BIGNUM_BTREE_FANOUT + 1)
+#define EMPTY_LEN INT16_MAX
+#define INFLIGHT  16                    /* одновременных запросов пакетного поиска */
+
+_Static_assert(BIGNUM_BTREE_FANOUT == 16 && BIGNUM_BTREE_LEAF == 16,
+               "search masks assume 16 slots per node and leaf");
+_Static_assert(sizeof(bignum_btree_node_t) % 64 == 0, "nodes must tile cache lines");
+_Static_assert(BIGNUM_CAPACITY < EMPTY_LEN, "len must fit int16_t below the empty-slot marker");
+
+/** Префикс ключа `x`; `len > BIGNUM_CAPACITY` больше любого ключа индекса. */
+static inline void key_prefix(const bignum_t *x, int16_t *len, uint64_t *top)
+{
+    if (x->len > BIGNUM_CAPACITY) {
+        *len = (int16_t)(BIGNUM_CAPACITY + 1);
+        *top = 0;
+    } else {
+        *len = (int16_t)x->len;
+        *top = (x->len > 0) ? x->words[x->len - 1] : 0;
+    }
+}
+
+/**
+ * @brief Маски 16 слотов: `lt` — префикс слота меньше (`xl`, `xt`), `*eq` — равен.
+ */
+static inline uint32_t prefix_masks(const uint64_t *top, const int16_t *len,
+                                    int16_t xl, uint64_t xt, uint32_t *eq)
+{
+    uint32_t lt_len, eq_len, lt_top = 0, eq_top = 0;
+
+#if defined(__SSE2__)
+    const __m128i vl = _mm_set1_epi16(xl);
+    const __m128i l0 = _mm_loadu_si128((const __m128i *)len);
+    const __m128i l1 = _mm_loadu_si128((const __m128i *)(len + 8));
+    lt_len = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpgt_epi16(vl, l0), _mm_cmpgt_epi16(vl, l1)));
+    eq_len = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(vl, l0), _mm_cmpeq_epi16(vl, l1)));
+#else
+    lt_len = eq_len = 0;
+    for (unsigned j = 0; j < 16; ++j) {
+        lt_len |= (uint32_t)(len[j] < xl) << j;
+        eq_len |= (uint32_t)(len[j] == xl) << j;
+    }
+#endif
+
+#if defined(__AVX2__)
+    /* Беззнаковое сравнение 64-битных слов через инверсию знакового бита. */
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i vt   = _mm256_xor_si256(_mm256_set1_epi64x((long long)xt), sign);
+    for (unsigned k = 0; k < 4; ++k) {
+        __m256i t = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(top + 4 * k)), sign);
+        lt_top |= (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(vt, t))) << (4 * k);
+        eq_top |= (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(vt, t))) << (4 * k);
+    }
+#elif defined(__SSE4_2__)
+    const __m128i sign = _mm_set1_epi64x(INT64_MIN);
+    const __m128i vt   = _mm_xor_si128(_mm_set1_epi64x((long long)xt), sign);
+    for (unsigned k = 0; k < 8; ++k) {
+        __m128i t = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(top + 2 * k)), sign);
+        lt_top |= (uint32_t)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(vt, t))) << (2 * k);
+        eq_top |= (uint32_t)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(vt, t))) << (2 * k);
+    }
+#else
+    for (unsigned j = 0; j < 16; ++j) {
+        lt_top |= (uint32_t)(top[j] < xt) << j;
+        eq_top |= (uint32_t)(top[j] == xt) << j;
+    }
+#endif
+
+    *eq = eq_len & eq_top;
+    return lt_len | (eq_len & lt_top);
+}
+
+/**
+ * @brief Количество слотов, меньших `x` (`upper`: не больших `x`).
+ * @param key_at Позиции полных ключей слотов (для дорешивания совпавших префиксов).
+ */
+static inline size_t count_slots(const bignum_t *keys, const uint64_t *top, const int16_t *len,
+                                 const uint32_t *key_at, size_t key_base,
+                                 const bignum_t *x, int16_t xl, uint64_t xt, int upper)
+{
+    uint32_t eq;
+    uint32_t lt = prefix_masks(top, len, xl, xt, &eq);
+    size_t   count = (size_t)__builtin_popcount(lt);
+
+    while (eq != 0) {
+        unsigned j   = (unsigned)__builtin_ctz(eq);
+        size_t   idx = key_at ? key_at[j] : key_base + j;
+        int      c   = bignum_cmp(&keys[idx], x);
+        if (c > 0 || (c == 0 && !upper)) {
+            break;
+        }
+        ++count;
+        eq &= eq - 1;
+    }
+    return count;
+}
+
+static size_t search(const bignum_btree_t *t, const bignum_t *x, int upper)
+{
+    int16_t  xl;
+    uint64_t xt;
+    size_t   unit = 0;
+
+    if (t->n == 0) {
+        return 0;
+    }
+    key_prefix(x, &xl, &xt);
+
+    for (unsigned l = 0; l < t->levels; ++l) {
+        size_t g = t->level_start[l] + unit;
+        const bignum_btree_node_t *node = &t->nodes[g];
+        size_t c = count_slots(t->keys, node->top, node->len,
+                               &t->sep_idx[g * BIGNUM_BTREE_FANOUT], 0, x, xl, xt, upper);
+        unit = unit * CHILDREN + c;
+    }
+
+    size_t base = unit * BIGNUM_BTREE_LEAF;
+    return base + count_slots(t->keys, &t->leaf_top[base], &t->leaf_len[base],
+                              NULL, base, x, xl, xt, upper);
+}
+
+/** Дорожка пакетного поиска: следующий узел уровня `level` (`levels` — лист) с номером `unit`. */
+typedef struct {
+    const bignum_t *x;
+    size_t          q;                  /**< Номер запроса в пакете. */
+    size_t          unit;
+    unsigned        level;
+    int16_t         xl;
+    uint64_t        xt;
+} search_lane_t;
+
+/** Запрашивает строки следующего узла дорожки (3 строки узла или листа). */
+static inline void lane_prefetch(const bignum_btree_t *t, const search_lane_t *ln)
+{
+    if (ln->level < t->levels) {
+        const char *node = (const char *)&t->nodes[t->level_start[ln->level] + ln->unit];
+        __builtin_prefetch(node);
+        __builtin_prefetch(node + 64);
+        __builtin_prefetch(node + 128);
+    } else {
+        size_t base = ln->unit * BIGNUM_BTREE_LEAF;
+        __builtin_prefetch(&t->leaf_top[base]);
+        __builtin_prefetch(&t->leaf_top[base + 8]);
+        __builtin_prefetch(&t->leaf_len[base]);
+    }
+}
+
+static inline void lane_start(const bignum_btree_t *t, search_lane_t *ln, const bignum_t *xs, size_t q, size_t m)
+{
+    if (q + INFLIGHT < m) {
+        __builtin_prefetch(&xs[q + INFLIGHT].len);
+        __builtin_prefetch(&xs[q + INFLIGHT].words[0]);
+    }
+    ln->x     = &xs[q];
+    ln->q     = q;
+    ln->unit  = 0;
+    ln->level = 0;
+    key_prefix(ln->x, &ln->xl, &ln->xt);
+    lane_prefetch(t, ln);
+}
+
+/** Один шаг дорожки; `1`, если запрос завершён и ответ записан в `*out`. */
+static inline int lane_step(const bignum_btree_t *t, search_lane_t *ln, int upper, size_t *out)
+{
+    if (ln->level < t->levels) {
+        size_t g = t->level_start[ln->level] + ln->unit;
+        const bignum_btree_node_t *node = &t->nodes[g];
+        size_t c = count_slots(t->keys, node->top, node->len,
+                               &t->sep_idx[g * BIGNUM_BTREE_FANOUT], 0, ln->x, ln->xl, ln->xt, upper);
+        ln->unit = ln->unit * CHILDREN + c;
+        ln->level++;
+        lane_prefetch(t, ln);
+        return 0;
+    }
+    size_t base = ln->unit * BIGNUM_BTREE_LEAF;
+    *out = base + count_slots(t->keys, &t->leaf_top[base], &t->leaf_len[base],
+                              NULL, base, ln->x, ln->xl, ln->xt, upper);
+    return 1;
+}
+
+static void search_batch(const bignum_btree_t *t, const bignum_t *xs, size_t m, size_t *pos, int upper)
+{
+    search_lane_t lanes[INFLIGHT];
+    size_t next = 0, active = 0;
+
+    if (t->n == 0) {
+        memset(pos, 0, m * sizeof(size_t));
+        return;
+    }
+    while (active < INFLIGHT && next < m) {
+        lane_start(t, &lanes[active++], xs, next++, m);
+    }
+    while (active > 0) {
+        for (size_t k = 0; k < active; ) {
+            search_lane_t *ln = &lanes[k];
+            if (lane_step(t, ln, upper, &pos[ln->q])) {
+                if (next < m) {
+                    lane_start(t, ln, xs, next++, m);
+                } else {
+                    *ln = lanes[--active];
+                    continue;
+                }
+            }
+            ++k;
+        }
+    }
+}
+
+static void *alloc_lines(size_t bytes)
+{
+    size_t rounded = (bytes + 63) & ~(size_t)63;
+    return aligned_alloc(64, rounded ? rounded : 64);
+}
+
+void bignum_btree_free(bignum_btree_t *t)
+{
+    if (t == NULL) {
+        return;
+    }
+    free(t->leaf_top);
+    free(t->leaf_len);
+    free(t->nodes);
+    free(t->sep_idx);
+    memset(t, 0, sizeof(*t));
+}
+
+bignum_btree_status_t bignum_btree_build(bignum_btree_t *t, const bignum_t *keys, size_t n)
+{
+    if (t == NULL) {
+        return BIGNUM_BTREE_ERROR_NULL;
+    }
+    memset(t, 0, sizeof(*t));
+    if (keys == NULL && n > 0) {
+        return BIGNUM_BTREE_ERROR_NULL;
+    }
+    if (n > UINT32_MAX) {
+        return BIGNUM_BTREE_ERROR_RANGE;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (keys[i].len > BIGNUM_CAPACITY) {
+            return BIGNUM_BTREE_ERROR_RANGE;
+        }
+        if (i > 0 && bignum_cmp(&keys[i - 1], &keys[i]) > 0) {
+            return BIGNUM_BTREE_ERROR_UNSORTED;
+        }
+    }
+    t->keys = keys;
+    t->n    = n;
+    if (n == 0) {
+        return BIGNUM_BTREE_OK;
+    }
+
+    /* Листья: префиксы всех ключей, хвост последнего листа — пустые слоты. */
+    size_t leaves = (n + BIGNUM_BTREE_LEAF - 1) / BIGNUM_BTREE_LEAF;
+    size_t padded = leaves * BIGNUM_BTREE_LEAF;
+    t->leaf_top = alloc_lines(padded * sizeof(uint64_t));
+    t->leaf_len = alloc_lines(padded * sizeof(int16_t));
+    if (t->leaf_top == NULL || t->leaf_len == NULL) {
+        bignum_btree_free(t);
+        return BIGNUM_BTREE_ERROR_NOMEM;
+    }
+    for (size_t i = 0; i < padded; ++i) {
+        if (i < n) {
+            key_prefix(&keys[i], &t->leaf_len[i], &t->leaf_top[i]);
+        } else {
+            t->leaf_len[i] = EMPTY_LEN;
+            t->leaf_top[i] = UINT64_MAX;
+        }
+    }
+
+    /* Размеры уровней снизу вверх, затем раскладка от корня. */
+    size_t counts[BIGNUM_BTREE_MAX_LEVELS];
+    unsigned levels = 0;
+    for (size_t m = leaves; m > 1; ) {
+        m = (m + CHILDREN - 1) / CHILDREN;
+        counts[levels++] = m;
+    }
+    t->levels = levels;
+    size_t total = 0;
+    for (unsigned l = 0; l < levels; ++l) {
+        t->level_start[l] = total;
+        total += counts[levels - 1 - l];
+    }
+    t->node_count = total;
+    if (total == 0) {
+        return BIGNUM_BTREE_OK;
+    }
+
+    t->nodes   = alloc_lines(total * sizeof(bignum_btree_node_t));
+    t->sep_idx = alloc_lines(total * BIGNUM_BTREE_FANOUT * sizeof(uint32_t));
+    if (t->nodes == NULL || t->sep_idx == NULL) {
+        bignum_btree_free(t);
+        return BIGNUM_BTREE_ERROR_NOMEM;
+    }
+
+    /* span — листьев в поддереве ребёнка узла уровня l. */
+    size_t span = 1;
+    for (unsigned l = levels; l-- > 0; ) {
+        size_t below = (l + 1 < levels) ? counts[levels - 2 - l] : leaves;
+        size_t here  = counts[levels - 1 - l];
+        for (size_t i = 0; i < here; ++i) {
+            size_t g = t->level_start[l] + i;
+            bignum_btree_node_t *node = &t->nodes[g];
+            memset(node, 0, sizeof(*node));
+            for (unsigned j = 0; j < BIGNUM_BTREE_FANOUT; ++j) {
+                size_t child = i * CHILDREN + j + 1;
+                if (child < below) {
+                    size_t k = child * span * BIGNUM_BTREE_LEAF;
+                    node->len[j] = t->leaf_len[k];
+                    node->top[j] = t->leaf_top[k];
+                    t->sep_idx[g * BIGNUM_BTREE_FANOUT + j] = (uint32_t)k;
+                } else {
+                    node->len[j] = EMPTY_LEN;
+                    node->top[j] = UINT64_MAX;
+                    t->sep_idx[g * BIGNUM_BTREE_FANOUT + j] = 0;
+                }
+            }
+        }
+        span *= CHILDREN;
+    }
+    return BIGNUM_BTREE_OK;
+}
+
+bignum_btree_status_t bignum_btree_lower_bound(const bignum_btree_t *t, const bignum_t *x, size_t *pos)
+{
+    if (t == NULL || x == NULL || pos == NULL) {
+        return BIGNUM_BTREE_ERROR_NULL;
+    }
+    *pos = search(t, x, 0);
+    return BIGNUM_BTREE_OK;
+}
+
+bignum_btree_status_t bignum_btree_upper_bound(const bignum_btree_t *t, const bignum_t *x, size_t *pos)
+{
+    if (t == NULL || x == NULL || pos == NULL) {
+        return BIGNUM_BTREE_ERROR_NULL;
+    }
+    *pos = search(t, x, 1);
+    return BIGNUM_BTREE_OK;
+}
+
+int bignum_btree_find(const bignum_btree_t *t, const bignum_t *x, size_t *pos)
+{
+    if (t == NULL || x == NULL) {
+        return BIGNUM_BTREE_ERROR_NULL;
+    }
+    size_t i = search(t, x, 0);
+    if (pos != NULL) {
+        *pos = i;
+    }
+    return i < t->n && bignum_cmp(&t->keys[i], x) == 0;
+}
+
+bignum_btree_status_t bignum_btree_range(const bignum_btree_t *t, const bignum_t *lo, const bignum_t *hi,
+                                         size_t *first, size_t *last)
+{
+    if (t == NULL || first == NULL || last == NULL) {
+        return BIGNUM_BTREE_ERROR_NULL;
+    }
+    size_t a = (lo != NULL) ? search(t, lo, 0) : 0;
+    size_t b = (hi != NULL) ? search(t, hi, 0) : t->n;
+    *first = a;
+    *last  = (b > a) ? b : a;
+    return BIGNUM_BTREE_OK;
+}
+
+bignum_btree_status_t bignum_btree_lower_bound_batch(const bignum_btree_t *t, const bignum_t *xs, size_t m,
+                                                     size_t *pos)
+{
+    if (t == NULL || ((xs == NULL || pos == NULL) && m > 0)) {
+        return BIGNUM_BTREE_ERROR_NULL;
+    }
+    search_batch(t, xs, m, pos, 0);
+    return BIGNUM_BTREE_OK;
+}
+
+bignum_btree_status_t bignum_btree_upper_bound_batch(const bignum_btree_t *t, const bignum_t *xs, size_t m,
+                                                     size_t *pos)
+{
+    if (t == NULL || ((xs == NULL || pos == NULL) && m > 0)) {
+        return BIGNUM_BTREE_ERROR_NULL;
+    }
+    search_batch(t, xs, m, pos, 1);
+    return BIGNUM_BTREE_OK;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file    bignum_cmp_bucket.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация bucketize поверх статического B+-индекса разделителей.
+ *
+ * @details Номер корзины — `bignum_btree_upper_bound` по разделителям. Индекс
+ *          строится один раз на вызов и разделяется потоками; каждый поток
+ *          обходит свой отрезок `x` подряд, запрашивая элементы впереди
+ *          prefetch'ем.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ *   - rev. 2 (16.10.2026): Многопоточный вариант выполняется в пуле `bignum_parallel_for`.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "bignum_cmp_bucket.h"
+#include "bignum_cmp_btree.h"
+#include "bignum_cmp_pool.h"
+#include <stdlib.h>
+
+#define PREFETCH    16                  /* элементов вперёд */
+#define MIN_CHUNK   16384               /* элементов на поток, не меньше */
+
+typedef struct {
+    const bignum_btree_t  *index;
+    const bignum_t        *x;
+    uint32_t              *out;
+    size_t                 start, end;
+    bignum_bucket_status_t st;
+} bucket_job_t;
+
+static bignum_bucket_status_t bucketize_range(const bignum_btree_t *index, const bignum_t *x,
+                                              size_t start, size_t end, uint32_t *out)
+{
+    for (size_t i = start; i < end; ++i) {
+        size_t pos;
+        __builtin_prefetch(&x[i + PREFETCH].len);
+        __builtin_prefetch(&x[i + PREFETCH].words[0]);
+        if (x[i].len > BIGNUM_CAPACITY) {
+            return BIGNUM_BUCKET_ERROR_RANGE;
+        }
+        bignum_btree_upper_bound(index, &x[i], &pos);
+        out[i] = (uint32_t)pos;
+    }
+    return BIGNUM_BUCKET_OK;
+}
+
+static void bucket_jobs(size_t begin, size_t end, void *arg)
+{
+    bucket_job_t *jobs = arg;
+    for (size_t t = begin; t < end; ++t) {
+        jobs[t].st = bucketize_range(jobs[t].index, jobs[t].x, jobs[t].start, jobs[t].end, jobs[t].out);
+    }
+}
+
+static bignum_bucket_status_t from_btree(bignum_btree_status_t st)
+{
+    switch (st) {
+    case BIGNUM_BTREE_OK:             return BIGNUM_BUCKET_OK;
+    case BIGNUM_BTREE_ERROR_UNSORTED: return BIGNUM_BUCKET_ERROR_UNSORTED;
+    case BIGNUM_BTREE_ERROR_NOMEM:    return BIGNUM_BUCKET_ERROR_NOMEM;
+    case BIGNUM_BTREE_ERROR_RANGE:    return BIGNUM_BUCKET_ERROR_RANGE;
+    default:                          return BIGNUM_BUCKET_ERROR_NULL;
+    }
+}
+
+bignum_bucket_status_t bignum_bucketize(const bignum_t *splitters, size_t k,
+                                        const bignum_t *x, size_t n, uint32_t *out)
+{
+    return bignum_bucketize_mt(splitters, k, x, n, 1, out);
+}
+
+bignum_bucket_status_t bignum_bucketize_mt(const bignum_t *splitters, size_t k,
+                                           const bignum_t *x, size_t n, unsigned threads,
+                                           uint32_t *out)
+{
+    if ((splitters == NULL && k > 0) || ((x == NULL || out == NULL) && n > 0)) {
+        return BIGNUM_BUCKET_ERROR_NULL;
+    }
+    if (k >= UINT32_MAX) {
+        return BIGNUM_BUCKET_ERROR_RANGE;
+    }
+
+    bignum_btree_t index;
+    bignum_bucket_status_t st = from_btree(bignum_btree_build(&index, splitters, k));
+    if (st != BIGNUM_BUCKET_OK || n == 0) {
+        bignum_btree_free(&index);
+        return st;
+    }
+
+    threads = bignum_pool_parts(threads, n, MIN_CHUNK);
+    if (threads == 1) {
+        st = bucketize_range(&index, x, 0, n, out);
+        bignum_btree_free(&index);
+        return st;
+    }
+
+    bucket_job_t *jobs = calloc(threads, sizeof(bucket_job_t));
+    if (jobs == NULL) {
+        bignum_btree_free(&index);
+        return BIGNUM_BUCKET_ERROR_NOMEM;
+    }
+    for (unsigned t = 0; t < threads; ++t) {
+        jobs[t].index = &index;
+        jobs[t].x     = x;
+        jobs[t].out   = out;
+        jobs[t].start = n * t / threads;
+        jobs[t].end   = n * (t + 1) / threads;
+    }
+
+    if (bignum_parallel_for(threads, 1, bucket_jobs, jobs) != BIGNUM_POOL_OK) {
+        st = BIGNUM_BUCKET_ERROR_THREAD;
+    }
+    for (unsigned t = 0; t < threads && st == BIGNUM_BUCKET_OK; ++t) {
+        st = jobs[t].st;
+    }
+
+    free(jobs);
+    bignum_btree_free(&index);
+    return st;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file    bignum_cmp_double.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация точного сравнения `bignum_t` с `double`.
+ *
+ * @details
+ * ### Разбор `double`
+ * `bits >> 52` — это 12 бит «знак | смещённый порядок» (`ex`). Положительное
+ * конечное `d >= 1` — это `1023 <= ex < 2047`; тогда
+ * `d = M · 2^(E-52)`, `M = frac | 2^52`, `E = ex - 1023`, битовая длина
+ * целой части `E + 1 = ex - 1022`. Остальное (знак, ноль, субнормальные и
+ * `d < 1`, бесконечности, NaN) разбирается отдельно.
+ *
+ * ### Равные битовые длины `B`
+ * - `B <= 64`: `a` — одно слово `A`, сравнение целочисленное без потерь:
+ *   `A << (53 - B)` с `M` или `A` с `M << (B - 53)` (сдвиг не больше 11).
+ * - `B > 64`: 64 старших бита `a` (`norm`), `T = norm >> 11` против `M`;
+ *   при равенстве `a > d` тогда и только тогда, когда ненулевой хоть один
+ *   бит ниже этих 53 (у `d` там нули).
+ *
+ * ### Пакет
+ * Блоками по `DBL_BLOCK` порядки извлекаются векторно: сдвиг `psrlq 52`,
+ * упаковка младших половин в 32-битные дорожки, маска `1023 <= ex < 2047`
+ * и `ex - 1022` под маской (для особых значений — 0).
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#include "bignum_cmp_double.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#  include <immintrin.h>
+#endif
+
+#define DBL_FRAC_MASK ((1ull << 52) - 1)
+#define DBL_BLOCK     64
+
+static inline int sign_u64(uint64_t x, uint64_t y)
+{
+    return (x > y) - (x < y);
+}
+
+static inline uint64_t dbl_bits(double d)
+{
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    return bits;
+}
+
+/** Длина без нулевых старших слов. */
+static inline size_t eff_len(const bignum_t *a)
+{
+    size_t len = a->len;
+    while (len > 0 && a->words[len - 1] == 0) {
+        --len;
+    }
+    return len;
+}
+
+static inline size_t bit_len(const bignum_t *a, size_t len)
+{
+    return len == 0 ? 0 : 64 * len - (size_t)__builtin_clzll(a->words[len - 1]);
+}
+
+/** Равные битовые длины `B >= 1`: 53 старших бита, затем хвост. */
+static int cmp_same_bits(const bignum_t *a, size_t len, size_t B, uint64_t M)
+{
+    if (B <= 64) {
+        uint64_t A = a->words[0];
+        return B <= 53 ? sign_u64(A << (53 - B), M) : sign_u64(A, M << (B - 53));
+    }
+    uint64_t hi   = a->words[len - 1], lo = a->words[len - 2];
+    unsigned lz   = (unsigned)__builtin_clzll(hi);
+    uint64_t norm = lz ? hi << lz | lo >> (64 - lz) : hi;
+    if ((norm >> 11) != M) {
+        return sign_u64(norm >> 11, M);
+    }
+    if ((norm & 0x7FF) != 0 || (lo << lz) != 0) {
+        return BIGNUM_CMP_GREATER;
+    }
+    for (size_t i = len - 2; i > 0; --i) {
+        if (a->words[i - 1] != 0) {
+            return BIGNUM_CMP_GREATER;
+        }
+    }
+    return BIGNUM_CMP_EQ;
+}
+
+/** Сравнение с `d`, заданным битами; `len` и `B` уже посчитаны. */
+static int cmp_bits(const bignum_t *a, size_t len, size_t B, uint64_t bits)
+{
+    unsigned ex   = (unsigned)(bits >> 52);
+    uint64_t frac = bits & DBL_FRAC_MASK;
+    if ((ex & 0x7FF) == 0x7FF) {
+        if (frac != 0) {
+            return BIGNUM_DBL_ERROR_NAN;
+        }
+        return (ex >> 11) ? BIGNUM_CMP_GREATER : BIGNUM_CMP_LESS;
+    }
+    if (ex >> 11) {                             /* d <= -0.0 */
+        return (B == 0 && ex == 0x800 && frac == 0) ? BIGNUM_CMP_EQ : BIGNUM_CMP_GREATER;
+    }
+    if (ex < 1023) {                            /* 0 <= d < 1 */
+        if (B > 0) {
+            return BIGNUM_CMP_GREATER;
+        }
+        return (ex == 0 && frac == 0) ? BIGNUM_CMP_EQ : BIGNUM_CMP_LESS;
+    }
+    size_t dbits = (size_t)ex - 1022;
+    if (B != dbits) {
+        return B > dbits ? BIGNUM_CMP_GREATER : BIGNUM_CMP_LESS;
+    }
+    return cmp_same_bits(a, len, B, frac | (1ull << 52));
+}
+
+int bignum_cmp_double(const bignum_t *a, double d)
+{
+    if (a == NULL) {
+        return BIGNUM_DBL_ERROR_NULL;
+    }
+    if (a->len > BIGNUM_CAPACITY) {
+        return BIGNUM_DBL_ERROR_RANGE;
+    }
+    size_t len = eff_len(a);
+    return cmp_bits(a, len, bit_len(a, len), dbl_bits(d));
+}
+
+/** Битовые длины целой части для `1 <= d < inf`, иначе 0. */
+static void extract_dbits(const double *d, size_t m, uint32_t *db)
+{
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    for (; i + 4 <= m; i += 4) {
+        __m256i v  = _mm256_srli_epi64(_mm256_castpd_si256(_mm256_loadu_pd(d + i)), 52);
+        __m128i ex = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, pack));
+        __m128i ok = _mm_and_si128(_mm_cmpgt_epi32(ex, _mm_set1_epi32(1022)),
+                                   _mm_cmplt_epi32(ex, _mm_set1_epi32(2047)));
+        _mm_storeu_si128((__m128i *)(void *)(db + i), _mm_and_si128(ok, _mm_sub_epi32(ex, _mm_set1_epi32(1022))));
+    }
+#endif
+#if defined(__SSE2__)
+    for (; i + 2 <= m; i += 2) {
+        __m128i v  = _mm_srli_epi64(_mm_castpd_si128(_mm_loadu_pd(d + i)), 52);
+        __m128i ex = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0));
+        __m128i ok = _mm_and_si128(_mm_cmpgt_epi32(ex, _mm_set1_epi32(1022)),
+                                   _mm_cmplt_epi32(ex, _mm_set1_epi32(2047)));
+        _mm_storel_epi64((__m128i *)(void *)(db + i), _mm_and_si128(ok, _mm_sub_epi32(ex, _mm_set1_epi32(1022))));
+    }
+#endif
+    for (; i < m; ++i) {
+        unsigned ex = (unsigned)(dbl_bits(d[i]) >> 52);
+        db[i] = (ex >= 1023 && ex < 2047) ? ex - 1022 : 0;
+    }
+}
+
+bignum_dbl_status_t bignum_cmp_double_batch(const bignum_t *a, const double *d, size_t n, int8_t *out)
+{
+    if (n == 0) {
+        return BIGNUM_DBL_OK;
+    }
+    if (a == NULL || d == NULL || out == NULL) {
+        return BIGNUM_DBL_ERROR_NULL;
+    }
+
+    uint32_t db[DBL_BLOCK];
+    for (size_t base = 0; base < n; base += DBL_BLOCK) {
+        size_t m = n - base < DBL_BLOCK ? n - base : DBL_BLOCK;
+        extract_dbits(d + base, m, db);
+        for (size_t k = 0; k < m; ++k) {
+            const bignum_t *x = &a[base + k];
+            if (base + k + 1 < n) {
+                /* len следующего числа лежит в отдельной кэш-линии за words. */
+                __builtin_prefetch(&a[base + k + 1].len);
+            }
+            if (x->len > BIGNUM_CAPACITY) {
+                return BIGNUM_DBL_ERROR_RANGE;
+            }
+            size_t len = eff_len(x);
+            size_t B   = bit_len(x, len);
+            if (db[k] != 0 && B != db[k]) {
+                out[base + k] = B > db[k] ? BIGNUM_CMP_GREATER : BIGNUM_CMP_LESS;
+                continue;
+            }
+            int r = cmp_bits(x, len, B, dbl_bits(d[base + k]));
+            if (r == BIGNUM_DBL_ERROR_NAN) {
+                return BIGNUM_DBL_ERROR_NAN;
+            }
+            out[base + k] = (int8_t)r;
+        }
+    }
+    return BIGNUM_DBL_OK;
+}
@@ -0,0 +1,582 @@
+/**
+ * @file    bignum_cmp_filter.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация блочного фильтра Блума и binary fuse фильтра.
+ *
+ * @details **Блум.** Старшие биты хеша выбирают блок (`mulhi(h, nblocks)`),
+ *          младшие 32 бита, умноженные на 8 нечётных «солей», дают номер бита
+ *          в каждом из 8 слов блока (как в split-block фильтре Parquet).
+ *
+ *          **Binary fuse.** Позиции ключа: `h0 = mulhi(h, segment_count_length)`,
+ *          `h1`, `h2` — та же позиция в двух следующих сегментах с
+ *          перемешанным смещением. Построение — «очистка» 3-гиперграфа:
+ *          для каждой ячейки хранятся число ключей (`count >> 2`), xor
+ *          номеров позиций (`count & 3`) и xor хешей; ячейки с одним ключом
+ *          снимаются в стек, затем отпечатки назначаются в обратном порядке.
+ *          Хеши сортируются перед построением: `h0` монотонен по хешу, поэтому
+ *          обход идёт по массиву почти последовательно, а дубликаты ключей
+ *          становятся соседями и удаляются. При неудаче очистки берётся
+ *          следующее зерно.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#include "bignum_cmp_filter.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FILTER_MAGIC      0x4C464E42u   /* "BNFL" */
+#define FILTER_VERSION    1u
+#define KIND_BLOOM        1u
+#define KIND_FUSE         2u
+#define DEFAULT_SEED      0x13198A2E03707344ull
+#define FUSE_MAX_ATTEMPTS 64
+#define BATCH             16
+#define INV_LOG2_3_33     2474740659ull         /* 2^32 / log2(3.33) */
+#define LOG2_1E6_Q58      1436220876507485448ull /* 0.25 * log2(10^6) * 2^58 */
+
+_Static_assert(BIGNUM_BLOOM_BLOCK_WORDS == 8, "bloom salts assume 8 words per block");
+
+/** Заголовок образа; данные фильтра начинаются сразу за ним. */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t kind;
+    uint64_t seed;
+    uint64_t param[4];      /**< Блум: nblocks; fuse: size, segment_length, segment_count_length, array_length. */
+    uint64_t payload;       /**< Байт данных (без выравнивающего хвоста). */
+    uint64_t reserved;
+} filter_header_t;
+
+_Static_assert(sizeof(filter_header_t) == BIGNUM_FILTER_HEADER_SIZE, "header is one cache line");
+
+static const uint32_t BLOOM_SALT[BIGNUM_BLOOM_BLOCK_WORDS] = {
+    0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+    0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u
+};
+
+/** Старшие 64 бита произведения `a * b`. */
+static inline uint64_t mulhi64(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 u128;
+    return (uint64_t)(((u128)a * b) >> 64);
+#else
+    uint64_t al = (uint32_t)a, ah = a >> 32, bl = (uint32_t)b, bh = b >> 32;
+    uint64_t mid = (al * bl >> 32) + (uint32_t)(ah * bl) + al * bh;
+    return ah * bh + (ah * bl >> 32) + (mid >> 32);
+#endif
+}
+
+static inline size_t round_lines(size_t bytes)
+{
+    return (bytes + 63) & ~(size_t)63;
+}
+
+static void *alloc_lines(size_t bytes)
+{
+    size_t rounded = round_lines(bytes);
+    return aligned_alloc(64, rounded ? rounded : 64);
+}
+
+static bignum_filter_status_t write_image(const filter_header_t *hdr, const void *data,
+                                          void *buf, size_t cap, size_t *written)
+{
+    size_t total = BIGNUM_FILTER_HEADER_SIZE + round_lines((size_t)hdr->payload);
+    if (cap < total) {
+        return BIGNUM_FILTER_ERROR_RANGE;
+    }
+    memcpy(buf, hdr, sizeof(*hdr));
+    memcpy((uint8_t *)buf + BIGNUM_FILTER_HEADER_SIZE, data, (size_t)hdr->payload);
+    memset((uint8_t *)buf + BIGNUM_FILTER_HEADER_SIZE + hdr->payload, 0,
+           total - BIGNUM_FILTER_HEADER_SIZE - (size_t)hdr->payload);
+    if (written != NULL) {
+        *written = total;
+    }
+    return BIGNUM_FILTER_OK;
+}
+
+/** Проверяет заголовок образа; возвращает указатель на данные или `NULL`. */
+static const void *read_image(filter_header_t *hdr, const void *buf, size_t len, unsigned kind, size_t *consumed)
+{
+    if (((uintptr_t)buf & 7u) != 0 || len < BIGNUM_FILTER_HEADER_SIZE) {
+        return NULL;
+    }
+    memcpy(hdr, buf, sizeof(*hdr));
+    if (hdr->magic != FILTER_MAGIC || hdr->version != FILTER_VERSION || hdr->kind != kind ||
+        hdr->payload > len - BIGNUM_FILTER_HEADER_SIZE) {
+        return NULL;
+    }
+    if (consumed != NULL) {
+        size_t total = BIGNUM_FILTER_HEADER_SIZE + round_lines((size_t)hdr->payload);
+        *consumed = (total <= len) ? total : len;
+    }
+    return (const uint8_t *)buf + BIGNUM_FILTER_HEADER_SIZE;
+}
+
+/* ---- Блочный фильтр Блума ---- */
+
+static inline const uint64_t *bloom_block(const bignum_bloom_t *b, uint64_t h)
+{
+    return b->blocks + mulhi64(h, b->nblocks) * BIGNUM_BLOOM_BLOCK_WORDS;
+}
+
+static inline int bloom_test(const uint64_t *block, uint64_t h)
+{
+    uint32_t x   = (uint32_t)h;
+    uint64_t all = 1;
+    for (unsigned j = 0; j < BIGNUM_BLOOM_BLOCK_WORDS; ++j) {
+        all &= block[j] >> ((x * BLOOM_SALT[j]) >> 26);
+    }
+    return (int)all;
+}
+
+bignum_filter_status_t bignum_bloom_init(bignum_bloom_t *b, size_t expected, unsigned bits_per_key)
+{
+    if (b == NULL) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    memset(b, 0, sizeof(*b));
+    if (bits_per_key == 0) {
+        return BIGNUM_FILTER_ERROR_RANGE;
+    }
+    size_t block_bits = BIGNUM_BLOOM_BLOCK_WORDS * 64;
+    if (expected > SIZE_MAX / bits_per_key - block_bits) {
+        return BIGNUM_FILTER_ERROR_RANGE;
+    }
+    size_t nblocks = (expected * bits_per_key + block_bits - 1) / block_bits;
+    if (nblocks == 0) {
+        nblocks = 1;
+    }
+    b->owned = alloc_lines(nblocks * BIGNUM_BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+    if (b->owned == NULL) {
+        return BIGNUM_FILTER_ERROR_NOMEM;
+    }
+    memset(b->owned, 0, nblocks * BIGNUM_BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+    b->blocks  = b->owned;
+    b->nblocks = nblocks;
+    b->seed    = DEFAULT_SEED;
+    return BIGNUM_FILTER_OK;
+}
+
+bignum_filter_status_t bignum_bloom_add(bignum_bloom_t *b, const bignum_t *x)
+{
+    if (b == NULL || x == NULL || b->blocks == NULL) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    if (b->owned == NULL) {
+        return BIGNUM_FILTER_ERROR_READONLY;
+    }
+    if (x->len > BIGNUM_CAPACITY) {
+        return BIGNUM_FILTER_ERROR_RANGE;
+    }
+    uint64_t  h     = bignum_hash64(x, b->seed);
+    uint64_t *block = b->owned + (bloom_block(b, h) - b->blocks);
+    uint32_t  k     = (uint32_t)h;
+    for (unsigned j = 0; j < BIGNUM_BLOOM_BLOCK_WORDS; ++j) {
+        block[j] |= 1ull << ((k * BLOOM_SALT[j]) >> 26);
+    }
+    return BIGNUM_FILTER_OK;
+}
+
+int bignum_bloom_contains(const bignum_bloom_t *b, const bignum_t *x)
+{
+    if (b == NULL || x == NULL || b->blocks == NULL) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    uint64_t h = bignum_hash64(x, b->seed);
+    return bloom_test(bloom_block(b, h), h);
+}
+
+bignum_filter_status_t bignum_bloom_contains_batch(const bignum_bloom_t *b, const bignum_t *xs, size_t n, uint8_t *out)
+{
+    if (b == NULL || b->blocks == NULL || ((xs == NULL || out == NULL) && n > 0)) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    const uint64_t *blk[BATCH];
+    uint64_t        h[BATCH];
+
+    for (size_t i = 0; i < n; i += BATCH) {
+        size_t m = (n - i < BATCH) ? n - i : BATCH;
+        for (size_t k = 0; k < m; ++k) {
+            h[k]   = bignum_hash64(&xs[i + k], b->seed);
+            blk[k] = bloom_block(b, h[k]);
+            __builtin_prefetch(blk[k]);
+        }
+        for (size_t k = 0; k < m; ++k) {
+            out[i + k] = (uint8_t)bloom_test(blk[k], h[k]);
+        }
+    }
+    return BIGNUM_FILTER_OK;
+}
+
+size_t bignum_bloom_serialized_size(const bignum_bloom_t *b)
+{
+    if (b == NULL) {
+        return 0;
+    }
+    return BIGNUM_FILTER_HEADER_SIZE + round_lines(b->nblocks * BIGNUM_BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+}
+
+bignum_filter_status_t bignum_bloom_serialize(const bignum_bloom_t *b, void *buf, size_t cap, size_t *written)
+{
+    if (b == NULL || buf == NULL || b->blocks == NULL) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    filter_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic    = FILTER_MAGIC;
+    hdr.version  = FILTER_VERSION;
+    hdr.kind     = KIND_BLOOM;
+    hdr.seed     = b->seed;
+    hdr.param[0] = b->nblocks;
+    hdr.payload  = b->nblocks * BIGNUM_BLOOM_BLOCK_WORDS * sizeof(uint64_t);
+    return write_image(&hdr, b->blocks, buf, cap, written);
+}
+
+bignum_filter_status_t bignum_bloom_view(bignum_bloom_t *b, const void *buf, size_t len, size_t *consumed)
+{
+    if (b == NULL || buf == NULL) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    memset(b, 0, sizeof(*b));
+    filter_header_t hdr;
+    const void *data = read_image(&hdr, buf, len, KIND_BLOOM, consumed);
+    if (data == NULL || hdr.param[0] == 0 ||
+        hdr.param[0] != hdr.payload / (BIGNUM_BLOOM_BLOCK_WORDS * sizeof(uint64_t)) ||
+        hdr.payload % (BIGNUM_BLOOM_BLOCK_WORDS * sizeof(uint64_t)) != 0) {
+        return BIGNUM_FILTER_ERROR_FORMAT;
+    }
+    b->blocks  = data;
+    b->nblocks = (size_t)hdr.param[0];
+    b->seed    = hdr.seed;
+    return BIGNUM_FILTER_OK;
+}
+
+void bignum_bloom_free(bignum_bloom_t *b)
+{
+    if (b == NULL) {
+        return;
+    }
+    free(b->owned);
+    memset(b, 0, sizeof(*b));
+}
+
+/* ---- Binary fuse фильтр ---- */
+
+static inline uint8_t fuse_fingerprint(uint64_t h)
+{
+    return (uint8_t)(h ^ (h >> 32));
+}
+
+static inline void fuse_positions(const bignum_fuse_t *f, uint64_t h, size_t pos[3])
+{
+    uint64_t h0 = mulhi64(h, f->segment_count_length);
+    uint64_t h1 = h0 + f->segment_length;
+    uint64_t h2 = h1 + f->segment_length;
+    h1 ^= (h >> 18) & f->segment_length_mask;
+    h2 ^= h & f->segment_length_mask;
+    pos[0] = (size_t)h0;
+    pos[1] = (size_t)h1;
+    pos[2] = (size_t)h2;
+}
+
+/** `log2(n)` в формате Q32 (`n > 0`): целая часть — `clz`, дробь — возведением мантиссы в квадрат. */
+static uint64_t log2_q32(uint64_t n)
+{
+    unsigned ip = 63u - (unsigned)__builtin_clzll(n);
+    uint64_t m  = ip >= 31 ? n >> (ip - 31) : n << (31 - ip);   /* Q31, [1, 2) */
+    uint64_t r  = (uint64_t)ip << 32;
+    for (uint64_t bit = 1ull << 31; bit != 0; bit >>= 1) {
+        m = (m * m) >> 31;
+        if (m >= (2ull << 31)) {
+            m >>= 1;
+            r |= bit;
+        }
+    }
+    return r;
+}
+
+/**
+ * Параметры размеров из эталонной реализации binary fuse (арность 3):
+ * `segment_length = 2^floor(log_3.33(n) + 2.25)`,
+ * `capacity = n · max(1.125, 0.875 + 0.25 · ln(10^6) / ln(n))`.
+ * Считается в фиксированной точке без libm (объект линкуется без `-lm`).
+ */
+static void fuse_layout(bignum_fuse_t *f, size_t n)
+{
+    uint32_t sl = 4;
+    size_t capacity = 0;
+    if (n > 0) {
+        uint64_t l = log2_q32(n);
+        uint64_t e = (mulhi64(l << 26, INV_LOG2_3_33) + (9ull << 24)) >> 26;   /* + 2.25 в Q26 */
+        sl = (e >= 18) ? 262144u : (1u << (unsigned)e);
+        if (n > 1) {
+            uint64_t factor = (7ull << 29) + LOG2_1E6_Q58 / (l >> 6);        /* Q32 */
+            if (factor < (9ull << 29)) {
+                factor = 9ull << 29;                                        /* 1.125 */
+            }
+            uint64_t frac = factor << 32;
+            capacity = (size_t)(n * (factor >> 32) + mulhi64(n, frac) + ((n * frac) >> 63));
+        }
+    }
+    size_t segments = (capacity + sl - 1) / sl;
+    segments = (segments > 2) ? segments - 2 : 1;
+
+    f->segment_length       = sl;
+    f->segment_length_mask  = sl - 1;
+    f->segment_count_length = segments * sl;
+    f->array_length         = (segments + 2) * sl;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/** Одна попытка очистки гиперграфа; при успехе заполняет `fp`. */
+static int fuse_peel(const bignum_fuse_t *f, const uint64_t *hashes, size_t n,
+                     uint8_t *count, uint64_t *xorh, size_t *queue,
+                     uint64_t *stack_h, uint8_t *stack_j, uint8_t *fp)
+{
+    size_t len = f->array_length;
+    memset(count, 0, len);
+    memset(xorh, 0, len * sizeof(uint64_t));
+
+    for (size_t i = 0; i < n; ++i) {
+        size_t p[3];
+        fuse_positions(f, hashes[i], p);
+        for (unsigned j = 0; j < 3; ++j) {
+            if (count[p[j]] >= 0xFC) {
+                return 0;                       /* переполнение счётчика */
+            }
+            count[p[j]] = (uint8_t)((count[p[j]] + 4) ^ j);
+            xorh[p[j]] ^= hashes[i];
+        }
+    }
+
+    size_t qn = 0;
+    for (size_t i = 0; i < len; ++i) {
+        if ((count[i] >> 2) == 1) {
+            queue[qn++] = i;
+        }
+    }
+
+    size_t sn = 0;
+    while (qn > 0) {
+        size_t c = queue[--qn];
+        if ((count[c] >> 2) != 1) {
+            continue;
+        }
+        uint64_t h = xorh[c];
+        unsigned found = count[c] & 3;
+        stack_h[sn] = h;
+        stack_j[sn] = (uint8_t)found;
+        sn++;
+
+        size_t p[3];
+        fuse_positions(f, h, p);
+        for (unsigned j = 0; j < 3; ++j) {
+            size_t o = p[j];
+            count[o] = (uint8_t)((count[o] - 4) ^ j);
+            xorh[o] ^= h;
+            if (j != found && (count[o] >> 2) == 1) {
+                queue[qn++] = o;
+            }
+        }
+    }
+    if (sn != n) {
+        return 0;
+    }
+
+    memset(fp, 0, len);
+    while (sn-- > 0) {
+        size_t p[3];
+        unsigned j = stack_j[sn];
+        fuse_positions(f, stack_h[sn], p);
+        fp[p[j]] = (uint8_t)(fuse_fingerprint(stack_h[sn]) ^ fp[p[(j + 1) % 3]] ^ fp[p[(j + 2) % 3]]);
+    }
+    return 1;
+}
+
+bignum_filter_status_t bignum_fuse_build(bignum_fuse_t *f, const bignum_t *keys, size_t n)
+{
+    if (f == NULL || (keys == NULL && n > 0)) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    memset(f, 0, sizeof(*f));
+    for (size_t i = 0; i < n; ++i) {
+        if (keys[i].len > BIGNUM_CAPACITY) {
+            return BIGNUM_FILTER_ERROR_RANGE;
+        }
+    }
+
+    /* Раскладка по верхней оценке n; после удаления дубликатов пересчитывается. */
+    fuse_layout(f, n);
+    size_t    cap     = f->array_length;
+    uint64_t *hashes  = malloc((n ? n : 1) * sizeof(uint64_t));
+    uint64_t *stack_h = malloc((n ? n : 1) * sizeof(uint64_t));
+    uint8_t  *stack_j = malloc(n ? n : 1);
+    uint8_t  *count   = malloc(cap);
+    uint64_t *xorh    = malloc(cap * sizeof(uint64_t));
+    size_t   *queue   = malloc(cap * sizeof(size_t) * 3);
+    uint8_t  *fp      = alloc_lines(cap);
+
+    bignum_filter_status_t st = BIGNUM_FILTER_ERROR_NOMEM;
+    if (hashes && stack_h && stack_j && count && xorh && queue && fp) {
+        st = BIGNUM_FILTER_ERROR_BUILD;
+        for (unsigned attempt = 0; attempt < FUSE_MAX_ATTEMPTS; ++attempt) {
+            uint64_t seed = bignum_hash_fmix64(DEFAULT_SEED + attempt);
+            for (size_t i = 0; i < n; ++i) {
+                hashes[i] = bignum_hash64(&keys[i], seed);
+            }
+            qsort(hashes, n, sizeof(uint64_t), cmp_u64);
+            size_t u = 0;
+            for (size_t i = 0; i < n; ++i) {
+                if (u == 0 || hashes[i] != hashes[u - 1]) {
+                    hashes[u++] = hashes[i];
+                }
+            }
+            fuse_layout(f, u);
+            f->size = u;
+            f->seed = seed;
+            if (f->array_length > cap) {
+                break;                          /* раскладка монотонна по n; страховка */
+            }
+            if (fuse_peel(f, hashes, u, count, xorh, queue, stack_h, stack_j, fp)) {
+                st = BIGNUM_FILTER_OK;
+                break;
+            }
+        }
+    }
+
+    free(hashes);
+    free(stack_h);
+    free(stack_j);
+    free(count);
+    free(xorh);
+    free(queue);
+    if (st != BIGNUM_FILTER_OK) {
+        free(fp);
+        memset(f, 0, sizeof(*f));
+        return st;
+    }
+    f->owned        = fp;
+    f->fingerprints = fp;
+    return BIGNUM_FILTER_OK;
+}
+
+static inline int fuse_test(const bignum_fuse_t *f, uint64_t h)
+{
+    size_t p[3];
+    fuse_positions(f, h, p);
+    return (uint8_t)(fuse_fingerprint(h) ^ f->fingerprints[p[0]] ^
+                     f->fingerprints[p[1]] ^ f->fingerprints[p[2]]) == 0;
+}
+
+int bignum_fuse_contains(const bignum_fuse_t *f, const bignum_t *x)
+{
+    if (f == NULL || x == NULL || f->fingerprints == NULL) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    if (f->size == 0) {
+        return 0;
+    }
+    return fuse_test(f, bignum_hash64(x, f->seed));
+}
+
+bignum_filter_status_t bignum_fuse_contains_batch(const bignum_fuse_t *f, const bignum_t *xs, size_t n, uint8_t *out)
+{
+    if (f == NULL || f->fingerprints == NULL || ((xs == NULL || out == NULL) && n > 0)) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    if (f->size == 0) {
+        memset(out, 0, n);
+        return BIGNUM_FILTER_OK;
+    }
+    uint64_t h[BATCH];
+
+    for (size_t i = 0; i < n; i += BATCH) {
+        size_t m = (n - i < BATCH) ? n - i : BATCH;
+        for (size_t k = 0; k < m; ++k) {
+            size_t p[3];
+            h[k] = bignum_hash64(&xs[i + k], f->seed);
+            fuse_positions(f, h[k], p);
+            __builtin_prefetch(&f->fingerprints[p[0]]);
+            __builtin_prefetch(&f->fingerprints[p[1]]);
+            __builtin_prefetch(&f->fingerprints[p[2]]);
+        }
+        for (size_t k = 0; k < m; ++k) {
+            out[i + k] = (uint8_t)fuse_test(f, h[k]);
+        }
+    }
+    return BIGNUM_FILTER_OK;
+}
+
+size_t bignum_fuse_serialized_size(const bignum_fuse_t *f)
+{
+    if (f == NULL) {
+        return 0;
+    }
+    return BIGNUM_FILTER_HEADER_SIZE + round_lines(f->array_length);
+}
+
+bignum_filter_status_t bignum_fuse_serialize(const bignum_fuse_t *f, void *buf, size_t cap, size_t *written)
+{
+    if (f == NULL || buf == NULL || f->fingerprints == NULL) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    filter_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic    = FILTER_MAGIC;
+    hdr.version  = FILTER_VERSION;
+    hdr.kind     = KIND_FUSE;
+    hdr.seed     = f->seed;
+    hdr.param[0] = f->size;
+    hdr.param[1] = f->segment_length;
+    hdr.param[2] = f->segment_count_length;
+    hdr.param[3] = f->array_length;
+    hdr.payload  = f->array_length;
+    return write_image(&hdr, f->fingerprints, buf, cap, written);
+}
+
+bignum_filter_status_t bignum_fuse_view(bignum_fuse_t *f, const void *buf, size_t len, size_t *consumed)
+{
+    if (f == NULL || buf == NULL) {
+        return BIGNUM_FILTER_ERROR_NULL;
+    }
+    memset(f, 0, sizeof(*f));
+    filter_header_t hdr;
+    const void *data = read_image(&hdr, buf, len, KIND_FUSE, consumed);
+    if (data == NULL) {
+        return BIGNUM_FILTER_ERROR_FORMAT;
+    }
+    uint64_t sl = hdr.param[1];
+    if (sl == 0 || sl > 262144u || (sl & (sl - 1)) != 0 ||
+        hdr.param[2] == 0 || hdr.param[2] % sl != 0 ||
+        hdr.param[3] != hdr.param[2] + 2 * sl || hdr.payload != hdr.param[3]) {
+        return BIGNUM_FILTER_ERROR_FORMAT;
+    }
+    f->fingerprints         = data;
+    f->size                 = (size_t)hdr.param[0];
+    f->segment_length       = (uint32_t)sl;
+    f->segment_length_mask  = (uint32_t)sl - 1;
+    f->segment_count_length = (size_t)hdr.param[2];
+    f->array_length         = (size_t)hdr.param[3];
+    f->seed                 = hdr.seed;
+    return BIGNUM_FILTER_OK;
+}
+
+void bignum_fuse_free(bignum_fuse_t *f)
+{
+    if (f == NULL) {
+        return;
+    }
+    free(f->owned);
+    memset(f, 0, sizeof(*f));
+}
@@ -0,0 +1,305 @@
+/**
+ * @file    bignum_cmp_hmap.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация Swiss-table для ключей `bignum_t`.
+ *
+ * @details Хеш `h` делится на `h1 = h >> 7` (номер стартовой группы) и
+ *          `h2 = h & 0x7F` (отпечаток в контрольном байте). Группы выровнены
+ *          по 16 слотов и не пересекаются, поэтому зеркалирования контрольных
+ *          байт не требуется; треугольная последовательность групп при их
+ *          количестве-степени двойки обходит все группы.
+ *
+ *          Максимальная загрузка — 7/8 слотов. `DELETED` занимает слот до
+ *          перестройки; если в группе удалённого ключа уже есть `EMPTY`,
+ *          слот сразу становится `EMPTY` (поиск через эту группу и так не
+ *          проходил дальше).
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#include "bignum_cmp_hmap.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
+#define CTRL_EMPTY   ((uint8_t)0x80)
+#define CTRL_DELETED ((uint8_t)0xFE)
+#define MIN_CAPACITY ((size_t)BIGNUM_HMAP_GROUP)
+#define DEFAULT_SEED 0x243F6A8885A308D3ull
+
+_Static_assert(BIGNUM_HMAP_GROUP == 16, "group masks assume 16 control bytes");
+
+/** Маска слотов группы с контрольным байтом `c`. */
+static inline uint32_t group_match(const uint8_t *g, uint8_t c)
+{
+#if defined(__SSE2__)
+    __m128i v = _mm_loadu_si128((const __m128i *)g);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)c)));
+#else
+    uint32_t m = 0;
+    for (unsigned j = 0; j < BIGNUM_HMAP_GROUP; ++j) {
+        m |= (uint32_t)(g[j] == c) << j;
+    }
+    return m;
+#endif
+}
+
+/** Маска свободных слотов группы (`EMPTY` или `DELETED`, старший бит установлен). */
+static inline uint32_t group_free(const uint8_t *g)
+{
+#if defined(__SSE2__)
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)g));
+#else
+    uint32_t m = 0;
+    for (unsigned j = 0; j < BIGNUM_HMAP_GROUP; ++j) {
+        m |= (uint32_t)(g[j] >> 7) << j;
+    }
+    return m;
+#endif
+}
+
+static inline int keys_equal(const bignum_t *a, const bignum_t *b)
+{
+    return a->len == b->len && memcmp(a->words, b->words, a->len * sizeof(uint64_t)) == 0;
+}
+
+static inline size_t max_load(size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+/** Слот записи с хешем `h`, равной `key`; `SIZE_MAX`, если её нет. */
+static size_t find_slot(const bignum_hmap_t *m, const bignum_t *key, uint64_t h)
+{
+    const size_t  gmask = m->capacity / BIGNUM_HMAP_GROUP - 1;
+    const uint8_t h2    = (uint8_t)(h & 0x7F);
+    size_t        g     = (size_t)(h >> 7) & gmask;
+
+    for (size_t step = 1; ; ++step) {
+        const uint8_t *ctrl = m->ctrl + g * BIGNUM_HMAP_GROUP;
+        uint32_t match = group_match(ctrl, h2);
+        while (match != 0) {
+            size_t   s   = g * BIGNUM_HMAP_GROUP + (size_t)__builtin_ctz(match);
+            uint32_t idx = m->slots[s];
+            if (m->hashes[idx] == h && keys_equal(&m->keys[idx], key)) {
+                return s;
+            }
+            match &= match - 1;
+        }
+        if (group_match(ctrl, CTRL_EMPTY) != 0 || step > gmask + 1) {
+            return SIZE_MAX;
+        }
+        g = (g + step) & gmask;
+    }
+}
+
+/** Первый свободный (`EMPTY`/`DELETED`) слот на пути хеша `h`. */
+static size_t find_free(const bignum_hmap_t *m, uint64_t h)
+{
+    const size_t gmask = m->capacity / BIGNUM_HMAP_GROUP - 1;
+    size_t       g     = (size_t)(h >> 7) & gmask;
+
+    for (size_t step = 1; ; ++step) {
+        uint32_t f = group_free(m->ctrl + g * BIGNUM_HMAP_GROUP);
+        if (f != 0) {
+            return g * BIGNUM_HMAP_GROUP + (size_t)__builtin_ctz(f);
+        }
+        g = (g + step) & gmask;
+    }
+}
+
+/** Расширяет плотные массивы записей до `limit` элементов. */
+static int grow_entries(bignum_hmap_t *m, size_t limit)
+{
+    bignum_t *keys = realloc(m->keys, limit * sizeof(bignum_t));
+    if (keys == NULL) {
+        return 0;
+    }
+    m->keys = keys;
+    uint64_t *hashes = realloc(m->hashes, limit * sizeof(uint64_t));
+    if (hashes == NULL) {
+        return 0;
+    }
+    m->hashes = hashes;
+    if (m->values != NULL) {
+        uint64_t *values = realloc(m->values, limit * sizeof(uint64_t));
+        if (values == NULL) {
+            return 0;
+        }
+        m->values = values;
+    }
+    return 1;
+}
+
+/** Перестраивает таблицу слотов на `capacity` (записи и хеши не копируются). */
+static bignum_hmap_status_t rehash(bignum_hmap_t *m, size_t capacity)
+{
+    uint8_t  *ctrl  = malloc(capacity);
+    uint32_t *slots = malloc(capacity * sizeof(uint32_t));
+    size_t    limit = max_load(capacity);
+
+    if (ctrl == NULL || slots == NULL ||
+        (limit > max_load(m->capacity) && !grow_entries(m, limit))) {
+        free(ctrl);
+        free(slots);
+        return BIGNUM_HMAP_ERROR_NOMEM;
+    }
+
+    free(m->ctrl);
+    free(m->slots);
+    memset(ctrl, CTRL_EMPTY, capacity);
+    m->ctrl     = ctrl;
+    m->slots    = slots;
+    m->capacity = capacity;
+    for (size_t i = 0; i < m->size; ++i) {
+        size_t s = find_free(m, m->hashes[i]);
+        m->ctrl[s]  = (uint8_t)(m->hashes[i] & 0x7F);
+        m->slots[s] = (uint32_t)i;
+    }
+    m->growth_left = limit - m->size;
+    return BIGNUM_HMAP_OK;
+}
+
+bignum_hmap_status_t bignum_hmap_init(bignum_hmap_t *m, size_t expected, int with_values)
+{
+    if (m == NULL) {
+        return BIGNUM_HMAP_ERROR_NULL;
+    }
+    memset(m, 0, sizeof(*m));
+    if (expected > UINT32_MAX) {
+        return BIGNUM_HMAP_ERROR_RANGE;
+    }
+    size_t capacity = MIN_CAPACITY;
+    while (max_load(capacity) < expected) {
+        capacity *= 2;
+    }
+    m->seed = DEFAULT_SEED;
+    if (with_values) {
+        /* Ненулевой `values` — признак отображения; rehash() доведёт размер. */
+        m->values = malloc(max_load(capacity) * sizeof(uint64_t));
+        if (m->values == NULL) {
+            return BIGNUM_HMAP_ERROR_NOMEM;
+        }
+    }
+    bignum_hmap_status_t st = rehash(m, capacity);
+    if (st != BIGNUM_HMAP_OK) {
+        bignum_hmap_free(m);
+    }
+    return st;
+}
+
+void bignum_hmap_free(bignum_hmap_t *m)
+{
+    if (m == NULL) {
+        return;
+    }
+    free(m->ctrl);
+    free(m->slots);
+    free(m->keys);
+    free(m->values);
+    free(m->hashes);
+    memset(m, 0, sizeof(*m));
+}
+
+bignum_hmap_status_t bignum_hmap_insert(bignum_hmap_t *m, const bignum_t *key, uint64_t value, size_t *index)
+{
+    if (m == NULL || key == NULL || m->ctrl == NULL) {
+        return BIGNUM_HMAP_ERROR_NULL;
+    }
+    if (key->len > BIGNUM_CAPACITY) {
+        return BIGNUM_HMAP_ERROR_RANGE;
+    }
+    uint64_t h = bignum_hash64(key, m->seed);
+    size_t   s = find_slot(m, key, h);
+    if (s != SIZE_MAX) {
+        if (index != NULL) {
+            *index = m->slots[s];
+        }
+        return BIGNUM_HMAP_EXISTS;
+    }
+    if (m->size >= UINT32_MAX) {
+        return BIGNUM_HMAP_ERROR_RANGE;
+    }
+
+    s = find_free(m, h);
+    if (m->growth_left == 0 && m->ctrl[s] == CTRL_EMPTY) {
+        /* Много DELETED — чистим на той же ёмкости, иначе растём вдвое. */
+        size_t capacity = (m->size * 2 < max_load(m->capacity)) ? m->capacity : m->capacity * 2;
+        bignum_hmap_status_t st = rehash(m, capacity);
+        if (st != BIGNUM_HMAP_OK) {
+            return st;
+        }
+        s = find_free(m, h);
+    }
+
+    size_t i = m->size++;
+    if (m->ctrl[s] == CTRL_EMPTY) {
+        m->growth_left--;
+    }
+    m->ctrl[s]   = (uint8_t)(h & 0x7F);
+    m->slots[s]  = (uint32_t)i;
+    m->hashes[i] = h;
+    memcpy(&m->keys[i], key, sizeof(bignum_t));
+    if (m->values != NULL) {
+        m->values[i] = value;
+    }
+    if (index != NULL) {
+        *index = i;
+    }
+    return BIGNUM_HMAP_OK;
+}
+
+int bignum_hmap_find(const bignum_hmap_t *m, const bignum_t *key, size_t *index)
+{
+    if (m == NULL || key == NULL || m->ctrl == NULL) {
+        return BIGNUM_HMAP_ERROR_NULL;
+    }
+    size_t s = find_slot(m, key, bignum_hash64(key, m->seed));
+    if (s == SIZE_MAX) {
+        return 0;
+    }
+    if (index != NULL) {
+        *index = m->slots[s];
+    }
+    return 1;
+}
+
+bignum_hmap_status_t bignum_hmap_erase(bignum_hmap_t *m, const bignum_t *key)
+{
+    if (m == NULL || key == NULL || m->ctrl == NULL) {
+        return BIGNUM_HMAP_ERROR_NULL;
+    }
+    size_t s = find_slot(m, key, bignum_hash64(key, m->seed));
+    if (s == SIZE_MAX) {
+        return BIGNUM_HMAP_NOT_FOUND;
+    }
+
+    size_t group = s & ~(size_t)(BIGNUM_HMAP_GROUP - 1);
+    if (group_match(m->ctrl + group, CTRL_EMPTY) != 0) {
+        m->ctrl[s] = CTRL_EMPTY;
+        m->growth_left++;
+    } else {
+        m->ctrl[s] = CTRL_DELETED;
+    }
+
+    /* Последняя запись переезжает в освободившийся индекс. */
+    size_t hole = m->slots[s];
+    size_t last = --m->size;
+    if (hole != last) {
+        size_t ls = find_slot(m, &m->keys[last], m->hashes[last]);
+        m->slots[ls]    = (uint32_t)hole;
+        m->hashes[hole] = m->hashes[last];
+        memcpy(&m->keys[hole], &m->keys[last], sizeof(bignum_t));
+        if (m->values != NULL) {
+            m->values[hole] = m->values[last];
+        }
+    }
+    return BIGNUM_HMAP_OK;
+}
@@ -0,0 +1,413 @@
+/**
+ * @file    bignum_cmp_join.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация merge-join и операций над мультимножествами.
+ *
+ * @details Все операции — одно ядро `merge_range` с параметром `op`
+ *          (`OP_JOIN` для merge-join). Шаг без совпадения выводит меньший
+ *          элемент, если операция его сохраняет (`keep_a`/`keep_b`), и
+ *          продвигает соответствующий индекс; совпадение обрабатывается
+ *          целой группой равных ключей с обеих сторон.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ *   - rev. 2 (16.10.2026): Многопоточный вариант выполняется в пуле `bignum_parallel_for`.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "bignum_cmp_join.h"
+#include "bignum_cmp_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define OP_JOIN     (-1)
+#define PREFETCH    8                   /* элементов вперёд по каждому входу */
+#define MIN_CHUNK   65536               /* элементов на поток, не меньше */
+
+/** Приёмник результата: пары (merge-join) либо указатели (операции). */
+typedef struct {
+    bignum_join_pair_t *pairs;
+    const bignum_t    **refs;
+    size_t              cap;    /**< Ёмкость буфера. */
+    size_t              count;  /**< Выведено (может превышать `cap`). */
+    int                 grow;   /**< Буфер собственный и растёт. */
+    int                 join;   /**< Тип буфера: пары или указатели. */
+} sink_t;
+
+typedef struct {
+    const bignum_t *a, *b;
+    int             op;
+    int             bad;        /**< Встретился `len > BIGNUM_CAPACITY`. */
+    sink_t          s;
+} merge_t;
+
+/** Старшее слово; `len` вне `1..BIGNUM_CAPACITY` даёт 0. */
+static inline uint64_t top_of(const bignum_t *x, size_t len)
+{
+    return (len - 1 < BIGNUM_CAPACITY) ? x->words[len - 1] : 0;
+}
+
+/**
+ * @brief Сравнение: префикс — без ветвлений, `bignum_cmp` — только при равных
+ *        префиксах. Отмечает `len` вне диапазона в `m->bad`.
+ */
+static inline int cmp3(merge_t *m, const bignum_t *x, const bignum_t *y)
+{
+    size_t   xl = x->len, yl = y->len;
+    uint64_t xt = top_of(x, xl), yt = top_of(y, yl);
+    int c = ((xl > yl) - (xl < yl)) * 2 + ((xt > yt) - (xt < yt));
+    m->bad |= (xl > BIGNUM_CAPACITY) | (yl > BIGNUM_CAPACITY);
+    if (c != 0) {
+        return c;
+    }
+    return (xl - 1 < BIGNUM_CAPACITY) ? bignum_cmp(x, y) : 0;
+}
+
+/** Первая позиция в `[lo, hi)` с `v[pos] >= key`: экспоненциальный, затем двоичный поиск. */
+static size_t gallop(merge_t *m, const bignum_t *v, size_t lo, size_t hi, const bignum_t *key)
+{
+    if (lo >= hi || cmp3(m, &v[lo], key) >= 0) {
+        return lo;
+    }
+    size_t base = lo, step = 1;                 /* инвариант: v[base] < key */
+    while (step < hi - base && cmp3(m, &v[base + step], key) < 0) {
+        base += step;
+        step <<= 1;
+    }
+    size_t l = base + 1, r = (step < hi - base) ? base + step : hi;
+    while (l < r) {
+        size_t mid = l + (r - l) / 2;
+        if (cmp3(m, &v[mid], key) < 0) {
+            l = mid + 1;
+        } else {
+            r = mid;
+        }
+    }
+    return l;
+}
+
+/** Расширяет собственный буфер; `-1` — нет памяти. */
+static int sink_grow(sink_t *s)
+{
+    size_t cap = s->cap ? s->cap * 2 : 256;
+    if (s->join) {
+        bignum_join_pair_t *p = realloc(s->pairs, cap * sizeof(*p));
+        if (p == NULL) {
+            return -1;
+        }
+        s->pairs = p;
+    } else {
+        const bignum_t **r = realloc((void *)s->refs, cap * sizeof(*r));
+        if (r == NULL) {
+            return -1;
+        }
+        s->refs = r;
+    }
+    s->cap = cap;
+    return 0;
+}
+
+static inline int emit_ref(sink_t *s, const bignum_t *x)
+{
+    if (s->count >= s->cap && s->grow && sink_grow(s) != 0) {
+        return -1;
+    }
+    if (s->count < s->cap) {
+        s->refs[s->count] = x;
+    }
+    s->count++;
+    return 0;
+}
+
+/**
+ * @brief Выводит `x`, если `flag`; при свободном месте — без ветвления по `flag`
+ *        (запись в слот `count` делается всегда, счётчик растёт на `flag`).
+ */
+static inline int emit_ref_if(sink_t *s, int flag, const bignum_t *x)
+{
+    if (s->count < s->cap) {
+        s->refs[s->count] = x;
+        s->count += (size_t)flag;
+        return 0;
+    }
+    return flag ? emit_ref(s, x) : 0;
+}
+
+static inline int emit_pair(sink_t *s, size_t i, size_t j)
+{
+    if (s->count >= s->cap && s->grow && sink_grow(s) != 0) {
+        return -1;
+    }
+    if (s->count < s->cap) {
+        s->pairs[s->count].a = i;
+        s->pairs[s->count].b = j;
+    }
+    s->count++;
+    return 0;
+}
+
+static int emit_range(sink_t *s, const bignum_t *v, size_t lo, size_t hi)
+{
+    for (size_t k = lo; k < hi; ++k) {
+        if (emit_ref(s, &v[k]) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/** Выводит группу равных ключей `a[i … gi)` и `b[j … gj)`. */
+static int emit_group(merge_t *m, size_t i, size_t gi, size_t j, size_t gj)
+{
+    size_t p = gi - i, q = gj - j;
+    switch (m->op) {
+    case OP_JOIN:
+        for (size_t x = i; x < gi; ++x) {
+            for (size_t y = j; y < gj; ++y) {
+                if (emit_pair(&m->s, x, y) != 0) {
+                    return -1;
+                }
+            }
+        }
+        return 0;
+    case BIGNUM_SET_INTERSECTION:
+        return emit_range(&m->s, m->a, i, i + (p < q ? p : q));
+    case BIGNUM_SET_UNION:
+        if (emit_range(&m->s, m->a, i, gi) != 0) {
+            return -1;
+        }
+        return (q > p) ? emit_range(&m->s, m->b, j + p, gj) : 0;
+    default: /* BIGNUM_SET_DIFFERENCE */
+        return (p > q) ? emit_range(&m->s, m->a, i + q, gi) : 0;
+    }
+}
+
+/** Слияние `a[i … ea)` с `b[j … eb)`. */
+static bignum_join_status_t merge_range(merge_t *m, size_t i, size_t ea, size_t j, size_t eb)
+{
+    const bignum_t *a = m->a, *b = m->b;
+    const int keep_a = (m->op == BIGNUM_SET_UNION || m->op == BIGNUM_SET_DIFFERENCE);
+    const int keep_b = (m->op == BIGNUM_SET_UNION);
+    const size_t na = ea - i, nb = eb - j;
+    const int gallop_a = na / BIGNUM_JOIN_GALLOP_RATIO > nb;
+    const int gallop_b = nb / BIGNUM_JOIN_GALLOP_RATIO > na;
+
+    while (i < ea && j < eb) {
+        if (gallop_a) {
+            size_t k = gallop(m, a, i, ea, &b[j]);
+            if (keep_a && emit_range(&m->s, a, i, k) != 0) {
+                return BIGNUM_JOIN_ERROR_NOMEM;
+            }
+            if ((i = k) == ea) {
+                break;
+            }
+        } else if (gallop_b) {
+            size_t k = gallop(m, b, j, eb, &a[i]);
+            if (keep_b && emit_range(&m->s, b, j, k) != 0) {
+                return BIGNUM_JOIN_ERROR_NOMEM;
+            }
+            if ((j = k) == eb) {
+                break;
+            }
+        }
+
+        __builtin_prefetch(&a[i + PREFETCH].len);
+        __builtin_prefetch(&a[i + PREFETCH].words[0]);
+        __builtin_prefetch(&b[j + PREFETCH].len);
+        __builtin_prefetch(&b[j + PREFETCH].words[0]);
+        int c = cmp3(m, &a[i], &b[j]);
+        if (c == 0) {
+            size_t gi = i + 1, gj = j + 1;
+            while (gi < ea && cmp3(m, &a[gi], &a[i]) == 0) {
+                ++gi;
+            }
+            while (gj < eb && cmp3(m, &b[gj], &b[j]) == 0) {
+                ++gj;
+            }
+            if (emit_group(m, i, gi, j, gj) != 0) {
+                return BIGNUM_JOIN_ERROR_NOMEM;
+            }
+            i = gi;
+            j = gj;
+            continue;
+        }
+
+        int lt = c < 0;
+        if ((keep_a | keep_b) &&
+            emit_ref_if(&m->s, lt ? keep_a : keep_b, lt ? &a[i] : &b[j]) != 0) {
+            return BIGNUM_JOIN_ERROR_NOMEM;
+        }
+        i += (size_t)lt;
+        j += (size_t)!lt;
+    }
+
+    if ((keep_a && emit_range(&m->s, a, i, ea) != 0) ||
+        (keep_b && emit_range(&m->s, b, j, eb) != 0)) {
+        return BIGNUM_JOIN_ERROR_NOMEM;
+    }
+    return m->bad ? BIGNUM_JOIN_ERROR_RANGE : BIGNUM_JOIN_OK;
+}
+
+/* ---- Многопоточный вариант ---- */
+
+typedef struct {
+    merge_t              m;
+    size_t               ia, ea, jb, eb;
+    bignum_join_status_t st;
+} join_job_t;
+
+static void join_jobs(size_t begin, size_t end, void *arg)
+{
+    join_job_t *jobs = arg;
+    for (size_t t = begin; t < end; ++t) {
+        jobs[t].st = merge_range(&jobs[t].m, jobs[t].ia, jobs[t].ea, jobs[t].jb, jobs[t].eb);
+    }
+}
+
+/**
+ * @brief Общая часть всех функций: проверки, однопоточный путь без выделений,
+ *        многопоточный — с разбиением по границам групп длинного массива.
+ */
+static bignum_join_status_t run(int op, const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                unsigned threads, void *out, size_t cap, size_t *count)
+{
+    if ((a == NULL && na > 0) || (b == NULL && nb > 0) || count == NULL || (out == NULL && cap > 0)) {
+        return BIGNUM_JOIN_ERROR_NULL;
+    }
+    if (op < OP_JOIN || op > BIGNUM_SET_DIFFERENCE) {
+        return BIGNUM_JOIN_ERROR_RANGE;
+    }
+    *count = 0;
+
+    merge_t m;
+    memset(&m, 0, sizeof(m));
+    m.a      = a;
+    m.b      = b;
+    m.op     = op;
+    m.s.join = (op == OP_JOIN);
+    m.s.cap  = cap;
+    if (m.s.join) {
+        m.s.pairs = out;
+    } else {
+        m.s.refs = out;
+    }
+
+    threads = bignum_pool_parts(threads, na + nb, MIN_CHUNK);
+    if (threads == 1) {
+        bignum_join_status_t st = merge_range(&m, 0, na, 0, nb);
+        if (st == BIGNUM_JOIN_OK) {
+            *count = m.s.count;
+        }
+        return st;
+    }
+
+    join_job_t *jobs = calloc(threads, sizeof(join_job_t));
+    if (jobs == NULL) {
+        return BIGNUM_JOIN_ERROR_NOMEM;
+    }
+
+    /* Границы: позиция в длинном массиве сдвигается к началу своей группы
+     * равных ключей, в коротком — lower_bound того же ключа. */
+    const int long_a = na >= nb;
+    const bignum_t *lv = long_a ? a : b, *sv = long_a ? b : a;
+    size_t nl = long_a ? na : nb, ns = long_a ? nb : na, prev_l = 0, prev_s = 0;
+    for (unsigned t = 0; t < threads; ++t) {
+        size_t pl = nl, ps = ns;
+        if (t + 1 < threads) {
+            pl = nl * (t + 1) / threads;
+            pl = gallop(&m, lv, prev_l, pl, &lv[pl]);
+            ps = gallop(&m, sv, prev_s, ns, &lv[pl]);
+        }
+        jobs[t].m        = m;
+        jobs[t].m.s.pairs = NULL;
+        jobs[t].m.s.refs = NULL;
+        jobs[t].m.s.cap  = 0;
+        jobs[t].m.s.grow = 1;
+        jobs[t].ia = long_a ? prev_l : prev_s;
+        jobs[t].ea = long_a ? pl : ps;
+        jobs[t].jb = long_a ? prev_s : prev_l;
+        jobs[t].eb = long_a ? ps : pl;
+        prev_l = pl;
+        prev_s = ps;
+    }
+
+    bignum_join_status_t st = m.bad ? BIGNUM_JOIN_ERROR_RANGE : BIGNUM_JOIN_OK;
+    if (st == BIGNUM_JOIN_OK && bignum_parallel_for(threads, 1, join_jobs, jobs) != BIGNUM_POOL_OK) {
+        st = BIGNUM_JOIN_ERROR_THREAD;
+    }
+    for (unsigned t = 0; t < threads && st == BIGNUM_JOIN_OK; ++t) {
+        st = jobs[t].st;
+    }
+
+    if (st == BIGNUM_JOIN_OK) {
+        size_t total = 0;
+        for (unsigned t = 0; t < threads; ++t) {
+            const sink_t *s = &jobs[t].m.s;
+            size_t take = (total < cap) ? cap - total : 0;
+            take = (s->count < take) ? s->count : take;
+            if (take == 0) {
+                /* буфер вызывающего заполнен или отрезок пуст */
+            } else if (m.s.join) {
+                memcpy(m.s.pairs + total, s->pairs, take * sizeof(bignum_join_pair_t));
+            } else {
+                memcpy((void *)(m.s.refs + total), (const void *)s->refs, take * sizeof(const bignum_t *));
+            }
+            total += s->count;
+        }
+        *count = total;
+    }
+    for (unsigned t = 0; t < threads; ++t) {
+        free(jobs[t].m.s.pairs);
+        free((void *)jobs[t].m.s.refs);
+    }
+    free(jobs);
+    return st;
+}
+
+bignum_join_status_t bignum_merge_join(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                       bignum_join_pair_t *pairs, size_t cap, size_t *count)
+{
+    return run(OP_JOIN, a, na, b, nb, 1, pairs, cap, count);
+}
+
+bignum_join_status_t bignum_merge_join_mt(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                          unsigned threads, bignum_join_pair_t *pairs, size_t cap,
+                                          size_t *count)
+{
+    return run(OP_JOIN, a, na, b, nb, threads, pairs, cap, count);
+}
+
+bignum_join_status_t bignum_set_op(bignum_set_op_t op, const bignum_t *a, size_t na,
+                                   const bignum_t *b, size_t nb,
+                                   const bignum_t **out, size_t cap, size_t *count)
+{
+    return run((int)op, a, na, b, nb, 1, (void *)out, cap, count);
+}
+
+bignum_join_status_t bignum_set_op_mt(bignum_set_op_t op, const bignum_t *a, size_t na,
+                                      const bignum_t *b, size_t nb, unsigned threads,
+                                      const bignum_t **out, size_t cap, size_t *count)
+{
+    return run((int)op, a, na, b, nb, threads, (void *)out, cap, count);
+}
+
+bignum_join_status_t bignum_set_intersection(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                             const bignum_t **out, size_t cap, size_t *count)
+{
+    return bignum_set_op(BIGNUM_SET_INTERSECTION, a, na, b, nb, out, cap, count);
+}
+
+bignum_join_status_t bignum_set_union(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                      const bignum_t **out, size_t cap, size_t *count)
+{
+    return bignum_set_op(BIGNUM_SET_UNION, a, na, b, nb, out, cap, count);
+}
+
+bignum_join_status_t bignum_set_difference(const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                                           const bignum_t **out, size_t cap, size_t *count)
+{
+    return bignum_set_op(BIGNUM_SET_DIFFERENCE, a, na, b, nb, out, cap, count);
+}
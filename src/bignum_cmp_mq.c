@@ -0,0 +1,334 @@
+/**
+ * @file    bignum_cmp_mq.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация MultiQueue.
+ *
+ * @details Каждая куча — двоичная min-куча записей (`len`, старшее слово,
+ *          слот) с массивом слотов и стеком свободных слотов. Для `BIGNUM_MQ_MAX`
+ *          знак сравнения меняется. После каждого изменения куча публикует
+ *          префикс корня (`best_len`, `best_top`) и размер в атомарных полях;
+ *          `pop` читает их без блокировок, поэтому выбор «лучшей из двух»
+ *          приблизителен, но сама куча меняется только под её блокировкой.
+ *
+ *          Случайные номера куч — xorshift в памяти потока (`_Thread_local`).
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "bignum_cmp_mq.h"
+#include "bignum_cmp_hash.h"
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define EMPTY_LEN    SIZE_MAX
+#define TRY_ROUNDS   4                  /* случайных попыток на кучу до полного обхода */
+
+/** Запись кучи: префикс значения и номер слота. */
+typedef struct {
+    uint64_t top;
+    uint32_t len;
+    uint32_t slot;
+} mq_entry_t;
+
+struct bignum_mq_queue {
+    _Alignas(64) atomic_flag lock;
+    atomic_size_t    size;      /**< Пишется под блокировкой, читается без неё. */
+    atomic_size_t    best_len;  /**< `len` корня или `EMPTY_LEN`. */
+    _Atomic uint64_t best_top;  /**< Старшее слово корня. */
+    mq_entry_t      *heap;
+    bignum_t        *slots;
+    uint32_t        *free_slots;
+    size_t           nfree;
+};
+
+static _Thread_local uint64_t tls_rng;
+
+static inline uint64_t rng_next(void)
+{
+    uint64_t x = tls_rng;
+    if (x == 0) {
+        x = bignum_hash_fmix64((uint64_t)(uintptr_t)&tls_rng) | 1;
+    }
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    tls_rng = x;
+    return x * 0x2545F4914F6CDD1Dull;
+}
+
+static inline int try_lock(struct bignum_mq_queue *h)
+{
+    return !atomic_flag_test_and_set_explicit(&h->lock, memory_order_acquire);
+}
+
+static inline void lock(struct bignum_mq_queue *h)
+{
+    while (!try_lock(h)) {
+        sched_yield();
+    }
+}
+
+static inline void unlock(struct bignum_mq_queue *h)
+{
+    atomic_flag_clear_explicit(&h->lock, memory_order_release);
+}
+
+/** Сравнение записей одной кучи с учётом направления `order`. */
+static inline int cmp_entry(const bignum_mq_t *q, const struct bignum_mq_queue *h,
+                            const mq_entry_t *x, const mq_entry_t *y)
+{
+    int c = ((x->len > y->len) - (x->len < y->len)) * 2 + ((x->top > y->top) - (x->top < y->top));
+    if (c == 0) {
+        c = bignum_cmp(&h->slots[x->slot], &h->slots[y->slot]);
+    }
+    return (q->order == BIGNUM_MQ_MAX) ? -c : c;
+}
+
+static void sift_up(const bignum_mq_t *q, struct bignum_mq_queue *h, size_t i)
+{
+    mq_entry_t e = h->heap[i];
+    while (i > 0) {
+        size_t p = (i - 1) / 2;
+        if (cmp_entry(q, h, &e, &h->heap[p]) >= 0) {
+            break;
+        }
+        h->heap[i] = h->heap[p];
+        i = p;
+    }
+    h->heap[i] = e;
+}
+
+static void sift_down(const bignum_mq_t *q, struct bignum_mq_queue *h, size_t i, size_t n)
+{
+    mq_entry_t e = h->heap[i];
+    for (;;) {
+        size_t c = 2 * i + 1;
+        if (c >= n) {
+            break;
+        }
+        if (c + 1 < n && cmp_entry(q, h, &h->heap[c + 1], &h->heap[c]) < 0) {
+            ++c;
+        }
+        if (cmp_entry(q, h, &h->heap[c], &e) >= 0) {
+            break;
+        }
+        h->heap[i] = h->heap[c];
+        i = c;
+    }
+    h->heap[i] = e;
+}
+
+/**
+ * @brief Публикует префикс корня и размер (вызывается под блокировкой).
+ * @details Значение нового корня заранее запрашивается в кэш: его скопирует
+ *          следующий `pop` из этой кучи.
+ */
+static inline void publish(struct bignum_mq_queue *h, size_t n)
+{
+    if (n > 0) {
+        const bignum_t *root = &h->slots[h->heap[0].slot];
+        for (size_t off = 0; off < sizeof(bignum_t); off += 64) {
+            __builtin_prefetch((const char *)root + off);
+        }
+    }
+    atomic_store_explicit(&h->best_top, n ? h->heap[0].top : 0, memory_order_relaxed);
+    atomic_store_explicit(&h->best_len, n ? (size_t)h->heap[0].len : EMPTY_LEN, memory_order_relaxed);
+    atomic_store_explicit(&h->size, n, memory_order_release);
+}
+
+/** Вставка под блокировкой; `0` — куча заполнена. */
+static int heap_push(const bignum_mq_t *q, struct bignum_mq_queue *h, const bignum_t *x)
+{
+    size_t n = atomic_load_explicit(&h->size, memory_order_relaxed);
+    if (h->nfree == 0) {
+        return 0;
+    }
+    uint32_t slot = h->free_slots[--h->nfree];
+    h->slots[slot] = *x;
+    h->heap[n].len  = (uint32_t)x->len;
+    h->heap[n].top  = x->len ? x->words[x->len - 1] : 0;
+    h->heap[n].slot = slot;
+    sift_up(q, h, n);
+    publish(h, n + 1);
+    return 1;
+}
+
+/** Извлечение корня под блокировкой; `0` — куча пуста. */
+static int heap_pop(const bignum_mq_t *q, struct bignum_mq_queue *h, bignum_t *out)
+{
+    size_t n = atomic_load_explicit(&h->size, memory_order_relaxed);
+    if (n == 0) {
+        return 0;
+    }
+    uint32_t slot = h->heap[0].slot;
+    *out = h->slots[slot];
+    h->free_slots[h->nfree++] = slot;
+    h->heap[0] = h->heap[n - 1];
+    if (n > 2) {
+        sift_down(q, h, 0, n - 1);
+    }
+    publish(h, n - 1);
+    return 1;
+}
+
+/** `1`, если опубликованный корень `a` лучше корня `b` (пустая куча хуже любой). */
+static inline int better_root(const bignum_mq_t *q, const struct bignum_mq_queue *a,
+                              const struct bignum_mq_queue *b)
+{
+    size_t   al = atomic_load_explicit(&a->best_len, memory_order_relaxed);
+    size_t   bl = atomic_load_explicit(&b->best_len, memory_order_relaxed);
+    uint64_t at = atomic_load_explicit(&a->best_top, memory_order_relaxed);
+    uint64_t bt = atomic_load_explicit(&b->best_top, memory_order_relaxed);
+    if (al == EMPTY_LEN || bl == EMPTY_LEN) {
+        return bl == EMPTY_LEN && al != EMPTY_LEN;
+    }
+    int c = ((al > bl) - (al < bl)) * 2 + ((at > bt) - (at < bt));
+    return (q->order == BIGNUM_MQ_MAX) ? c > 0 : c < 0;
+}
+
+bignum_mq_status_t bignum_mq_init(bignum_mq_t *q, size_t nqueues, size_t capacity, bignum_mq_order_t order)
+{
+    if (q == NULL) {
+        return BIGNUM_MQ_ERROR_NULL;
+    }
+    memset(q, 0, sizeof(*q));
+    if (nqueues == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nqueues = 2 * (size_t)((cpus > 0) ? cpus : 1);
+    }
+    size_t cap = (capacity + nqueues - 1) / nqueues;
+    if (capacity == 0 || cap > UINT32_MAX || (order != BIGNUM_MQ_MIN && order != BIGNUM_MQ_MAX)) {
+        return BIGNUM_MQ_ERROR_RANGE;
+    }
+
+    q->queues = aligned_alloc(64, nqueues * sizeof(struct bignum_mq_queue));
+    if (q->queues == NULL) {
+        return BIGNUM_MQ_ERROR_NOMEM;
+    }
+    memset(q->queues, 0, nqueues * sizeof(struct bignum_mq_queue));
+    q->nqueues   = nqueues;
+    q->queue_cap = cap;
+    q->order     = order;
+    for (size_t i = 0; i < nqueues; ++i) {
+        struct bignum_mq_queue *h = &q->queues[i];
+        atomic_flag_clear(&h->lock);
+        atomic_init(&h->size, 0);
+        atomic_init(&h->best_len, EMPTY_LEN);
+        atomic_init(&h->best_top, 0);
+        h->heap       = malloc(cap * sizeof(mq_entry_t));
+        h->slots      = malloc(cap * sizeof(bignum_t));
+        h->free_slots = malloc(cap * sizeof(uint32_t));
+        if (h->heap == NULL || h->slots == NULL || h->free_slots == NULL) {
+            bignum_mq_free(q);
+            return BIGNUM_MQ_ERROR_NOMEM;
+        }
+        for (size_t s = 0; s < cap; ++s) {
+            h->free_slots[s] = (uint32_t)(cap - 1 - s);
+        }
+        h->nfree = cap;
+    }
+    return BIGNUM_MQ_OK;
+}
+
+void bignum_mq_free(bignum_mq_t *q)
+{
+    if (q == NULL) {
+        return;
+    }
+    for (size_t i = 0; q->queues != NULL && i < q->nqueues; ++i) {
+        free(q->queues[i].heap);
+        free(q->queues[i].slots);
+        free(q->queues[i].free_slots);
+    }
+    free(q->queues);
+    memset(q, 0, sizeof(*q));
+}
+
+bignum_mq_status_t bignum_mq_push(bignum_mq_t *q, const bignum_t *x)
+{
+    if (q == NULL || q->queues == NULL || x == NULL) {
+        return BIGNUM_MQ_ERROR_NULL;
+    }
+    if (x->len > BIGNUM_CAPACITY) {
+        return BIGNUM_MQ_ERROR_RANGE;
+    }
+
+    /* Случайные кучи без ожидания: занятая или полная заменяется другой. */
+    for (size_t t = 0; t < TRY_ROUNDS * q->nqueues; ++t) {
+        struct bignum_mq_queue *h = &q->queues[rng_next() % q->nqueues];
+        if (atomic_load_explicit(&h->size, memory_order_relaxed) >= q->queue_cap || !try_lock(h)) {
+            continue;
+        }
+        int done = heap_push(q, h, x);
+        unlock(h);
+        if (done) {
+            return BIGNUM_MQ_OK;
+        }
+    }
+    /* Полный обход с ожиданием: FULL, только если места нет нигде. */
+    size_t start = rng_next() % q->nqueues;
+    for (size_t t = 0; t < q->nqueues; ++t) {
+        struct bignum_mq_queue *h = &q->queues[(start + t) % q->nqueues];
+        lock(h);
+        int done = heap_push(q, h, x);
+        unlock(h);
+        if (done) {
+            return BIGNUM_MQ_OK;
+        }
+    }
+    return BIGNUM_MQ_FULL;
+}
+
+bignum_mq_status_t bignum_mq_pop(bignum_mq_t *q, bignum_t *out)
+{
+    if (q == NULL || q->queues == NULL || out == NULL) {
+        return BIGNUM_MQ_ERROR_NULL;
+    }
+
+    /* Лучшая из двух случайных куч по опубликованным корням. */
+    for (size_t t = 0; t < TRY_ROUNDS * q->nqueues; ++t) {
+        struct bignum_mq_queue *a = &q->queues[rng_next() % q->nqueues];
+        struct bignum_mq_queue *b = &q->queues[rng_next() % q->nqueues];
+        struct bignum_mq_queue *h = better_root(q, b, a) ? b : a;
+        if (atomic_load_explicit(&h->size, memory_order_relaxed) == 0 || !try_lock(h)) {
+            continue;
+        }
+        int done = heap_pop(q, h, out);
+        unlock(h);
+        if (done) {
+            return BIGNUM_MQ_OK;
+        }
+    }
+    /* Почти всё пусто: полный обход с ожиданием. */
+    size_t start = rng_next() % q->nqueues;
+    for (size_t t = 0; t < q->nqueues; ++t) {
+        struct bignum_mq_queue *h = &q->queues[(start + t) % q->nqueues];
+        if (atomic_load_explicit(&h->size, memory_order_acquire) == 0) {
+            continue;
+        }
+        lock(h);
+        int done = heap_pop(q, h, out);
+        unlock(h);
+        if (done) {
+            return BIGNUM_MQ_OK;
+        }
+    }
+    return BIGNUM_MQ_EMPTY;
+}
+
+size_t bignum_mq_size(const bignum_mq_t *q)
+{
+    size_t total = 0;
+    for (size_t i = 0; q != NULL && q->queues != NULL && i < q->nqueues; ++i) {
+        total += atomic_load_explicit(&q->queues[i].size, memory_order_relaxed);
+    }
+    return total;
+}
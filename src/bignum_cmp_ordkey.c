@@ -0,0 +1,164 @@
+/**
+ * @file    bignum_cmp_ordkey.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация байтовых ключей, сохраняющих порядок `bignum_cmp`.
+ *
+ * @details
+ * ### Алгоритм кодирования
+ * 1.  В префикс записывается `len` в big-endian.
+ * 2.  Слова записываются от старшего к младшему, каждое в big-endian.
+ *     Для пары слов `words[i-2], words[i-1]` это ровно разворот 16 байт,
+ *     поэтому векторный путь делает один `pshufb` на 2 слова (SSSE3)
+ *     или `vpshufb` + `vpermq` на 4 слова (AVX2). Хвост и сборки без SIMD
+ *     используют `__builtin_bswap64` (`bswap`/`movbe`).
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная реализация.
+ */
+
+#include "bignum_cmp_ordkey.h"
+#include <string.h>
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+#  include <immintrin.h>
+#endif
+
+/** Записывает `len` слов (little-endian массив) как одно big-endian число. */
+static void store_words_be(uint8_t *dst, const uint64_t *words, size_t len)
+{
+    size_t i = len;
+
+#if defined(__AVX2__)
+    const __m256i rev32 = _mm256_setr_epi8(
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (; i >= 4; i -= 4) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)&words[i - 4]);
+        v = _mm256_shuffle_epi8(v, rev32);
+        v = _mm256_permute4x64_epi64(v, 0x4E);
+        _mm256_storeu_si256((__m256i *)(void *)dst, v);
+        dst += 32;
+    }
+#endif
+#if defined(__SSSE3__)
+    const __m128i rev16 = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (; i >= 2; i -= 2) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)&words[i - 2]);
+        _mm_storeu_si128((__m128i *)(void *)dst, _mm_shuffle_epi8(v, rev16));
+        dst += 16;
+    }
+#endif
+    for (; i > 0; --i) {
+        uint64_t be = __builtin_bswap64(words[i - 1]);
+        memcpy(dst, &be, sizeof(be));
+        dst += 8;
+    }
+}
+
+static void store_prefix(uint8_t *dst, size_t len)
+{
+#if BIGNUM_ORDKEY_PREFIX_SIZE == 1
+    dst[0] = (uint8_t)len;
+#else
+    dst[0] = (uint8_t)(len >> 8);
+    dst[1] = (uint8_t)len;
+#endif
+}
+
+size_t bignum_ordkey_size(const bignum_t *a)
+{
+    if (a == NULL) {
+        return 0;
+    }
+    return BIGNUM_ORDKEY_PREFIX_SIZE + a->len * sizeof(uint64_t);
+}
+
+bignum_ordkey_status_t bignum_to_ordkey(const bignum_t *a, uint8_t *out, size_t out_cap, size_t *out_len)
+{
+    if (a == NULL || out == NULL) {
+        return BIGNUM_ORDKEY_ERROR_NULL;
+    }
+    if (a->len > BIGNUM_CAPACITY) {
+        return BIGNUM_ORDKEY_ERROR_FORMAT;
+    }
+    size_t size = bignum_ordkey_size(a);
+    if (size > out_cap) {
+        return BIGNUM_ORDKEY_ERROR_BUFFER;
+    }
+
+    store_prefix(out, a->len);
+    store_words_be(out + BIGNUM_ORDKEY_PREFIX_SIZE, a->words, a->len);
+    if (out_len != NULL) {
+        *out_len = size;
+    }
+    return BIGNUM_ORDKEY_OK;
+}
+
+bignum_ordkey_status_t bignum_from_ordkey(bignum_t *a, const uint8_t *key, size_t key_len, size_t *consumed)
+{
+    if (a == NULL || key == NULL) {
+        return BIGNUM_ORDKEY_ERROR_NULL;
+    }
+    if (key_len < BIGNUM_ORDKEY_PREFIX_SIZE) {
+        return BIGNUM_ORDKEY_ERROR_FORMAT;
+    }
+
+#if BIGNUM_ORDKEY_PREFIX_SIZE == 1
+    size_t len = key[0];
+#else
+    size_t len = ((size_t)key[0] << 8) | key[1];
+#endif
+    size_t size = BIGNUM_ORDKEY_PREFIX_SIZE + len * sizeof(uint64_t);
+    if (len > BIGNUM_CAPACITY || size > key_len) {
+        return BIGNUM_ORDKEY_ERROR_FORMAT;
+    }
+
+    const uint8_t *p = key + BIGNUM_ORDKEY_PREFIX_SIZE;
+    for (size_t i = len; i > 0; --i) {
+        uint64_t be;
+        memcpy(&be, p, sizeof(be));
+        a->words[i - 1] = __builtin_bswap64(be);
+        p += 8;
+    }
+    for (size_t i = len; i < BIGNUM_CAPACITY; ++i) {
+        a->words[i] = 0;
+    }
+    a->len = len;
+    if (consumed != NULL) {
+        *consumed = size;
+    }
+    return BIGNUM_ORDKEY_OK;
+}
+
+bignum_ordkey_status_t bignum_to_ordkey_batch(const bignum_t *src, size_t n,
+                                              uint8_t *out, size_t out_cap, size_t *offsets)
+{
+    if (src == NULL || out == NULL || offsets == NULL) {
+        return BIGNUM_ORDKEY_ERROR_NULL;
+    }
+
+    size_t pos = 0;
+    offsets[0] = 0;
+    for (size_t k = 0; k < n; ++k) {
+        const bignum_t *a = &src[k];
+        if (a->len > BIGNUM_CAPACITY) {
+            return BIGNUM_ORDKEY_ERROR_FORMAT;
+        }
+        size_t size = BIGNUM_ORDKEY_PREFIX_SIZE + a->len * sizeof(uint64_t);
+        if (size > out_cap - pos) {
+            return BIGNUM_ORDKEY_ERROR_BUFFER;
+        }
+        if (k + 1 < n) {
+            /* len следующего числа лежит в отдельной кэш-линии за words — прогреваем заранее. */
+            __builtin_prefetch(&src[k + 1].len);
+        }
+        store_prefix(out + pos, a->len);
+        store_words_be(out + pos + BIGNUM_ORDKEY_PREFIX_SIZE, a->words, a->len);
+        pos += size;
+        offsets[k + 1] = pos;
+    }
+    return BIGNUM_ORDKEY_OK;
+}
@@ -0,0 +1,391 @@
+/**
+ * @file    bignum_cmp_pool.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация пула потоков с кражей работы.
+ *
+ * @details Очередь участника — слово `range` (`lo | hi << 32`, номера кусков).
+ *          Владелец забирает `lo` CAS-ом `lo → lo + 1`, вор — половину остатка
+ *          CAS-ом `hi → hi - half` и кладёт украденное в свою пустую очередь.
+ *          Очереди растут только так, поэтому, когда вызывающий поток не нашёл
+ *          работы ни в одной очереди, все оставшиеся куски уже у активных
+ *          участников.
+ *
+ *          Задание (функция, `n`, `grain`) и номер поколения пишутся под
+ *          `lock`; рабочий поток присоединяется к поколению под тем же `lock` и
+ *          увеличивает `active`. Новое задание публикуется только при
+ *          `active == 0`, поэтому опоздавший к прошлому поколению поток не
+ *          увидит чужих кусков с прежней функцией. Завершение — счётчик
+ *          `done` выполненных кусков.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#define _GNU_SOURCE                     /* pthread_setaffinity_np, CPU_* */
+#include "bignum_cmp_pool.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_WORKERS 256
+#define MAX_NODES   64
+#define NO_CPU      (-1)
+
+typedef struct {
+    _Alignas(64) _Atomic uint64_t range;   /**< Куски `[lo, hi)` участника. */
+    int       cpu;                         /**< Закреплённый CPU или `NO_CPU`. */
+    unsigned  node;                        /**< Узел NUMA. */
+    pthread_t tid;
+} pool_worker_t;
+
+static struct {
+    pthread_mutex_t    submit;      /**< Очередь вызывающих. */
+    pthread_mutex_t    lock;        /**< Всё ниже, кроме атомарных полей. */
+    pthread_cond_t     wake;        /**< Рабочие ждут нового поколения. */
+    pthread_cond_t     idle;        /**< Вызывающий ждёт `done` и `active == 0`. */
+    unsigned           configured;  /**< Заданный размер; 0 — по маске CPU. */
+    unsigned           nworkers;    /**< Участников вместе с вызывающим; 0 — не запущен. */
+    pool_worker_t     *w;
+    uint64_t           gen;
+    unsigned           active;
+    int                stop;
+    bignum_parallel_fn fn;
+    void              *arg;
+    size_t             n, grain;
+    uint64_t           nchunks;
+    _Atomic uint64_t   done;
+} g_pool = {
+    .submit = PTHREAD_MUTEX_INITIALIZER,
+    .lock   = PTHREAD_MUTEX_INITIALIZER,
+    .wake   = PTHREAD_COND_INITIALIZER,
+    .idle   = PTHREAD_COND_INITIALIZER,
+};
+
+/** Поток сейчас выполняет куски пула: вложенные вызовы — сразу на месте. */
+static _Thread_local int tls_in_pool;
+
+static inline uint64_t pack(uint64_t lo, uint64_t hi)
+{
+    return lo | hi << 32;
+}
+
+/* ---- Топология ---- */
+
+/** Отмечает CPU из списка вида `0-3,8,10-11` узлом `node`. */
+static void parse_cpulist(const char *s, unsigned node, unsigned *cpu_node)
+{
+    while (*s != '\0' && *s != '\n') {
+        char *end;
+        unsigned long lo = strtoul(s, &end, 10), hi = lo;
+        if (end == s) {
+            return;
+        }
+        if (*end == '-') {
+            s = end + 1;
+            hi = strtoul(s, &end, 10);
+        }
+        for (unsigned long c = lo; c <= hi && c < CPU_SETSIZE; ++c) {
+            cpu_node[c] = node;
+        }
+        s = (*end == ',') ? end + 1 : end;
+    }
+}
+
+/** Узел NUMA каждого CPU; без `/sys/devices/system/node` все CPU — узел 0. */
+static void read_numa_nodes(unsigned *cpu_node)
+{
+    char path[64], buf[1024];
+    for (unsigned node = 0; node < MAX_NODES; ++node) {
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+        FILE *f = fopen(path, "r");
+        if (f == NULL) {
+            continue;
+        }
+        if (fgets(buf, sizeof(buf), f) != NULL) {
+            parse_cpulist(buf, node, cpu_node);
+        }
+        fclose(f);
+    }
+}
+
+/* ---- Очереди кусков ---- */
+
+static int pop_own(pool_worker_t *me, uint64_t *chunk)
+{
+    uint64_t r = atomic_load_explicit(&me->range, memory_order_relaxed);
+    for (;;) {
+        uint64_t lo = r & 0xFFFFFFFFu, hi = r >> 32;
+        if (lo >= hi) {
+            return 0;
+        }
+        if (atomic_compare_exchange_weak_explicit(&me->range, &r, pack(lo + 1, hi),
+                                                  memory_order_acquire, memory_order_relaxed)) {
+            *chunk = lo;
+            return 1;
+        }
+    }
+}
+
+/** Крадёт половину чужого остатка: сначала на своём узле, затем на остальных. */
+static int steal(unsigned self)
+{
+    pool_worker_t *me = &g_pool.w[self];
+    unsigned       nw = g_pool.nworkers;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (unsigned k = 1; k < nw; ++k) {
+            pool_worker_t *v = &g_pool.w[(self + k) % nw];
+            if ((v->node == me->node) != (pass == 0)) {
+                continue;
+            }
+            uint64_t r = atomic_load_explicit(&v->range, memory_order_relaxed);
+            for (;;) {
+                uint64_t lo = r & 0xFFFFFFFFu, hi = r >> 32;
+                if (lo >= hi) {
+                    break;
+                }
+                uint64_t mid = hi - (hi - lo + 1) / 2;
+                if (atomic_compare_exchange_weak_explicit(&v->range, &r, pack(lo, mid),
+                                                          memory_order_acquire, memory_order_relaxed)) {
+                    atomic_store_explicit(&me->range, pack(mid, hi), memory_order_relaxed);
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/** Выполняет свои куски, затем крадёт, пока есть что красть. */
+static void run_chunks(unsigned self)
+{
+    pool_worker_t *me = &g_pool.w[self];
+    do {
+        uint64_t chunk, count = 0;
+        while (pop_own(me, &chunk)) {
+            size_t begin = (size_t)chunk * g_pool.grain;
+            size_t end   = (g_pool.n - begin < g_pool.grain) ? g_pool.n : begin + g_pool.grain;
+            g_pool.fn(begin, end, g_pool.arg);
+            ++count;
+        }
+        if (count > 0 &&
+            atomic_fetch_add_explicit(&g_pool.done, count, memory_order_acq_rel) + count == g_pool.nchunks) {
+            pthread_mutex_lock(&g_pool.lock);
+            pthread_cond_broadcast(&g_pool.idle);
+            pthread_mutex_unlock(&g_pool.lock);
+        }
+    } while (steal(self));
+}
+
+static void *worker_main(void *arg)
+{
+    unsigned self = (unsigned)(uintptr_t)arg;
+    tls_in_pool = 1;
+    if (g_pool.w[self].cpu != NO_CPU) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(g_pool.w[self].cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+    pthread_mutex_lock(&g_pool.lock);
+    uint64_t seen = g_pool.gen;         /* задания до запуска доделают другие */
+    for (;;) {
+        while (!g_pool.stop && g_pool.gen == seen) {
+            pthread_cond_wait(&g_pool.wake, &g_pool.lock);
+        }
+        if (g_pool.stop) {
+            break;
+        }
+        seen = g_pool.gen;
+        g_pool.active++;
+        pthread_mutex_unlock(&g_pool.lock);
+        run_chunks(self);
+        pthread_mutex_lock(&g_pool.lock);
+        if (--g_pool.active == 0) {
+            pthread_cond_broadcast(&g_pool.idle);
+        }
+    }
+    pthread_mutex_unlock(&g_pool.lock);
+    return NULL;
+}
+
+/* ---- Запуск и остановка (под `submit`) ---- */
+
+static void stop_workers(unsigned started)
+{
+    pthread_mutex_lock(&g_pool.lock);
+    g_pool.stop = 1;
+    pthread_cond_broadcast(&g_pool.wake);
+    pthread_mutex_unlock(&g_pool.lock);
+    for (unsigned i = 1; i < started; ++i) {
+        pthread_join(g_pool.w[i].tid, NULL);
+    }
+    free(g_pool.w);
+    g_pool.w        = NULL;
+    g_pool.nworkers = 0;
+    g_pool.stop     = 0;
+}
+
+static bignum_pool_status_t start_pool(void)
+{
+    if (g_pool.nworkers != 0) {
+        return BIGNUM_POOL_OK;
+    }
+    cpu_set_t mask;
+    int       cpus[CPU_SETSIZE];
+    unsigned  ncpus = 0;
+    static unsigned cpu_node[CPU_SETSIZE];
+    memset(cpu_node, 0, sizeof(cpu_node));
+    read_numa_nodes(cpu_node);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        /* CPU по узлам, внутри узла — по номеру. */
+        for (unsigned node = 0; node < MAX_NODES; ++node) {
+            for (int c = 0; c < CPU_SETSIZE; ++c) {
+                if (CPU_ISSET(c, &mask) && cpu_node[c] == node) {
+                    cpus[ncpus++] = c;
+                }
+            }
+        }
+    }
+    if (ncpus == 0) {
+        cpus[ncpus++] = NO_CPU;
+    }
+
+    unsigned nw = g_pool.configured ? g_pool.configured : ncpus;
+    nw = nw > MAX_WORKERS ? MAX_WORKERS : nw;
+    int pin = nw <= ncpus && cpus[0] != NO_CPU;
+
+    g_pool.w = aligned_alloc(64, nw * sizeof(pool_worker_t));
+    if (g_pool.w == NULL) {
+        return BIGNUM_POOL_ERROR_NOMEM;
+    }
+    for (unsigned i = 0; i < nw; ++i) {
+        int cpu = cpus[i % ncpus];
+        atomic_init(&g_pool.w[i].range, 0);
+        g_pool.w[i].cpu  = (pin && i > 0) ? cpu : NO_CPU;   /* вызывающий не закрепляется */
+        g_pool.w[i].node = cpu == NO_CPU ? 0 : cpu_node[cpu];
+    }
+    g_pool.nworkers = nw;
+    for (unsigned i = 1; i < nw; ++i) {
+        if (pthread_create(&g_pool.w[i].tid, NULL, worker_main, (void *)(uintptr_t)i) != 0) {
+            stop_workers(i);
+            return BIGNUM_POOL_ERROR_THREAD;
+        }
+    }
+    return BIGNUM_POOL_OK;
+}
+
+bignum_pool_status_t bignum_pool_set_threads(unsigned threads)
+{
+    pthread_mutex_lock(&g_pool.submit);
+    if (g_pool.nworkers != 0) {
+        stop_workers(g_pool.nworkers);
+    }
+    g_pool.configured = threads;
+    pthread_mutex_unlock(&g_pool.submit);
+    return BIGNUM_POOL_OK;
+}
+
+unsigned bignum_pool_threads(void)
+{
+    if (tls_in_pool) {
+        return g_pool.nworkers;
+    }
+    pthread_mutex_lock(&g_pool.submit);
+    unsigned nw = (start_pool() == BIGNUM_POOL_OK) ? g_pool.nworkers : 1;
+    pthread_mutex_unlock(&g_pool.submit);
+    return nw;
+}
+
+unsigned bignum_pool_parts(unsigned threads, size_t n, size_t min_chunk)
+{
+    if (threads == 0) {
+        threads = bignum_pool_threads();
+    }
+    if (threads > MAX_WORKERS) {
+        threads = MAX_WORKERS;
+    }
+    if (min_chunk == 0) {
+        min_chunk = 1;
+    }
+    size_t most = n / min_chunk;        /* частей, в каждой >= min_chunk (<= n) */
+    if ((size_t)threads > most) {
+        threads = most > 0 ? (unsigned)most : 1;
+    }
+    return threads;
+}
+
+void bignum_pool_shutdown(void)
+{
+    pthread_mutex_lock(&g_pool.submit);
+    if (g_pool.nworkers != 0) {
+        stop_workers(g_pool.nworkers);
+    }
+    pthread_mutex_unlock(&g_pool.submit);
+}
+
+bignum_pool_status_t bignum_parallel_for(size_t n, size_t grain, bignum_parallel_fn fn, void *arg)
+{
+    if (fn == NULL) {
+        return BIGNUM_POOL_ERROR_NULL;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+    if (n <= grain || tls_in_pool) {
+        if (n > 0) {
+            fn(0, n, arg);
+        }
+        return BIGNUM_POOL_OK;
+    }
+
+    pthread_mutex_lock(&g_pool.submit);
+    bignum_pool_status_t st = start_pool();
+    if (st != BIGNUM_POOL_OK || g_pool.nworkers == 1) {
+        pthread_mutex_unlock(&g_pool.submit);
+        if (st == BIGNUM_POOL_OK) {
+            fn(0, n, arg);
+        }
+        return st;
+    }
+
+    /* Номер куска помещается в 32 бита. */
+    if ((n - 1) / grain + 1 > UINT32_MAX) {
+        grain = (n - 1) / UINT32_MAX + 1;
+    }
+    pthread_mutex_lock(&g_pool.lock);
+    while (g_pool.active > 0) {
+        pthread_cond_wait(&g_pool.idle, &g_pool.lock);
+    }
+    unsigned nw = g_pool.nworkers;
+    g_pool.fn      = fn;
+    g_pool.arg     = arg;
+    g_pool.n       = n;
+    g_pool.grain   = grain;
+    g_pool.nchunks = (n - 1) / grain + 1;
+    atomic_store_explicit(&g_pool.done, 0, memory_order_relaxed);
+    for (unsigned i = 0; i < nw; ++i) {
+        uint64_t lo = g_pool.nchunks * i / nw, hi = g_pool.nchunks * (i + 1) / nw;
+        atomic_store_explicit(&g_pool.w[i].range, pack(lo, hi), memory_order_relaxed);
+    }
+    g_pool.gen++;
+    pthread_cond_broadcast(&g_pool.wake);
+    pthread_mutex_unlock(&g_pool.lock);
+
+    tls_in_pool = 1;
+    run_chunks(0);
+    tls_in_pool = 0;
+
+    pthread_mutex_lock(&g_pool.lock);
+    while (atomic_load_explicit(&g_pool.done, memory_order_acquire) < g_pool.nchunks) {
+        pthread_cond_wait(&g_pool.idle, &g_pool.lock);
+    }
+    pthread_mutex_unlock(&g_pool.lock);
+    pthread_mutex_unlock(&g_pool.submit);
+    return BIGNUM_POOL_OK;
+}
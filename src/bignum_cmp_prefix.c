@@ -0,0 +1,40 @@
+/**
+ * @file    bignum_cmp_prefix.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Построение префиксных ключей для массивов.
+ *
+ * @details Сами ключ и сравнение — `static inline` в заголовке; здесь только
+ *          проходы по массивам, которые строят кэш один раз перед сортировкой
+ *          или построением индекса.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#include "bignum_cmp_prefix.h"
+
+bignum_prefix_status_t bignum_prefix_keys(const bignum_t *xs, size_t n, uint64_t *keys)
+{
+    if (n > 0 && (xs == NULL || keys == NULL)) {
+        return BIGNUM_PREFIX_ERROR_NULL;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bignum_prefix_key(&xs[i]);
+    }
+    return BIGNUM_PREFIX_OK;
+}
+
+bignum_prefix_status_t bignum_prefixed_init(const bignum_t *xs, size_t n, bignum_prefixed_t *out)
+{
+    if (n > 0 && (xs == NULL || out == NULL)) {
+        return BIGNUM_PREFIX_ERROR_NULL;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        out[i].key = bignum_prefix_key(&xs[i]);
+        out[i].num = &xs[i];
+    }
+    return BIGNUM_PREFIX_OK;
+}
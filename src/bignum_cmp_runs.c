@@ -0,0 +1,267 @@
+/**
+ * @file    bignum_cmp_runs.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация проверки упорядоченности и поиска серий.
+ *
+ * @details Ядро — `scan_descents`: обходит позиции `i` отрезка, сравнивая
+ *          префикс `a[i]` с префиксом `a[i-1]` из регистров. На блок из
+ *          `BLOCK` позиций строятся маски `bad` (префикс убывает), `tie`
+ *          (префиксы равны) и `inv` (`len > BIGNUM_CAPACITY`); при нулевых
+ *          масках блок пропускается без единого ветвления по данным.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ *   - rev. 2 (16.10.2026): Многопоточный вариант выполняется в пуле `bignum_parallel_for`.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "bignum_cmp_runs.h"
+#include "bignum_cmp_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define BLOCK       8
+#define PREFETCH    32                  /* элементов вперёд (~8 КиБ) */
+#define MIN_CHUNK   65536               /* элементов на поток, не меньше */
+
+/** Приёмник найденных убываний. */
+typedef struct {
+    size_t *out;        /**< Куда писать (может быть `NULL`). */
+    size_t  cap;        /**< Ёмкость `out`; при `grow` — текущая ёмкость буфера. */
+    size_t  count;      /**< Найдено. */
+    int     stop_first; /**< Остановиться на первом. */
+    int     grow;       /**< `out` — собственный растущий буфер. */
+} sink_t;
+
+/** Префикс числа; `len` вне `1..BIGNUM_CAPACITY` даёт старшее слово 0. */
+static inline uint64_t top_of(const bignum_t *x, size_t len)
+{
+    return (len - 1 < BIGNUM_CAPACITY) ? x->words[len - 1] : 0;
+}
+
+/** Записывает убывание в позиции `i`; `0` — если нужно остановиться. */
+static int sink_put(sink_t *s, size_t i)
+{
+    if (s->grow && s->count == s->cap) {
+        size_t  cap = s->cap ? s->cap * 2 : 64;
+        size_t *out = realloc(s->out, cap * sizeof(size_t));
+        if (out == NULL) {
+            return -1;
+        }
+        s->out = out;
+        s->cap = cap;
+    }
+    if (s->count < s->cap && s->out != NULL) {
+        s->out[s->count] = i;
+    }
+    s->count++;
+    return !s->stop_first;
+}
+
+/**
+ * @brief Ищет `i` из `[start, end)` (`start >= 1`) с `a[i-1] > a[i]`.
+ * @return `BIGNUM_RUNS_OK`, `BIGNUM_RUNS_ERROR_RANGE` или `BIGNUM_RUNS_ERROR_NOMEM`.
+ */
+static bignum_runs_status_t scan_descents(const bignum_t *a, size_t start, size_t end, sink_t *s)
+{
+    if (start >= end) {
+        return BIGNUM_RUNS_OK;
+    }
+    size_t   pl = a[start - 1].len;
+    uint64_t pt = top_of(&a[start - 1], pl);
+    if (pl > BIGNUM_CAPACITY) {
+        return BIGNUM_RUNS_ERROR_RANGE;
+    }
+
+    size_t i = start;
+    while (i < end) {
+        size_t   m = (end - i < BLOCK) ? end - i : BLOCK;
+        uint32_t bad = 0, tie = 0, inv = 0;
+
+        for (size_t j = 0; j < m; ++j) {
+            const bignum_t *x = &a[i + j];
+            __builtin_prefetch(&x[PREFETCH].len);
+            __builtin_prefetch(&x[PREFETCH].words[0]);
+            size_t   l = x->len;
+            uint64_t t = top_of(x, l);
+            bad |= (uint32_t)((pl > l) | ((pl == l) & (pt > t))) << j;
+            tie |= (uint32_t)((pl == l) & (pt == t)) << j;
+            inv |= (uint32_t)(l > BIGNUM_CAPACITY) << j;
+            pl = l;
+            pt = t;
+        }
+
+        if ((bad | tie | inv) != 0) {
+            for (size_t j = 0; j < m; ++j) {
+                uint32_t bit = 1u << j;
+                if (inv & bit) {
+                    return BIGNUM_RUNS_ERROR_RANGE;
+                }
+                int desc = (bad & bit) != 0 ||
+                           ((tie & bit) != 0 && bignum_cmp(&a[i + j - 1], &a[i + j]) > 0);
+                if (desc) {
+                    int r = sink_put(s, i + j);
+                    if (r < 0) {
+                        return BIGNUM_RUNS_ERROR_NOMEM;
+                    }
+                    if (r == 0) {
+                        return BIGNUM_RUNS_OK;
+                    }
+                }
+            }
+        }
+        i += m;
+    }
+    return BIGNUM_RUNS_OK;
+}
+
+int bignum_is_sorted(const bignum_t *a, size_t n, size_t *until)
+{
+    return bignum_is_sorted_mt(a, n, 1, until);
+}
+
+bignum_runs_status_t bignum_sorted_runs(const bignum_t *a, size_t n, size_t *starts, size_t cap, size_t *count)
+{
+    return bignum_sorted_runs_mt(a, n, 1, starts, cap, count);
+}
+
+/* ---- Многопоточные варианты ---- */
+
+typedef struct {
+    const bignum_t      *a;
+    size_t               start, end;
+    sink_t               sink;
+    bignum_runs_status_t st;
+} runs_job_t;
+
+static void runs_jobs(size_t begin, size_t end, void *arg)
+{
+    runs_job_t *jobs = arg;
+    for (size_t t = begin; t < end; ++t) {
+        jobs[t].st = scan_descents(jobs[t].a, jobs[t].start, jobs[t].end, &jobs[t].sink);
+    }
+}
+
+/**
+ * @brief Делит `[1, n)` на `threads` отрезков и запускает `scan_descents`
+ *        в пуле (`bignum_parallel_for`).
+ * @details У каждого отрезка собственный растущий приёмник; при `stop_first`
+ *          в нём не больше одного значения.
+ */
+static bignum_runs_status_t run_jobs(const bignum_t *a, size_t n, unsigned threads,
+                                     int stop_first, runs_job_t **jobs_out)
+{
+    runs_job_t *jobs = calloc(threads, sizeof(runs_job_t));
+    if (jobs == NULL) {
+        return BIGNUM_RUNS_ERROR_NOMEM;
+    }
+    for (unsigned t = 0; t < threads; ++t) {
+        size_t lo = 1 + (n - 1) * t / threads, hi = 1 + (n - 1) * (t + 1) / threads;
+        jobs[t].a               = a;
+        jobs[t].start           = lo;
+        jobs[t].end             = hi;
+        jobs[t].sink.stop_first = stop_first;
+        jobs[t].sink.grow       = 1;
+    }
+
+    bignum_runs_status_t st = BIGNUM_RUNS_OK;
+    if (bignum_parallel_for(threads, 1, runs_jobs, jobs) != BIGNUM_POOL_OK) {
+        st = BIGNUM_RUNS_ERROR_THREAD;
+    }
+    for (unsigned t = 0; t < threads && st == BIGNUM_RUNS_OK; ++t) {
+        st = jobs[t].st;
+    }
+    *jobs_out = jobs;
+    return st;
+}
+
+static void free_jobs(runs_job_t *jobs, unsigned threads)
+{
+    for (unsigned t = 0; jobs != NULL && t < threads; ++t) {
+        free(jobs[t].sink.out);
+    }
+    free(jobs);
+}
+
+int bignum_is_sorted_mt(const bignum_t *a, size_t n, unsigned threads, size_t *until)
+{
+    if (a == NULL && n > 0) {
+        return BIGNUM_RUNS_ERROR_NULL;
+    }
+    if (n == 0) {
+        if (until != NULL) {
+            *until = 0;
+        }
+        return 1;
+    }
+    threads = bignum_pool_parts(threads, n, MIN_CHUNK);
+
+    size_t first = n;
+    bignum_runs_status_t st;
+    if (threads == 1) {
+        /* Без выделений и потоков: приёмник на одно значение. */
+        sink_t s = { &first, 1, 0, 1, 0 };
+        st = scan_descents(a, 1, n, &s);
+    } else {
+        runs_job_t *jobs = NULL;
+        st = run_jobs(a, n, threads, 1, &jobs);
+        for (unsigned t = 0; st == BIGNUM_RUNS_OK && t < threads; ++t) {
+            if (jobs[t].sink.count > 0 && jobs[t].sink.out[0] < first) {
+                first = jobs[t].sink.out[0];
+            }
+        }
+        free_jobs(jobs, threads);
+    }
+    if (st != BIGNUM_RUNS_OK) {
+        return st;
+    }
+    if (until != NULL) {
+        *until = first;
+    }
+    return first == n;
+}
+
+bignum_runs_status_t bignum_sorted_runs_mt(const bignum_t *a, size_t n, unsigned threads,
+                                           size_t *starts, size_t cap, size_t *count)
+{
+    if ((a == NULL && n > 0) || count == NULL || (starts == NULL && cap > 0)) {
+        return BIGNUM_RUNS_ERROR_NULL;
+    }
+    *count = 0;
+    if (n == 0) {
+        return BIGNUM_RUNS_OK;
+    }
+    if (cap > 0) {
+        starts[0] = 0;
+    }
+    threads = bignum_pool_parts(threads, n, MIN_CHUNK);
+
+    if (threads == 1) {
+        /* Пишем сразу в буфер вызывающего, после начального 0. */
+        sink_t s = { cap > 0 ? starts + 1 : NULL, cap > 0 ? cap - 1 : 0, 0, 0, 0 };
+        bignum_runs_status_t st = scan_descents(a, 1, n, &s);
+        if (st == BIGNUM_RUNS_OK) {
+            *count = s.count + 1;
+        }
+        return st;
+    }
+
+    runs_job_t *jobs = NULL;
+    bignum_runs_status_t st = run_jobs(a, n, threads, 0, &jobs);
+    if (st == BIGNUM_RUNS_OK) {
+        size_t total = 1;
+        for (unsigned t = 0; t < threads; ++t) {
+            for (size_t k = 0; k < jobs[t].sink.count; ++k, ++total) {
+                if (total < cap) {
+                    starts[total] = jobs[t].sink.out[k];
+                }
+            }
+        }
+        *count = total;
+    }
+    free_jobs(jobs, threads);
+    return st;
+}
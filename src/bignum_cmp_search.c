@@ -0,0 +1,115 @@
+/**
+ * @file    bignum_cmp_search.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация пакетного двоичного поиска с чередованием запросов.
+ *
+ * @details Дорожка хранит отрезок `[base, base + len)`, в котором лежит ответ;
+ *          ключ `keys[base + len / 2]` запрошен заранее. Шаг сравнивает с ним
+ *          и либо сужает отрезок до левой половины, либо переносит `base` за
+ *          `mid`; при `len == 0` ответ — `base`. Дорожки обходятся по кругу,
+ *          освободившаяся берёт следующий запрос, в конце пакета дорожки
+ *          выбывают.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#include "bignum_cmp_search.h"
+
+#define INFLIGHT 16                     /* одновременных запросов */
+
+typedef struct {
+    const bignum_t *x;
+    size_t          q;                  /**< Номер запроса в пакете. */
+    size_t          base, len;
+} search_lane_t;
+
+/** `len` и первые слова ключа лежат в разных строках; запрашиваются обе. */
+static inline void key_prefetch(const bignum_t *k)
+{
+    __builtin_prefetch(&k->len);
+    __builtin_prefetch(&k->words[0]);
+}
+
+static inline void lane_start(search_lane_t *ln, const bignum_t *keys, size_t n,
+                              const bignum_t *xs, size_t q, size_t m)
+{
+    if (q + INFLIGHT < m) {
+        key_prefetch(&xs[q + INFLIGHT]);
+    }
+    ln->x    = &xs[q];
+    ln->q    = q;
+    ln->base = 0;
+    ln->len  = n;
+    if (n > 0) {
+        key_prefetch(&keys[n / 2]);
+    }
+}
+
+/** Один шаг дорожки; `1`, если запрос завершён и ответ записан в `*out`. */
+static inline int lane_step(search_lane_t *ln, const bignum_t *keys, int upper, size_t *out)
+{
+    if (ln->len > 0) {
+        size_t half = ln->len / 2;
+        int    c    = bignum_cmp(&keys[ln->base + half], ln->x);
+        if (c < 0 || (upper && c == 0)) {
+            ln->base += half + 1;
+            ln->len  -= half + 1;
+        } else {
+            ln->len = half;
+        }
+    }
+    if (ln->len == 0) {
+        *out = ln->base;
+        return 1;
+    }
+    key_prefetch(&keys[ln->base + ln->len / 2]);
+    return 0;
+}
+
+static void search_batch(const bignum_t *keys, size_t n, const bignum_t *xs, size_t m, size_t *pos, int upper)
+{
+    search_lane_t lanes[INFLIGHT];
+    size_t next = 0, active = 0;
+
+    while (active < INFLIGHT && next < m) {
+        lane_start(&lanes[active++], keys, n, xs, next++, m);
+    }
+    while (active > 0) {
+        for (size_t k = 0; k < active; ) {
+            search_lane_t *ln = &lanes[k];
+            if (lane_step(ln, keys, upper, &pos[ln->q])) {
+                if (next < m) {
+                    lane_start(ln, keys, n, xs, next++, m);
+                } else {
+                    *ln = lanes[--active];
+                    continue;
+                }
+            }
+            ++k;
+        }
+    }
+}
+
+bignum_search_status_t bignum_lower_bound_batch(const bignum_t *keys, size_t n,
+                                                const bignum_t *xs, size_t m, size_t *pos)
+{
+    if ((keys == NULL && n > 0) || ((xs == NULL || pos == NULL) && m > 0)) {
+        return BIGNUM_SEARCH_ERROR_NULL;
+    }
+    search_batch(keys, n, xs, m, pos, 0);
+    return BIGNUM_SEARCH_OK;
+}
+
+bignum_search_status_t bignum_upper_bound_batch(const bignum_t *keys, size_t n,
+                                                const bignum_t *xs, size_t m, size_t *pos)
+{
+    if ((keys == NULL && n > 0) || ((xs == NULL || pos == NULL) && m > 0)) {
+        return BIGNUM_SEARCH_ERROR_NULL;
+    }
+    search_batch(keys, n, xs, m, pos, 1);
+    return BIGNUM_SEARCH_OK;
+}
@@ -0,0 +1,353 @@
+/**
+ * @file    bignum_cmp_str.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация сравнения `bignum_t` со строкой цифр.
+ *
+ * @details
+ * ### Шестнадцатеричная строка
+ * 16 цифр — ровно одно слово. Векторный путь (SSSE3) переводит 16 символов
+ * в полубайты (`c - '0'` для цифр, `(c | 0x20) - 'a' + 10` для букв),
+ * склеивает пары полубайт `pmaddubsw` с множителями 16 и 1, упаковывает
+ * `packuswb` и разворачивает байты (`bswap`). Проверка символов (SSE2) —
+ * беззнаковое `x <= 9` / `x <= 5` через `pminub` + `pcmpeqb`.
+ *
+ * ### Десятичная строка
+ * Пусть `B` — битовая длина `a`, `d` — число значащих цифр строки. Десятичная
+ * длина `a` лежит в `[floor((B-1)·lg2) + 1, floor(B·lg2) + 1]`; `lg2`
+ * оценивается снизу `1233/4096` и сверху `1234/4096`, поэтому границы
+ * целочисленные и не сужают настоящий интервал. Вне его ответ даёт `d`.
+ * Внутри сравниваются интервалы `log2`: для строки по 19 старшим цифрам `P`
+ * (`x ∈ [P, P+1)·10^r`), для `a` по 64 старшим битам `T`
+ * (`a ∈ [T, T+1)·2^s`); верхние концы — через `log2(1 + 1/P) <= 1/(P·ln2)`.
+ * `log2` считается без libm: порядок — `lzcnt`, мантисса `m ∈ [1, 2)` — ряд
+ * `ln m = 2·atanh((m-1)/(m+1))`. Интервалы, разнесённые больше чем на
+ * `LOG_EPS`, решают; иначе строка разбирается целиком (по 19 цифр на
+ * умножение-сложение) и сравнивается `bignum_cmp`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#include "bignum_cmp_str.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#  include <immintrin.h>
+#endif
+
+#define DEC_CHUNK  19                           /* цифр в uint64_t без переполнения */
+#define POW10_19   10000000000000000000ull
+#define LOG2_10    3.32192809488736234787031942948939018L
+#define LOG2_E     1.44269504088896340735992468100189214L
+#define LOG_EPS    1e-9L                        /* с запасом над ошибкой log2_u64, в т.ч. при long double == double */
+
+static inline int sign_u64(uint64_t x, uint64_t y)
+{
+    return (x > y) - (x < y);
+}
+
+/** Длина без нулевых старших слов. */
+static size_t eff_len(const bignum_t *a)
+{
+    size_t len = a->len;
+    while (len > 0 && a->words[len - 1] == 0) {
+        --len;
+    }
+    return len;
+}
+
+/** Отбрасывает ведущие `'0'`. */
+static const char *skip_zeros(const char *s, size_t *n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_set1_epi8('0');
+    for (; i + 16 <= *n; i += 16) {
+        __m128i  v = _mm_loadu_si128((const __m128i *)(const void *)(s + i));
+        unsigned m = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) ^ 0xFFFFu;
+        if (m != 0) {
+            i += (size_t)__builtin_ctz(m);
+            *n -= i;
+            return s + i;
+        }
+    }
+#endif
+    while (i < *n && s[i] == '0') {
+        ++i;
+    }
+    *n -= i;
+    return s + i;
+}
+
+/* ---- Шестнадцатеричные цифры ---- */
+
+static inline int hex_nibble(unsigned char c)
+{
+    unsigned d = (unsigned)c - '0';
+    unsigned l = ((unsigned)c | 0x20u) - 'a';
+    return d <= 9 ? (int)d : l <= 5 ? (int)(l + 10) : -1;
+}
+
+/** Переводит `k <= 16` цифр в слово; `0` — недопустимый символ. */
+static int hex_scalar(const char *p, size_t k, uint64_t *out)
+{
+    uint64_t w = 0;
+    for (size_t i = 0; i < k; ++i) {
+        int v = hex_nibble((unsigned char)p[i]);
+        if (v < 0) {
+            return 0;
+        }
+        w = w << 4 | (uint64_t)v;
+    }
+    *out = w;
+    return 1;
+}
+
+/** Переводит ровно 16 цифр в слово. */
+static inline int hex16(const char *p, uint64_t *out)
+{
+#if defined(__SSSE3__)
+    __m128i v    = _mm_loadu_si128((const __m128i *)(const void *)p);
+    __m128i dig  = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i let  = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_d = _mm_cmpeq_epi8(_mm_min_epu8(dig, _mm_set1_epi8(9)), dig);
+    __m128i is_l = _mm_cmpeq_epi8(_mm_min_epu8(let, _mm_set1_epi8(5)), let);
+    if (_mm_movemask_epi8(_mm_or_si128(is_d, is_l)) != 0xFFFF) {
+        return 0;
+    }
+    __m128i nib = _mm_or_si128(_mm_and_si128(is_d, dig),
+                               _mm_and_si128(is_l, _mm_add_epi8(let, _mm_set1_epi8(10))));
+    __m128i b16 = _mm_maddubs_epi16(nib, _mm_set1_epi16(0x0110));  /* hi * 16 + lo */
+    uint64_t be = (uint64_t)_mm_cvtsi128_si64(_mm_packus_epi16(b16, b16));
+    *out = __builtin_bswap64(be);
+    return 1;
+#else
+    return hex_scalar(p, 16, out);
+#endif
+}
+
+static int valid_hex(const char *s, size_t n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= n; i += 16) {
+        __m128i v    = _mm_loadu_si128((const __m128i *)(const void *)(s + i));
+        __m128i dig  = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+        __m128i let  = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+        __m128i is_d = _mm_cmpeq_epi8(_mm_min_epu8(dig, _mm_set1_epi8(9)), dig);
+        __m128i is_l = _mm_cmpeq_epi8(_mm_min_epu8(let, _mm_set1_epi8(5)), let);
+        if (_mm_movemask_epi8(_mm_or_si128(is_d, is_l)) != 0xFFFF) {
+            return 0;
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if (hex_nibble((unsigned char)s[i]) < 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int bignum_cmp_hexstr(const bignum_t *a, const char *s, size_t n)
+{
+    if (a == NULL || s == NULL) {
+        return BIGNUM_CMP_ERROR_NULL;
+    }
+    if (a->len > BIGNUM_CAPACITY) {
+        return BIGNUM_CMP_STR_ERROR_RANGE;
+    }
+    if (n >= 2 && s[0] == '0' && (s[1] | 0x20) == 'x') {
+        s += 2;
+        n -= 2;
+    }
+    if (n == 0 || !valid_hex(s, n)) {
+        return BIGNUM_CMP_STR_ERROR_SYNTAX;
+    }
+    s = skip_zeros(s, &n);
+
+    size_t len = eff_len(a);
+    size_t ad  = len == 0 ? 0
+               : (len - 1) * 16 + (size_t)(64 - __builtin_clzll(a->words[len - 1]) + 3) / 4;
+    if (ad != n) {
+        return ad > n ? BIGNUM_CMP_GREATER : BIGNUM_CMP_LESS;
+    }
+    if (n == 0) {
+        return BIGNUM_CMP_EQ;
+    }
+
+    /* Одинаковое число цифр: по словам от старшего до первого различия. */
+    size_t   head = n - 16 * (len - 1);
+    uint64_t w = 0;
+    hex_scalar(s, head, &w);
+    if (w != a->words[len - 1]) {
+        return sign_u64(a->words[len - 1], w);
+    }
+    s += head;
+    for (size_t i = len - 1; i > 0; --i, s += 16) {
+        hex16(s, &w);
+        if (w != a->words[i - 1]) {
+            return sign_u64(a->words[i - 1], w);
+        }
+    }
+    return BIGNUM_CMP_EQ;
+}
+
+/* ---- Десятичные цифры ---- */
+
+static int valid_dec(const char *s, size_t n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(const void *)(s + i)), _mm_set1_epi8('0'));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(9)), v)) != 0xFFFF) {
+            return 0;
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if ((unsigned)s[i] - '0' > 9) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/** `k <= 19` проверенных цифр. */
+static inline uint64_t dec_u64(const char *p, size_t k)
+{
+    uint64_t v = 0;
+    for (size_t i = 0; i < k; ++i) {
+        v = v * 10 + (uint64_t)(p[i] - '0');
+    }
+    return v;
+}
+
+/** `x = x * m + add`; `0` — переполнение ёмкости. */
+static int mul_add(bignum_t *x, uint64_t m, uint64_t add)
+{
+    uint64_t carry = add;
+    for (size_t i = 0; i < x->len; ++i) {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 u128;
+        u128 t = (u128)x->words[i] * m + carry;
+        x->words[i] = (uint64_t)t;
+        carry       = (uint64_t)(t >> 64);
+#else
+        uint64_t w = x->words[i];
+        uint64_t al = (uint32_t)w, ah = w >> 32, bl = (uint32_t)m, bh = m >> 32;
+        uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+        uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+        uint64_t lo  = (mid << 32) | (uint32_t)ll;
+        uint64_t hi  = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        lo += carry;
+        hi += lo < carry;
+        x->words[i] = lo;
+        carry       = hi;
+#endif
+    }
+    if (carry != 0) {
+        if (x->len == BIGNUM_CAPACITY) {
+            return 0;
+        }
+        x->words[x->len++] = carry;
+    }
+    return 1;
+}
+
+/** Полный разбор `d > 0` значащих цифр и `bignum_cmp`. */
+static int cmp_dec_full(const bignum_t *a, const char *s, size_t d)
+{
+    bignum_t x;
+    size_t   head = d % DEC_CHUNK ? d % DEC_CHUNK : DEC_CHUNK;
+    memset(&x, 0, sizeof(x));
+    x.words[0] = dec_u64(s, head);
+    x.len      = 1;
+    for (size_t i = head; i < d; i += DEC_CHUNK) {
+        if (!mul_add(&x, POW10_19, dec_u64(s + i, DEC_CHUNK))) {
+            return BIGNUM_CMP_LESS;         /* строка больше любого bignum_t */
+        }
+    }
+    bignum_t an = *a;
+    an.len = eff_len(a);
+    return bignum_cmp(&an, &x);
+}
+
+/** `log2(v)`, `v > 0`; 20 членов ряда atanh дают ошибку меньше 1e-18. */
+static long double log2_u64(uint64_t v)
+{
+    static const long double inv_odd[20] = {
+        1.0L / 3,  1.0L / 5,  1.0L / 7,  1.0L / 9,  1.0L / 11, 1.0L / 13, 1.0L / 15,
+        1.0L / 17, 1.0L / 19, 1.0L / 21, 1.0L / 23, 1.0L / 25, 1.0L / 27, 1.0L / 29,
+        1.0L / 31, 1.0L / 33, 1.0L / 35, 1.0L / 37, 1.0L / 39, 1.0L / 41
+    };
+    unsigned    e   = 63u - (unsigned)__builtin_clzll(v);
+    long double m   = (long double)v / (long double)(1ull << e);
+    long double z   = (m - 1.0L) / (m + 1.0L), z2 = z * z;
+    long double acc = 0.0L;
+    for (int k = 19; k >= 0; --k) {
+        acc = (acc + inv_odd[k]) * z2;
+    }
+    return (long double)e + 2.0L * z * (1.0L + acc) * LOG2_E;
+}
+
+int bignum_cmp_decstr(const bignum_t *a, const char *s, size_t n)
+{
+    if (a == NULL || s == NULL) {
+        return BIGNUM_CMP_ERROR_NULL;
+    }
+    if (a->len > BIGNUM_CAPACITY) {
+        return BIGNUM_CMP_STR_ERROR_RANGE;
+    }
+    if (n == 0 || !valid_dec(s, n)) {
+        return BIGNUM_CMP_STR_ERROR_SYNTAX;
+    }
+    s = skip_zeros(s, &n);
+
+    size_t len  = eff_len(a);
+    size_t bits = len == 0 ? 0 : 64 * len - (size_t)__builtin_clzll(a->words[len - 1]);
+    if (n == 0 || bits == 0) {
+        return (bits > 0) - (n > 0);
+    }
+    if (n <= DEC_CHUNK && bits <= 64) {
+        return sign_u64(a->words[0], dec_u64(s, n));
+    }
+
+    /* Границы десятичной длины a по битовой длине. */
+    size_t dlo = (((bits - 1) * 1233) >> 12) + 1;
+    size_t dhi = ((bits * 1234) >> 12) + 1;
+    if (n < dlo) {
+        return BIGNUM_CMP_GREATER;
+    }
+    if (n > dhi) {
+        return BIGNUM_CMP_LESS;
+    }
+
+    /* Оценки log2 по старшим цифрам строки и старшим битам a. */
+    size_t      k  = n < DEC_CHUNK ? n : DEC_CHUNK;
+    uint64_t    p  = dec_u64(s, k);
+    long double rs = (long double)(n - k) * LOG2_10;
+    long double xl = log2_u64(p) + rs;
+    long double xh = (n > k) ? xl + LOG2_E / (long double)p : xl;   /* log2(1 + 1/P) <= 1/(P·ln2) */
+
+    uint64_t top = a->words[len - 1], t = top;
+    unsigned lz  = (unsigned)__builtin_clzll(top);
+    if (len > 1 && lz > 0) {
+        t = top << lz | a->words[len - 2] >> (64 - lz);
+    }
+    long double sh = (bits > 64) ? (long double)(bits - 64) : 0.0L;
+    long double al = log2_u64(t) + sh;
+    long double ah = (bits > 64) ? al + LOG2_E / (long double)t : al;
+
+    if (ah + LOG_EPS < xl) {
+        return BIGNUM_CMP_LESS;
+    }
+    if (xh + LOG_EPS < al) {
+        return BIGNUM_CMP_GREATER;
+    }
+    return cmp_dec_full(a, s, n);
+}
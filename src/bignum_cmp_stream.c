@@ -0,0 +1,82 @@
+/**
+ * @file    bignum_cmp_stream.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация потокового сравнения большого числа, поступающего частями.
+ *
+ * @details
+ * ### Алгоритм
+ * 1.  Эталон с `len > BIGNUM_CAPACITY` отклоняется (`ERROR_RANGE`) до
+ *     любого чтения `words`.
+ * 2.  При инициализации сравниваются длины. Если `len != ref->len`, результат
+ *     фиксируется сразу — так же, как ветка `.diff_len` в `bignum_cmp`.
+ * 3.  Иначе каждое принятое слово сравнивается с `ref->words[len - 1 - pos]`.
+ *     Первое различие фиксирует результат (`1` или `-1`).
+ * 4.  Когда приняты все `len` слов без различий, результат — `0`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная реализация.
+ *   - rev. 2 (16.10.2026): Проверка `ref->len > BIGNUM_CAPACITY`.
+ */
+
+#include "bignum_cmp_stream.h"
+
+int bignum_cmp_stream_init(bignum_cmp_stream_t *s, const bignum_t *ref, size_t len)
+{
+    if (s == NULL || ref == NULL) {
+        return BIGNUM_CMP_ERROR_NULL;
+    }
+
+    s->ref = ref;
+    s->len = len;
+    s->pos = 0;
+
+    if (ref->len > BIGNUM_CAPACITY) {
+        s->state = BIGNUM_CMP_STREAM_ERROR_RANGE;   /* update не читает words */
+    } else if (len != ref->len) {
+        s->state = (len > ref->len) ? BIGNUM_CMP_GREATER : BIGNUM_CMP_LESS;
+    } else if (len == 0) {
+        s->state = BIGNUM_CMP_EQ;
+    } else {
+        s->state = BIGNUM_CMP_STREAM_PENDING;
+    }
+    return s->state;
+}
+
+int bignum_cmp_stream_update(bignum_cmp_stream_t *s, const uint64_t *limbs, size_t count)
+{
+    if (s == NULL || (limbs == NULL && count != 0)) {
+        return BIGNUM_CMP_ERROR_NULL;
+    }
+    if (count > s->len - s->pos) {
+        return BIGNUM_CMP_STREAM_ERROR_OVERFLOW;
+    }
+
+    if (s->state == BIGNUM_CMP_STREAM_PENDING) {
+        /* ref->words[top - i] — слово эталона, парное limbs[i]. */
+        const uint64_t *top = &s->ref->words[s->len - 1 - s->pos];
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t r = *(top - i);
+            if (limbs[i] != r) {
+                s->state = (limbs[i] > r) ? BIGNUM_CMP_GREATER : BIGNUM_CMP_LESS;
+                break;
+            }
+        }
+    }
+
+    s->pos += count;
+    if (s->state == BIGNUM_CMP_STREAM_PENDING && s->pos == s->len) {
+        s->state = BIGNUM_CMP_EQ;
+    }
+    return s->state;
+}
+
+int bignum_cmp_stream_result(const bignum_cmp_stream_t *s)
+{
+    if (s == NULL) {
+        return BIGNUM_CMP_ERROR_NULL;
+    }
+    return s->state;
+}
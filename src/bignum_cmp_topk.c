@@ -0,0 +1,497 @@
+/**
+ * @file    bignum_cmp_topk.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация nth_element, partial_sort и top-k по префиксным записям.
+ *
+ * @details Запись — `bignum_topk_entry_t`: (`len`, старшее слово, номер
+ *          элемента в `base`). Сравнение записей сначала без ветвлений по
+ *          префиксу, при равенстве префиксов — `bignum_cmp` исходных чисел.
+ *
+ *          Трёхпутевое разбиение — два прохода Ломуто без ветвлений:
+ *          первый отделяет `< p`, второй внутри остатка отделяет `== p`.
+ *          Запись опорного элемента копируется в локальную переменную
+ *          (её префикс остаётся в регистрах на весь проход). Глубина рекурсии
+ *          ограничена `2 * log2(n)`, дальше — пирамидальная сортировка.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ *   - rev. 2 (16.10.2026): Многопоточный вариант выполняется в пуле `bignum_parallel_for`.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "bignum_cmp_topk.h"
+#include "bignum_cmp_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef bignum_topk_entry_t rec_t;
+
+#define SMALL_SORT 16
+#define MIN_CHUNK  65536                /* элементов на поток, не меньше */
+
+/** Знак сравнения префиксов без ветвлений. */
+static inline int prefix_sign(const rec_t *x, const rec_t *y)
+{
+    int c = (x->len > y->len) - (x->len < y->len);
+    int t = (x->top > y->top) - (x->top < y->top);
+    return c ? c : t;
+}
+
+static inline int rec_cmp(const rec_t *x, const rec_t *y, const bignum_t *base)
+{
+    int c = prefix_sign(x, y);
+    return c ? c : bignum_cmp(&base[x->idx], &base[y->idx]);
+}
+
+static inline void make_rec(rec_t *r, const bignum_t *x, uint32_t idx)
+{
+    r->len = (uint32_t)x->len;
+    r->top = (x->len > 0) ? x->words[x->len - 1] : 0;
+    r->idx = idx;
+}
+
+static inline void rec_swap(rec_t *a, rec_t *b)
+{
+    rec_t t = *a;
+    *a = *b;
+    *b = t;
+}
+
+static void insertion_sort(rec_t *r, size_t n, const bignum_t *base)
+{
+    for (size_t i = 1; i < n; ++i) {
+        rec_t x = r[i];
+        size_t j = i;
+        while (j > 0 && rec_cmp(&x, &r[j - 1], base) < 0) {
+            r[j] = r[j - 1];
+            --j;
+        }
+        r[j] = x;
+    }
+}
+
+static void sift_down_max(rec_t *r, size_t i, size_t n, const bignum_t *base)
+{
+    for (;;) {
+        size_t c = 2 * i + 1;
+        if (c >= n) {
+            return;
+        }
+        if (c + 1 < n && rec_cmp(&r[c + 1], &r[c], base) > 0) {
+            ++c;
+        }
+        if (rec_cmp(&r[c], &r[i], base) <= 0) {
+            return;
+        }
+        rec_swap(&r[c], &r[i]);
+        i = c;
+    }
+}
+
+static void heap_sort(rec_t *r, size_t n, const bignum_t *base)
+{
+    for (size_t i = n / 2; i-- > 0; ) {
+        sift_down_max(r, i, n, base);
+    }
+    for (size_t end = n; end-- > 1; ) {
+        rec_swap(&r[0], &r[end]);
+        sift_down_max(r, 0, end, base);
+    }
+}
+
+static inline const rec_t *median3(const rec_t *a, const rec_t *b, const rec_t *c, const bignum_t *base)
+{
+    if (rec_cmp(a, b, base) < 0) {
+        return (rec_cmp(b, c, base) < 0) ? b : (rec_cmp(a, c, base) < 0) ? c : a;
+    }
+    return (rec_cmp(a, c, base) < 0) ? a : (rec_cmp(b, c, base) < 0) ? c : b;
+}
+
+/**
+ * @brief Трёхпутевое разбиение: `[0, *lt)` < p, `[*lt, *gt)` == p, `[*gt, n)` > p.
+ */
+static void partition3(rec_t *r, size_t n, const bignum_t *base, size_t *lt, size_t *gt)
+{
+    const rec_t *pp;
+    if (n > 128) {
+        size_t s = n / 8;
+        pp = median3(median3(&r[0], &r[s], &r[2 * s], base),
+                     median3(&r[3 * s], &r[n / 2], &r[5 * s], base),
+                     median3(&r[6 * s], &r[7 * s], &r[n - 1], base), base);
+    } else {
+        pp = median3(&r[0], &r[n / 2], &r[n - 1], base);
+    }
+    const rec_t p = *pp;
+
+    size_t j = 0;
+    for (size_t i = 0; i < n; ++i) {
+        rec_t x = r[i];
+        size_t less = (size_t)(rec_cmp(&x, &p, base) < 0);
+        r[i] = r[j];
+        r[j] = x;
+        j += less;
+    }
+    *lt = j;
+    for (size_t i = j; i < n; ++i) {
+        rec_t x = r[i];
+        size_t equal = (size_t)(rec_cmp(&x, &p, base) <= 0);
+        r[i] = r[j];
+        r[j] = x;
+        j += equal;
+    }
+    *gt = j;
+}
+
+static unsigned depth_limit(size_t n)
+{
+    unsigned d = 0;
+    while (n > 1) {
+        n >>= 1;
+        d += 2;
+    }
+    return d;
+}
+
+static void sort_recs(rec_t *r, size_t n, const bignum_t *base, unsigned depth)
+{
+    while (n > SMALL_SORT) {
+        if (depth-- == 0) {
+            heap_sort(r, n, base);
+            return;
+        }
+        size_t lt, gt;
+        partition3(r, n, base, &lt, &gt);
+        if (lt < n - gt) {
+            sort_recs(r, lt, base, depth);
+            r += gt;
+            n -= gt;
+        } else {
+            sort_recs(r + gt, n - gt, base, depth);
+            n = lt;
+        }
+    }
+    insertion_sort(r, n, base);
+}
+
+static void nth_recs(rec_t *r, size_t n, size_t k, const bignum_t *base)
+{
+    unsigned depth = depth_limit(n);
+    while (n > SMALL_SORT) {
+        if (depth-- == 0) {
+            heap_sort(r, n, base);
+            return;
+        }
+        size_t lt, gt;
+        partition3(r, n, base, &lt, &gt);
+        if (k < lt) {
+            n = lt;
+        } else if (k >= gt) {
+            r += gt;
+            n -= gt;
+            k -= gt;
+        } else {
+            return;
+        }
+    }
+    insertion_sort(r, n, base);
+}
+
+/** Ставит `a[r[i].idx]` на место `i` обходом циклов перестановки. */
+static void apply_perm(bignum_t *a, rec_t *r, size_t n)
+{
+    bignum_t tmp;
+    for (size_t i = 0; i < n; ++i) {
+        if (r[i].idx == i) {
+            continue;
+        }
+        memcpy(&tmp, &a[i], sizeof(tmp));
+        size_t j = i;
+        for (;;) {
+            size_t src = r[j].idx;
+            r[j].idx = (uint32_t)j;
+            if (src == i) {
+                break;
+            }
+            memcpy(&a[j], &a[src], sizeof(bignum_t));
+            j = src;
+        }
+        memcpy(&a[j], &tmp, sizeof(tmp));
+    }
+}
+
+/** Проверяет массив и строит записи; `*out == NULL` при `n == 0`. */
+static bignum_topk_status_t make_recs(const bignum_t *a, size_t n, rec_t **out)
+{
+    *out = NULL;
+    if (n > UINT32_MAX) {
+        return BIGNUM_TOPK_ERROR_RANGE;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (a[i].len > BIGNUM_CAPACITY) {
+            return BIGNUM_TOPK_ERROR_RANGE;
+        }
+    }
+    if (n == 0) {
+        return BIGNUM_TOPK_OK;
+    }
+    rec_t *r = malloc(n * sizeof(rec_t));
+    if (r == NULL) {
+        return BIGNUM_TOPK_ERROR_NOMEM;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        make_rec(&r[i], &a[i], (uint32_t)i);
+    }
+    *out = r;
+    return BIGNUM_TOPK_OK;
+}
+
+bignum_topk_status_t bignum_nth_element(bignum_t *a, size_t n, size_t k)
+{
+    if (a == NULL) {
+        return BIGNUM_TOPK_ERROR_NULL;
+    }
+    if (k >= n) {
+        return BIGNUM_TOPK_ERROR_RANGE;
+    }
+    rec_t *r;
+    bignum_topk_status_t st = make_recs(a, n, &r);
+    if (st != BIGNUM_TOPK_OK) {
+        return st;
+    }
+    nth_recs(r, n, k, a);
+    apply_perm(a, r, n);
+    free(r);
+    return BIGNUM_TOPK_OK;
+}
+
+bignum_topk_status_t bignum_partial_sort(bignum_t *a, size_t n, size_t k)
+{
+    if (a == NULL) {
+        return BIGNUM_TOPK_ERROR_NULL;
+    }
+    if (k > n) {
+        return BIGNUM_TOPK_ERROR_RANGE;
+    }
+    rec_t *r;
+    bignum_topk_status_t st = make_recs(a, n, &r);
+    if (st != BIGNUM_TOPK_OK || k == 0) {
+        free(r);
+        return st;
+    }
+    if (k < n) {
+        nth_recs(r, n, k, a);
+    }
+    sort_recs(r, k, a, depth_limit(k));
+    apply_perm(a, r, n);
+    free(r);
+    return BIGNUM_TOPK_OK;
+}
+
+/* ---- Потоковый top-k: min-куча по слотам ---- */
+
+static void heap_sift_up(bignum_topk_t *t, size_t i)
+{
+    rec_t x = t->heap[i];
+    while (i > 0) {
+        size_t p = (i - 1) / 2;
+        if (rec_cmp(&t->heap[p], &x, t->slots) <= 0) {
+            break;
+        }
+        t->heap[i] = t->heap[p];
+        i = p;
+    }
+    t->heap[i] = x;
+}
+
+static void heap_sift_down(bignum_topk_t *t, size_t i)
+{
+    rec_t  x = t->heap[i];
+    size_t n = t->size;
+    for (;;) {
+        size_t c = 2 * i + 1;
+        if (c >= n) {
+            break;
+        }
+        if (c + 1 < n && rec_cmp(&t->heap[c + 1], &t->heap[c], t->slots) < 0) {
+            ++c;
+        }
+        if (rec_cmp(&x, &t->heap[c], t->slots) <= 0) {
+            break;
+        }
+        t->heap[i] = t->heap[c];
+        i = c;
+    }
+    t->heap[i] = x;
+}
+
+bignum_topk_status_t bignum_topk_init(bignum_topk_t *t, size_t k)
+{
+    if (t == NULL) {
+        return BIGNUM_TOPK_ERROR_NULL;
+    }
+    memset(t, 0, sizeof(*t));
+    if (k == 0 || k > UINT32_MAX) {
+        return BIGNUM_TOPK_ERROR_RANGE;
+    }
+    t->heap  = malloc(k * sizeof(rec_t));
+    t->slots = malloc(k * sizeof(bignum_t));
+    if (t->heap == NULL || t->slots == NULL) {
+        bignum_topk_free(t);
+        return BIGNUM_TOPK_ERROR_NOMEM;
+    }
+    t->k = k;
+    return BIGNUM_TOPK_OK;
+}
+
+void bignum_topk_free(bignum_topk_t *t)
+{
+    if (t == NULL) {
+        return;
+    }
+    free(t->heap);
+    free(t->slots);
+    memset(t, 0, sizeof(*t));
+}
+
+/** Учитывает `x`; проверки аргументов — у вызывающей стороны. */
+static inline void topk_push(bignum_topk_t *t, const bignum_t *x)
+{
+    rec_t xr;
+    make_rec(&xr, x, 0);
+    if (t->size < t->k) {
+        size_t i = t->size++;
+        xr.idx = (uint32_t)i;
+        memcpy(&t->slots[i], x, sizeof(bignum_t));
+        t->heap[i] = xr;
+        heap_sift_up(t, i);
+        return;
+    }
+    /* Отсев по префиксу корня; полное сравнение — только при равных префиксах. */
+    const rec_t *root = &t->heap[0];
+    int c = prefix_sign(&xr, root);
+    if (c < 0 || (c == 0 && bignum_cmp(x, &t->slots[root->idx]) <= 0)) {
+        return;
+    }
+    xr.idx = root->idx;
+    memcpy(&t->slots[xr.idx], x, sizeof(bignum_t));
+    t->heap[0] = xr;
+    heap_sift_down(t, 0);
+}
+
+bignum_topk_status_t bignum_topk_push(bignum_topk_t *t, const bignum_t *x)
+{
+    if (t == NULL || x == NULL || t->heap == NULL) {
+        return BIGNUM_TOPK_ERROR_NULL;
+    }
+    if (x->len > BIGNUM_CAPACITY) {
+        return BIGNUM_TOPK_ERROR_RANGE;
+    }
+    topk_push(t, x);
+    return BIGNUM_TOPK_OK;
+}
+
+bignum_topk_status_t bignum_topk_push_batch(bignum_topk_t *t, const bignum_t *xs, size_t n)
+{
+    if (t == NULL || t->heap == NULL || (xs == NULL && n > 0)) {
+        return BIGNUM_TOPK_ERROR_NULL;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (xs[i].len > BIGNUM_CAPACITY) {
+            return BIGNUM_TOPK_ERROR_RANGE;
+        }
+        topk_push(t, &xs[i]);
+    }
+    return BIGNUM_TOPK_OK;
+}
+
+bignum_topk_status_t bignum_topk_merge(bignum_topk_t *dst, const bignum_topk_t *src)
+{
+    if (dst == NULL || src == NULL || dst->heap == NULL || src->heap == NULL) {
+        return BIGNUM_TOPK_ERROR_NULL;
+    }
+    for (size_t i = 0; i < src->size; ++i) {
+        topk_push(dst, &src->slots[src->heap[i].idx]);
+    }
+    return BIGNUM_TOPK_OK;
+}
+
+bignum_topk_status_t bignum_topk_result(const bignum_topk_t *t, bignum_t *out, size_t *count)
+{
+    if (t == NULL || out == NULL || count == NULL || t->heap == NULL) {
+        return BIGNUM_TOPK_ERROR_NULL;
+    }
+    rec_t *r = malloc((t->size ? t->size : 1) * sizeof(rec_t));
+    if (r == NULL) {
+        return BIGNUM_TOPK_ERROR_NOMEM;
+    }
+    memcpy(r, t->heap, t->size * sizeof(rec_t));
+    sort_recs(r, t->size, t->slots, depth_limit(t->size));
+    for (size_t i = 0; i < t->size; ++i) {
+        memcpy(&out[i], &t->slots[r[t->size - 1 - i].idx], sizeof(bignum_t));
+    }
+    *count = t->size;
+    free(r);
+    return BIGNUM_TOPK_OK;
+}
+
+bignum_topk_status_t bignum_topk(const bignum_t *a, size_t n, size_t k, bignum_t *out, size_t *count)
+{
+    return bignum_topk_mt(a, n, k, 1, out, count);
+}
+
+typedef struct {
+    const bignum_t      *a;
+    size_t               n;
+    bignum_topk_t        t;
+    bignum_topk_status_t st;
+} topk_job_t;
+
+static void topk_jobs(size_t begin, size_t end, void *arg)
+{
+    topk_job_t *jobs = arg;
+    for (size_t i = begin; i < end; ++i) {
+        jobs[i].st = bignum_topk_push_batch(&jobs[i].t, jobs[i].a, jobs[i].n);
+    }
+}
+
+bignum_topk_status_t bignum_topk_mt(const bignum_t *a, size_t n, size_t k, unsigned threads,
+                                    bignum_t *out, size_t *count)
+{
+    if ((a == NULL && n > 0) || out == NULL || count == NULL) {
+        return BIGNUM_TOPK_ERROR_NULL;
+    }
+    threads = bignum_pool_parts(threads, n, MIN_CHUNK);
+
+    topk_job_t *jobs = calloc(threads, sizeof(topk_job_t));
+    if (jobs == NULL) {
+        return BIGNUM_TOPK_ERROR_NOMEM;
+    }
+
+    bignum_topk_status_t st = BIGNUM_TOPK_OK;
+    for (unsigned i = 0; i < threads && st == BIGNUM_TOPK_OK; ++i) {
+        size_t lo = n * i / threads, hi = n * (i + 1) / threads;
+        jobs[i].a = a + lo;
+        jobs[i].n = hi - lo;
+        st = bignum_topk_init(&jobs[i].t, k);
+    }
+    if (st == BIGNUM_TOPK_OK && bignum_parallel_for(threads, 1, topk_jobs, jobs) != BIGNUM_POOL_OK) {
+        st = BIGNUM_TOPK_ERROR_THREAD;
+    }
+    for (unsigned i = 0; i < threads && st == BIGNUM_TOPK_OK; ++i) {
+        st = jobs[i].st;
+    }
+    for (unsigned i = 1; i < threads && st == BIGNUM_TOPK_OK; ++i) {
+        st = bignum_topk_merge(&jobs[0].t, &jobs[i].t);
+    }
+    if (st == BIGNUM_TOPK_OK) {
+        st = bignum_topk_result(&jobs[0].t, out, count);
+    }
+    for (unsigned i = 0; i < threads; ++i) {
+        bignum_topk_free(&jobs[i].t);
+    }
+    free(jobs);
+    return st;
+}
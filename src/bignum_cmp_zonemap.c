@@ -0,0 +1,194 @@
+/**
+ * @file    bignum_cmp_zonemap.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Реализация зональной карты по префиксам ключей.
+ *
+ * @details Сравнение ключа со сводкой: сначала `len`, затем старшее слово;
+ *          при равенстве обоих — полный `bignum_cmp` со строкой столбца, на
+ *          которую указывает сводка. Дописывание строк обновляет min/max
+ *          последнего блока тем же сравнением и открывает новые блоки по мере
+ *          заполнения.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальная версия.
+ */
+
+#include "bignum_cmp_zonemap.h"
+#include <stdlib.h>
+#include <string.h>
+
+_Static_assert(sizeof(bignum_zonemap_zone_t) == 32, "zone summary must stay 32 bytes");
+_Static_assert(BIGNUM_CAPACITY <= UINT16_MAX, "len must fit uint16_t");
+
+static inline uint64_t top_word(const bignum_t *x)
+{
+    return (x->len > 0) ? x->words[x->len - 1] : 0;
+}
+
+/** Знак `x - (len, top, column[row])`; полный ключ читается только при равных префиксах. */
+static inline int cmp_summary(const bignum_t *x, uint16_t len, uint64_t top,
+                              const bignum_t *column, uint32_t row)
+{
+    if (x->len != len) {
+        return (x->len > len) ? 1 : -1;
+    }
+    uint64_t xt = top_word(x);
+    if (xt != top) {
+        return (xt > top) ? 1 : -1;
+    }
+    return bignum_cmp(x, &column[row]);
+}
+
+static inline void set_min(bignum_zonemap_zone_t *zn, const bignum_t *x, size_t row)
+{
+    zn->min_len = (uint16_t)x->len;
+    zn->min_top = top_word(x);
+    zn->min_row = (uint32_t)row;
+}
+
+static inline void set_max(bignum_zonemap_zone_t *zn, const bignum_t *x, size_t row)
+{
+    zn->max_len = (uint16_t)x->len;
+    zn->max_top = top_word(x);
+    zn->max_row = (uint32_t)row;
+}
+
+bignum_zonemap_status_t bignum_zonemap_init(bignum_zonemap_t *z, size_t block_rows)
+{
+    if (z == NULL) {
+        return BIGNUM_ZONEMAP_ERROR_NULL;
+    }
+    memset(z, 0, sizeof(*z));
+    z->block_rows = block_rows ? block_rows : BIGNUM_ZONEMAP_DEFAULT_BLOCK;
+    return BIGNUM_ZONEMAP_OK;
+}
+
+void bignum_zonemap_free(bignum_zonemap_t *z)
+{
+    if (z == NULL) {
+        return;
+    }
+    free(z->zones);
+    memset(z, 0, sizeof(*z));
+}
+
+bignum_zonemap_status_t bignum_zonemap_append(bignum_zonemap_t *z, const bignum_t *column, size_t rows)
+{
+    if (z == NULL || (column == NULL && rows > 0)) {
+        return BIGNUM_ZONEMAP_ERROR_NULL;
+    }
+    if (z->block_rows == 0 || rows < z->rows || rows > UINT32_MAX) {
+        return BIGNUM_ZONEMAP_ERROR_RANGE;
+    }
+    for (size_t r = z->rows; r < rows; ++r) {
+        if (column[r].len > BIGNUM_CAPACITY) {
+            return BIGNUM_ZONEMAP_ERROR_RANGE;
+        }
+    }
+
+    size_t need = (rows + z->block_rows - 1) / z->block_rows;
+    if (need > z->cap_zones) {
+        size_t cap = z->cap_zones ? z->cap_zones : 16;
+        while (cap < need) {
+            cap *= 2;
+        }
+        bignum_zonemap_zone_t *zones = realloc(z->zones, cap * sizeof(*zones));
+        if (zones == NULL) {
+            return BIGNUM_ZONEMAP_ERROR_NOMEM;
+        }
+        z->zones     = zones;
+        z->cap_zones = cap;
+    }
+
+    for (size_t r = z->rows; r < rows; ++r) {
+        const bignum_t *x = &column[r];
+        size_t b = r / z->block_rows;
+        bignum_zonemap_zone_t *zn = &z->zones[b];
+        if (r % z->block_rows == 0) {
+            memset(zn, 0, sizeof(*zn));
+            set_min(zn, x, r);
+            set_max(zn, x, r);
+            continue;
+        }
+        if (cmp_summary(x, zn->min_len, zn->min_top, column, zn->min_row) < 0) {
+            set_min(zn, x, r);
+        } else if (cmp_summary(x, zn->max_len, zn->max_top, column, zn->max_row) > 0) {
+            set_max(zn, x, r);
+        }
+    }
+    z->nzones = need;
+    z->rows   = rows;
+    return BIGNUM_ZONEMAP_OK;
+}
+
+bignum_zonemap_class_t bignum_zonemap_classify(const bignum_zonemap_t *z, const bignum_t *column, size_t block,
+                                               const bignum_t *lo, const bignum_t *hi)
+{
+    if (z == NULL || column == NULL || block >= z->nzones) {
+        return BIGNUM_ZONEMAP_SKIP;
+    }
+    const bignum_zonemap_zone_t *zn = &z->zones[block];
+    int lo_le_min = 1, max_le_hi = 1;
+
+    if (lo != NULL) {
+        if (cmp_summary(lo, zn->max_len, zn->max_top, column, zn->max_row) > 0) {
+            return BIGNUM_ZONEMAP_SKIP;
+        }
+        lo_le_min = cmp_summary(lo, zn->min_len, zn->min_top, column, zn->min_row) <= 0;
+    }
+    if (hi != NULL) {
+        if (cmp_summary(hi, zn->min_len, zn->min_top, column, zn->min_row) < 0) {
+            return BIGNUM_ZONEMAP_SKIP;
+        }
+        max_le_hi = cmp_summary(hi, zn->max_len, zn->max_top, column, zn->max_row) >= 0;
+    }
+    return (lo_le_min && max_le_hi) ? BIGNUM_ZONEMAP_FULL : BIGNUM_ZONEMAP_PARTIAL;
+}
+
+bignum_zonemap_status_t bignum_zonemap_select(const bignum_zonemap_t *z, const bignum_t *column,
+                                              const bignum_t *lo, const bignum_t *hi,
+                                              size_t *rows, size_t *count, size_t *scanned)
+{
+    if (z == NULL || count == NULL || (column == NULL && z->rows > 0)) {
+        return BIGNUM_ZONEMAP_ERROR_NULL;
+    }
+    if ((lo != NULL && lo->len > BIGNUM_CAPACITY) || (hi != NULL && hi->len > BIGNUM_CAPACITY)) {
+        return BIGNUM_ZONEMAP_ERROR_RANGE;
+    }
+
+    size_t found = 0, compared = 0;
+    for (size_t b = 0; b < z->nzones; ++b) {
+        size_t first = b * z->block_rows;
+        size_t last  = (first + z->block_rows < z->rows) ? first + z->block_rows : z->rows;
+
+        switch (bignum_zonemap_classify(z, column, b, lo, hi)) {
+        case BIGNUM_ZONEMAP_SKIP:
+            break;
+        case BIGNUM_ZONEMAP_FULL:
+            for (size_t r = first; rows != NULL && r < last; ++r) {
+                rows[found + (r - first)] = r;
+            }
+            found += last - first;
+            break;
+        case BIGNUM_ZONEMAP_PARTIAL:
+            compared += last - first;
+            for (size_t r = first; r < last; ++r) {
+                int match = (lo == NULL || bignum_cmp(&column[r], lo) >= 0) &&
+                            (hi == NULL || bignum_cmp(&column[r], hi) <= 0);
+                if (match && rows != NULL) {
+                    rows[found] = r;
+                }
+                found += (size_t)match;
+            }
+            break;
+        }
+    }
+    *count = found;
+    if (scanned != NULL) {
+        *scanned = compared;
+    }
+    return BIGNUM_ZONEMAP_OK;
+}
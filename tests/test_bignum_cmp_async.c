@@ -0,0 +1,405 @@
+/**
+ * @file    test_bignum_cmp_async.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты асинхронной очереди заданий.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Операции:** `test_ops` — CMP, SORT, LOWER_BOUND и UPPER_BOUND через
+ *     очередь из 2 потоков совпадают с прямыми вызовами; пустые задания.
+ * 2.  **Обратное давление:** `test_backpressure` — при `entries = 4` пятое
+ *     задание получает `BIGNUM_ASYNC_BUSY`, пока не забрано завершение;
+ *     `submit_batch` принимает ровно свободное место.
+ * 3.  **eventfd:** `test_eventfd` — `fd` читаем, пока есть несобранные
+ *     завершения, и сброшен после `reap`.
+ * 4.  **Отмена:** `test_cancel` — задание за долгой сортировкой снимается до
+ *     начала; отмена выполняемого задания согласована с его завершением;
+ *     неизвестный `user_data`.
+ * 5.  **Конкурентная отправка:** `test_concurrent_submit` — 4 потока
+ *     отправляют задания с повтором при `BUSY`, главный поток собирает все
+ *     завершения.
+ * 6.  **Ошибки:** `test_errors` — `NULL`, неизвестная операция, `entries = 0`.
+ *
+ * @note Для сборки этого теста требуется флаг `-pthread`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_async.h"
+#include "bignum_cmp_search.h"
+#include <bignum_common.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static void random_bignum(bignum_t *x)
+{
+    uint64_t w[4];
+    size_t len = 1 + (size_t)(rand() % 4);
+    for (size_t i = 0; i < len; ++i) {
+        w[i] = ((uint64_t)rand() << 32) ^ (uint64_t)rand();
+    }
+    w[len - 1] |= 1;
+    bignum_init_from_array(x, w, len);
+}
+
+static bignum_t *random_array(size_t n)
+{
+    bignum_t *a = malloc(sizeof(bignum_t) * (n ? n : 1));
+    for (size_t i = 0; a != NULL && i < n; ++i) {
+        random_bignum(&a[i]);
+    }
+    return a;
+}
+
+static int fd_readable(const bignum_async_t *q)
+{
+    struct pollfd p = { .fd = q->fd, .events = POLLIN };
+    return poll(&p, 1, 0) == 1;
+}
+
+/** Собирает `n` завершений в `status[user_data]`. */
+static int collect(bignum_async_t *q, int *status, size_t n)
+{
+    bignum_async_cqe_t cqe[8];
+    size_t got = 0;
+    while (got < n) {
+        size_t k = bignum_async_wait(q, cqe, 8);
+        if (k == 0) {
+            return 0;
+        }
+        for (size_t i = 0; i < k; ++i) {
+            status[cqe[i].user_data] = cqe[i].status;
+        }
+        got += k;
+    }
+    return bignum_async_pending(q) == 0;
+}
+
+/** @brief Тест: результаты всех операций. */
+int test_ops() {
+    const size_t n = 10000, m = 9000;
+    bignum_t *a = random_array(n), *b = random_array(n), *data = random_array(n);
+    int *cmp = malloc(sizeof(int) * n);
+    size_t *lo = malloc(sizeof(size_t) * m), *hi = malloc(sizeof(size_t) * m);
+    size_t *ref = malloc(sizeof(size_t) * m);
+    bignum_t *keys = random_array(n);
+    bignum_async_t q;
+    int ok = a && b && data && cmp && lo && hi && ref && keys
+          && bignum_async_init(&q, 16, 2) == BIGNUM_ASYNC_OK && q.threads == 2 && q.fd >= 0;
+    if (!ok) {
+        return 0;
+    }
+
+    /* Ключи для поиска сортируем тоже через очередь. */
+    bignum_async_sqe_t s0 = { .op = BIGNUM_ASYNC_OP_SORT, .user_data = 0, .data = keys, .n = n };
+    int status[8] = { -100, -100, -100, -100, -100, -100, -100, -100 };
+    ok = bignum_async_submit(&q, &s0) == BIGNUM_ASYNC_OK && collect(&q, status, 1) && status[0] == BIGNUM_ASYNC_OK;
+
+    bignum_async_sqe_t s[5] = {
+        { .op = BIGNUM_ASYNC_OP_CMP, .user_data = 1, .a = a, .b = b, .n = n, .cmp_out = cmp },
+        { .op = BIGNUM_ASYNC_OP_SORT, .user_data = 2, .data = data, .n = n },
+        { .op = BIGNUM_ASYNC_OP_LOWER_BOUND, .user_data = 3, .a = keys, .n = n, .b = a, .m = m, .pos_out = lo },
+        { .op = BIGNUM_ASYNC_OP_UPPER_BOUND, .user_data = 4, .a = keys, .n = n, .b = a, .m = m, .pos_out = hi },
+        { .op = BIGNUM_ASYNC_OP_CMP, .user_data = 5 },              /* пустое задание */
+    };
+    size_t submitted = 0;
+    ok = ok && bignum_async_submit_batch(&q, s, 5, &submitted) == BIGNUM_ASYNC_OK && submitted == 5
+            && collect(&q, status, 5);
+    for (int i = 0; ok && i <= 5; ++i) {
+        ok = status[i] == BIGNUM_ASYNC_OK;
+    }
+
+    for (size_t i = 0; ok && i < n; ++i) {
+        ok = cmp[i] == bignum_cmp(&a[i], &b[i]);
+    }
+    for (size_t i = 1; ok && i < n; ++i) {
+        ok = bignum_cmp(&keys[i - 1], &keys[i]) <= 0 && bignum_cmp(&data[i - 1], &data[i]) <= 0;
+    }
+    ok = ok && bignum_lower_bound_batch(keys, n, a, m, ref) == BIGNUM_SEARCH_OK
+            && memcmp(lo, ref, sizeof(size_t) * m) == 0;
+    ok = ok && bignum_upper_bound_batch(keys, n, a, m, ref) == BIGNUM_SEARCH_OK
+            && memcmp(hi, ref, sizeof(size_t) * m) == 0;
+
+    bignum_async_free(&q);
+    ok = ok && q.ring == NULL && q.fd == -1;
+    free(a); free(b); free(data); free(cmp); free(lo); free(hi); free(ref); free(keys);
+    return ok;
+}
+
+/** @brief Тест: обратное давление. */
+int test_backpressure() {
+    bignum_async_t q;
+    bignum_async_sqe_t s = { .op = BIGNUM_ASYNC_OP_CMP };
+    bignum_async_cqe_t cqe[4];
+    int ok = bignum_async_init(&q, 4, 1) == BIGNUM_ASYNC_OK;
+    for (uint64_t i = 0; ok && i < 4; ++i) {
+        s.user_data = i;
+        ok = bignum_async_submit(&q, &s) == BIGNUM_ASYNC_OK;
+    }
+    ok = ok && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_BUSY && bignum_async_pending(&q) == 4;
+    ok = ok && bignum_async_wait(&q, cqe, 1) == 1;
+    ok = ok && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_OK
+            && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_BUSY;
+
+    /* Освободить два места: пакет из трёх принимается частично. */
+    size_t got = 0, submitted = 0;
+    while (ok && got < 2) {
+        got += bignum_async_wait(&q, cqe, 2 - got);
+    }
+    bignum_async_sqe_t batch[3] = { s, s, s };
+    ok = ok && bignum_async_submit_batch(&q, batch, 3, &submitted) == BIGNUM_ASYNC_BUSY && submitted == 2;
+    while (ok && bignum_async_wait(&q, cqe, 4) > 0) {
+    }
+    ok = ok && bignum_async_pending(&q) == 0;
+    bignum_async_free(&q);
+    return ok;
+}
+
+/** @brief Тест: сигнал eventfd. */
+int test_eventfd() {
+    const size_t n = 1000;
+    bignum_t *a = random_array(n);
+    int *cmp = malloc(sizeof(int) * n);
+    bignum_async_t q;
+    bignum_async_cqe_t cqe[2];
+    int ok = a && cmp && bignum_async_init(&q, 8, 1) == BIGNUM_ASYNC_OK && !fd_readable(&q);
+    bignum_async_sqe_t s = { .op = BIGNUM_ASYNC_OP_CMP, .user_data = 7, .a = a, .b = a, .n = n, .cmp_out = cmp };
+    ok = ok && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_OK && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_OK;
+
+    struct pollfd p = { .fd = q.fd, .events = POLLIN };
+    ok = ok && poll(&p, 1, 10000) == 1;                  /* первое завершение будит цикл */
+    size_t got = bignum_async_reap(&q, cqe, 2);
+    ok = ok && got >= 1 && cqe[0].user_data == 7 && cqe[0].status == BIGNUM_ASYNC_OK;
+    if (ok && got == 1) {
+        ok = poll(&p, 1, 10000) == 1 && bignum_async_reap(&q, cqe, 2) == 1;
+    }
+    ok = ok && !fd_readable(&q) && bignum_async_reap(&q, cqe, 2) == 0 && bignum_async_pending(&q) == 0;
+    ok = ok && bignum_async_wait(&q, cqe, 2) == 0;      /* нечего ждать */
+    for (size_t i = 0; ok && i < n; ++i) {
+        ok = cmp[i] == 0;
+    }
+    bignum_async_free(&q);
+    free(a);
+    free(cmp);
+    return ok;
+}
+
+/** @brief Тест: отмена. */
+int test_cancel() {
+    const size_t big = 200000, n = 20 * BIGNUM_ASYNC_CHUNK;
+    bignum_t *data = random_array(big), *a = random_array(n);
+    int *cmp = malloc(sizeof(int) * n);
+    bignum_async_t q;
+    int status[8] = { -100, -100, -100, -100, -100, -100, -100, -100 };
+    int ok = data && a && cmp && bignum_async_init(&q, 8, 1) == BIGNUM_ASYNC_OK;
+
+    /* Одна долгая сортировка занимает единственный поток; задания за ней ждут. */
+    bignum_async_sqe_t s[3] = {
+        { .op = BIGNUM_ASYNC_OP_SORT, .user_data = 0, .data = data, .n = big },
+        { .op = BIGNUM_ASYNC_OP_CMP, .user_data = 1, .a = a, .b = a, .n = n, .cmp_out = cmp },
+        { .op = BIGNUM_ASYNC_OP_CMP, .user_data = 2, .a = a, .b = a, .n = n, .cmp_out = cmp },
+    };
+    ok = ok && bignum_async_submit_batch(&q, s, 3, NULL) == BIGNUM_ASYNC_OK;
+    ok = ok && bignum_async_cancel(&q, 1) == BIGNUM_ASYNC_OK;
+    ok = ok && bignum_async_cancel(&q, 1) != BIGNUM_ASYNC_OK && bignum_async_cancel(&q, 99) == BIGNUM_ASYNC_NOT_FOUND;
+    ok = ok && collect(&q, status, 3)
+            && status[0] == BIGNUM_ASYNC_OK && status[1] == BIGNUM_ASYNC_CANCELED && status[2] == BIGNUM_ASYNC_OK;
+
+    /* Отмена выполняемого задания: итог согласован с ответом cancel. */
+    s[2].user_data = 3;
+    ok = ok && bignum_async_submit(&q, &s[2]) == BIGNUM_ASYNC_OK;
+    bignum_async_status_t c = bignum_async_cancel(&q, 3);
+    ok = ok && collect(&q, status, 1);
+    if (c == BIGNUM_ASYNC_OK) {
+        ok = ok && status[3] == BIGNUM_ASYNC_CANCELED;
+    } else if (c == BIGNUM_ASYNC_RUNNING) {
+        ok = ok && (status[3] == BIGNUM_ASYNC_CANCELED || status[3] == BIGNUM_ASYNC_OK);
+    } else {
+        ok = ok && c == BIGNUM_ASYNC_NOT_FOUND && status[3] == BIGNUM_ASYNC_OK;
+    }
+
+    /* free снимает неначатые и прерывает выполняемые. */
+    ok = ok && bignum_async_submit_batch(&q, s, 3, NULL) == BIGNUM_ASYNC_OK;
+    bignum_async_free(&q);
+    bignum_async_free(&q);
+    free(data);
+    free(a);
+    free(cmp);
+    return ok;
+}
+
+#define PER_PRODUCER 200
+#define SLOTS        4                      /* заданий одного производителя в полёте */
+#define SENTINEL     7                      /* не результат сравнения */
+
+typedef struct {
+    bignum_async_t *q;
+    const bignum_t *a;
+    int            *cmp;                    /* SLOTS срезов по n */
+    size_t          n;
+    unsigned        id;
+    atomic_int      busy[SLOTS];            /* срез занят до разбора завершения */
+    atomic_size_t  *expected;               /* сколько завершений ждёт потребитель */
+} producer_t;
+
+static void *producer(void *arg)
+{
+    producer_t *p = arg;
+    for (unsigned i = 0; i < PER_PRODUCER; ++i) {
+        unsigned slot = i % SLOTS;
+        while (atomic_load_explicit(&p->busy[slot], memory_order_acquire)) {
+            sched_yield();
+        }
+        int *out = p->cmp + slot * p->n;
+        for (size_t j = 0; j < p->n; ++j) {
+            out[j] = SENTINEL;
+        }
+        atomic_store_explicit(&p->busy[slot], 1, memory_order_relaxed);
+        bignum_async_sqe_t s = { .op = BIGNUM_ASYNC_OP_CMP, .user_data = p->id * PER_PRODUCER + i,
+                                 .a = p->a, .b = p->a, .n = p->n, .cmp_out = out };
+        bignum_async_status_t st;
+        while ((st = bignum_async_submit(p->q, &s)) == BIGNUM_ASYNC_BUSY) {
+            sched_yield();
+        }
+        if (st != BIGNUM_ASYNC_OK) {
+            atomic_fetch_sub(p->expected, PER_PRODUCER - i);
+            return p;
+        }
+    }
+    return NULL;
+}
+
+/** @brief Тест: конкурентная отправка. */
+int test_concurrent_submit() {
+    const size_t n = 64;
+    bignum_t *a = random_array(n);
+    unsigned char seen[4 * PER_PRODUCER];
+    memset(seen, 0, sizeof(seen));
+    bignum_async_t q;
+    int ok = a != NULL && bignum_async_init(&q, 8, 3) == BIGNUM_ASYNC_OK;
+    int inited = ok;
+    pthread_t tids[4];
+    producer_t pr[4];
+    atomic_size_t expected;
+    atomic_init(&expected, 0);
+    unsigned started = 0;
+    for (unsigned t = 0; ok && t < 4; ++t) {
+        pr[t].q = &q;
+        pr[t].a = a;
+        pr[t].cmp = malloc(sizeof(int) * n * SLOTS);
+        pr[t].n = n;
+        pr[t].id = t;
+        pr[t].expected = &expected;
+        for (unsigned k = 0; k < SLOTS; ++k) {
+            atomic_init(&pr[t].busy[k], 0);
+        }
+        ok = pr[t].cmp != NULL;
+        if (ok) {
+            atomic_fetch_add(&expected, PER_PRODUCER);
+            ok = pthread_create(&tids[t], NULL, producer, &pr[t]) == 0;
+            if (!ok) {
+                atomic_fetch_sub(&expected, PER_PRODUCER);
+                free(pr[t].cmp);
+            }
+        }
+        started += ok;
+    }
+    /* Разбор продолжается и после ошибки, иначе производители ждут свободных мест. */
+    size_t got = 0;
+    bignum_async_cqe_t cqe[8];
+    while (started > 0 && got < atomic_load(&expected)) {
+        size_t k = bignum_async_wait(&q, cqe, 8);
+        if (k == 0) {
+            sched_yield();                  /* производители ещё не отправили */
+        }
+        for (size_t i = 0; i < k; ++i) {
+            uint64_t ud = cqe[i].user_data;
+            if (ud >= 4 * PER_PRODUCER) {
+                ok = 0;
+                continue;
+            }
+            producer_t *p   = &pr[ud / PER_PRODUCER];
+            unsigned   slot = (unsigned)(ud % PER_PRODUCER) % SLOTS;
+            const int *out  = p->cmp + slot * n;
+            ok = ok && cqe[i].status == BIGNUM_ASYNC_OK;
+            for (size_t j = 0; ok && j < n; ++j) {
+                ok = out[j] == bignum_cmp(&a[j], &a[j]);
+            }
+            seen[ud]++;
+            atomic_store_explicit(&p->busy[slot], 0, memory_order_release);
+        }
+        got += k;
+    }
+    for (unsigned t = 0; t < started; ++t) {
+        void *res;
+        pthread_join(tids[t], &res);
+        ok = ok && res == NULL;
+        free(pr[t].cmp);
+    }
+    for (size_t i = 0; ok && i < 4 * PER_PRODUCER; ++i) {
+        ok = seen[i] == 1;
+    }
+    if (inited) {
+        bignum_async_free(&q);
+    }
+    free(a);
+    return ok;
+}
+
+/** @brief Тест: ошибки. */
+int test_errors() {
+    bignum_async_t q;
+    bignum_async_cqe_t cqe;
+    int ok = bignum_async_init(NULL, 4, 1) == BIGNUM_ASYNC_ERROR_NULL
+          && bignum_async_init(&q, 0, 1) == BIGNUM_ASYNC_ERROR_RANGE && q.ring == NULL
+          && bignum_async_init(&q, 4, 0) == BIGNUM_ASYNC_OK && q.threads >= 1;
+    bignum_async_sqe_t s = { .op = (bignum_async_op_t)42 };
+    ok = ok && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_ERROR_RANGE;
+    s = (bignum_async_sqe_t){ .op = BIGNUM_ASYNC_OP_CMP, .n = 1 };
+    ok = ok && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_ERROR_NULL;
+    s = (bignum_async_sqe_t){ .op = BIGNUM_ASYNC_OP_SORT, .n = 1 };
+    ok = ok && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_ERROR_NULL;
+    s = (bignum_async_sqe_t){ .op = BIGNUM_ASYNC_OP_LOWER_BOUND, .m = 1 };
+    ok = ok && bignum_async_submit(&q, &s) == BIGNUM_ASYNC_ERROR_NULL;
+    ok = ok && bignum_async_submit(&q, NULL) == BIGNUM_ASYNC_ERROR_NULL
+            && bignum_async_submit(NULL, &s) == BIGNUM_ASYNC_ERROR_NULL
+            && bignum_async_cancel(NULL, 0) == BIGNUM_ASYNC_ERROR_NULL
+            && bignum_async_reap(&q, NULL, 1) == 0 && bignum_async_reap(NULL, &cqe, 1) == 0
+            && bignum_async_pending(&q) == 0;
+    bignum_async_free(&q);
+    bignum_async_free(NULL);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_async ---\n");
+    srand(46);
+
+    RUN_TEST(test_ops);
+    RUN_TEST(test_backpressure);
+    RUN_TEST(test_eventfd);
+    RUN_TEST(test_cancel);
+    RUN_TEST(test_concurrent_submit);
+    RUN_TEST(test_errors);
+
+    printf("--- All bignum_async tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file    test_bignum_cmp_atomic.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты атомарных fetch-max/fetch-min (bignum_atomic_*).
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Семантика:** `test_fetch_semantics` — последовательность fetch_max и
+ *     fetch_min против эталона на `bignum_cmp`, значения `prev`, равный
+ *     кандидат даёт `BIGNUM_ATOMIC_UNCHANGED`, значения с равными префиксами.
+ * 2.  **Конкурентный максимум:** `test_concurrent_max` — 8 потоков публикуют
+ *     случайных кандидатов; итог — максимум всех, у каждой успешной установки
+ *     `prev < cand`, наблюдаемые `load` не убывают.
+ * 3.  **Освобождение версий:** `test_reclamation_under_load` — 4 потока
+ *     непрерывно повышают значение (каждая операция снимает версию), пока
+ *     другие читают; под ASan/TSan это ловит чтение освобождённой версии,
+ *     а LeakSanitizer — потерянные версии.
+ * 4.  **Ошибки:** `test_errors` — `NULL`, `len > BIGNUM_CAPACITY`.
+ *
+ * @note Для сборки этого теста требуется флаг `-pthread`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_atomic.h"
+#include <bignum_common.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+#define NUM_THREADS 8
+#define PER_THREAD  20000
+
+static atomic_int g_test_failed = ATOMIC_VAR_INIT(0);
+static atomic_int g_writers_done = ATOMIC_VAR_INIT(0);
+
+static uint64_t mix(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+/** Кандидат: 1–3 слова, старшее слово из малого диапазона (частые равные префиксы). */
+static void make_cand(bignum_t *x, uint64_t r)
+{
+    uint64_t w[3] = { mix(r), mix(r + 1), mix(r) % 4 + 1 };
+    bignum_init_from_array(x, w, 1 + (size_t)(r % 3));
+}
+
+/** @brief Тест: последовательная семантика fetch_max/fetch_min. */
+int test_fetch_semantics() {
+    bignum_atomic_t a;
+    bignum_t ref, x, prev, out;
+    bignum_init_u64(&ref, 0);
+    int ok = bignum_atomic_init(&a, NULL) == BIGNUM_ATOMIC_OK && a.nslots >= 64;
+
+    for (uint64_t i = 0; ok && i < 5000; ++i) {
+        make_cand(&x, i * 7);
+        int is_max = i % 4 != 3;
+        int c = bignum_cmp(&x, &ref);
+        int win = is_max ? c > 0 : c < 0;
+        bignum_atomic_status_t st = is_max ? bignum_atomic_fetch_max(&a, &x, &prev)
+                                           : bignum_atomic_fetch_min(&a, &x, &prev);
+        ok = st == (win ? BIGNUM_ATOMIC_OK : BIGNUM_ATOMIC_UNCHANGED) && bignum_cmp(&prev, &ref) == 0;
+        if (win) {
+            ref = x;
+        }
+        ok = ok && bignum_atomic_load(&a, &out) == BIGNUM_ATOMIC_OK && bignum_cmp(&out, &ref) == 0;
+        /* Равный кандидат ничего не меняет. */
+        ok = ok && bignum_atomic_fetch_max(&a, &ref, NULL) == BIGNUM_ATOMIC_UNCHANGED
+                && bignum_atomic_fetch_min(&a, &ref, NULL) == BIGNUM_ATOMIC_UNCHANGED;
+    }
+    bignum_atomic_free(&a);
+    bignum_atomic_free(&a);
+    bignum_atomic_free(NULL);
+    return ok;
+}
+
+typedef struct {
+    bignum_atomic_t *a;
+    int              id;
+    bignum_t         best;      /**< Максимум своих кандидатов. */
+} thread_task_t;
+
+static void *max_worker(void *arg)
+{
+    thread_task_t *t = arg;
+    bignum_t x, prev, seen, last;
+    bignum_init_u64(&t->best, 0);
+    bignum_init_u64(&last, 0);
+    for (uint64_t i = 0; i < PER_THREAD && !atomic_load(&g_test_failed); ++i) {
+        make_cand(&x, mix((uint64_t)t->id << 32 | i));
+        if (bignum_cmp(&x, &t->best) > 0) {
+            t->best = x;
+        }
+        bignum_atomic_status_t st = bignum_atomic_fetch_max(t->a, &x, &prev);
+        if ((st == BIGNUM_ATOMIC_OK && bignum_cmp(&prev, &x) >= 0) ||
+            (st == BIGNUM_ATOMIC_UNCHANGED && bignum_cmp(&prev, &x) < 0) ||
+            (st != BIGNUM_ATOMIC_OK && st != BIGNUM_ATOMIC_UNCHANGED)) {
+            printf("Thread %d iter %llu: bad status %d\n", t->id, (unsigned long long)i, st);
+            atomic_store(&g_test_failed, 1);
+            return NULL;
+        }
+        bignum_atomic_load(t->a, &seen);
+        if (bignum_cmp(&seen, &last) < 0 || bignum_cmp(&seen, &x) < 0) {
+            printf("Thread %d iter %llu: load went backwards\n", t->id, (unsigned long long)i);
+            atomic_store(&g_test_failed, 1);
+            return NULL;
+        }
+        last = seen;
+    }
+    return NULL;
+}
+
+/** @brief Тест: конкурентный максимум. */
+int test_concurrent_max() {
+    bignum_atomic_t a;
+    if (bignum_atomic_init(&a, NULL) != BIGNUM_ATOMIC_OK) {
+        return 0;
+    }
+    pthread_t     tids[NUM_THREADS];
+    thread_task_t tasks[NUM_THREADS];
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        tasks[i].a  = &a;
+        tasks[i].id = i;
+        if (pthread_create(&tids[i], NULL, max_worker, &tasks[i]) != 0) {
+            perror("pthread_create");
+            return 0;
+        }
+    }
+    bignum_t best, out;
+    bignum_init_u64(&best, 0);
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        pthread_join(tids[i], NULL);
+        if (bignum_cmp(&tasks[i].best, &best) > 0) {
+            best = tasks[i].best;
+        }
+    }
+    int ok = !atomic_load(&g_test_failed)
+          && bignum_atomic_load(&a, &out) == BIGNUM_ATOMIC_OK && bignum_cmp(&out, &best) == 0;
+    bignum_atomic_free(&a);
+    return ok;
+}
+
+/** Писатель: строго возрастающие кандидаты `{i * 4 + id, 1}` — почти каждый выигрывает. */
+static void *rising_writer(void *arg)
+{
+    thread_task_t *t = arg;
+    bignum_t x;
+    for (uint64_t i = 0; i < PER_THREAD; ++i) {
+        uint64_t w[2] = { i * 4 + (uint64_t)t->id, 1 };
+        bignum_init_from_array(&x, w, 2);
+        if (bignum_atomic_fetch_max(t->a, &x, NULL) < 0) {
+            atomic_store(&g_test_failed, 1);
+            break;
+        }
+    }
+    atomic_fetch_add(&g_writers_done, 1);
+    return NULL;
+}
+
+static void *rising_reader(void *arg)
+{
+    thread_task_t *t = arg;
+    bignum_t seen;
+    while (!atomic_load(&g_test_failed) && atomic_load(&g_writers_done) < 4) {
+        bignum_atomic_load(t->a, &seen);
+        if (seen.len != 2 || seen.words[1] != 1 || seen.words[0] >= 4 * PER_THREAD) {
+            printf("Reader %d: corrupted version\n", t->id);
+            atomic_store(&g_test_failed, 1);
+        }
+    }
+    return NULL;
+}
+
+/** @brief Тест: частые замены версий при параллельном чтении. */
+int test_reclamation_under_load() {
+    bignum_atomic_t a;
+    uint64_t w0[2] = { 0, 1 };
+    bignum_t init, out;
+    bignum_init_from_array(&init, w0, 2);
+    if (bignum_atomic_init(&a, &init) != BIGNUM_ATOMIC_OK) {
+        return 0;
+    }
+    atomic_store(&g_writers_done, 0);
+    pthread_t     tids[NUM_THREADS];
+    thread_task_t tasks[NUM_THREADS];
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        tasks[i].a  = &a;
+        tasks[i].id = i;
+        if (pthread_create(&tids[i], NULL, i < 4 ? rising_writer : rising_reader, &tasks[i]) != 0) {
+            perror("pthread_create");
+            return 0;
+        }
+    }
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    int ok = !atomic_load(&g_test_failed)
+          && bignum_atomic_load(&a, &out) == BIGNUM_ATOMIC_OK
+          && out.len == 2 && out.words[0] == 4 * PER_THREAD - 1;
+    bignum_atomic_free(&a);
+    return ok;
+}
+
+/** @brief Тест: ошибки. */
+int test_errors() {
+    bignum_atomic_t a, empty;
+    bignum_t x, out;
+    bignum_init_u64(&x, 5);
+    memset(&empty, 0, sizeof(empty));
+    int ok = bignum_atomic_init(NULL, &x) == BIGNUM_ATOMIC_ERROR_NULL
+          && bignum_atomic_init(&a, &x) == BIGNUM_ATOMIC_OK
+          && bignum_atomic_fetch_max(NULL, &x, NULL) == BIGNUM_ATOMIC_ERROR_NULL
+          && bignum_atomic_fetch_min(&a, NULL, NULL) == BIGNUM_ATOMIC_ERROR_NULL
+          && bignum_atomic_fetch_max(&empty, &x, NULL) == BIGNUM_ATOMIC_ERROR_NULL
+          && bignum_atomic_load(&a, NULL) == BIGNUM_ATOMIC_ERROR_NULL
+          && bignum_atomic_load(NULL, &out) == BIGNUM_ATOMIC_ERROR_NULL;
+    x.len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_atomic_fetch_max(&a, &x, NULL) == BIGNUM_ATOMIC_ERROR_RANGE
+            && bignum_atomic_fetch_min(&a, &x, NULL) == BIGNUM_ATOMIC_ERROR_RANGE
+            && bignum_atomic_load(&a, &out) == BIGNUM_ATOMIC_OK && out.len == 1 && out.words[0] == 5;
+    bignum_atomic_free(&a);
+    ok = ok && bignum_atomic_init(&a, &x) == BIGNUM_ATOMIC_ERROR_RANGE && a.state == NULL;
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_atomic ---\n");
+
+    RUN_TEST(test_fetch_semantics);
+    RUN_TEST(test_concurrent_max);
+    RUN_TEST(test_reclamation_under_load);
+    RUN_TEST(test_errors);
+
+    printf("--- All bignum_atomic tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,258 @@
+/**
+ * @file    test_bignum_cmp_be.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты bignum_cmp_be_bytes и bignum_cmp_be_bytes_batch.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * Эталон — `bignum_cmp(a, x)`, где `x` декодирован из байт побайтно.
+ * 1.  **Случайные пары:** `test_random` — случайные длины, `x = a`, различие
+ *     в одном случайном байте (попадает в любую позицию векторного блока и
+ *     хвоста), ведущие нулевые байты (в том числе DER-байт `0x00`),
+ *     невыровненный адрес буфера.
+ * 2.  **Границы:** `test_edges` — `n == 0`, `p == NULL` при `n == 0`, нуль с
+ *     ненормализованной длиной, байтовые длины `8k` и `8k ± 1`, буфер шире
+ *     ёмкости, `NULL`, `len > BIGNUM_CAPACITY`.
+ * 3.  **Пакет:** `test_batch` — одна граница (`na == 1`) и своя граница на
+ *     каждое поле (`na == n`), пустые поля, совпадение с одиночной функцией,
+ *     ошибки `na`, `offsets` и `NULL`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_be.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+#define BYTES_MAX (BIGNUM_CAPACITY * 8 + 64)
+
+static uint64_t rand64(void)
+{
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+static void random_bignum(bignum_t *x, size_t len)
+{
+    uint64_t w[BIGNUM_CAPACITY];
+    for (size_t i = 0; i < len; ++i) {
+        w[i] = rand64();
+    }
+    if (len > 0 && w[len - 1] == 0) {
+        w[len - 1] = 1;
+    }
+    bignum_init_from_array(x, w, len);
+}
+
+/** Значащие байты `x` старшим первым, с `zeros` ведущими нулями. */
+static size_t to_be(const bignum_t *x, uint8_t *out, size_t zeros)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < zeros; ++i) {
+        out[n++] = 0;
+    }
+    int started = 0;
+    for (size_t i = x->len; i > 0; --i) {
+        for (int b = 7; b >= 0; --b) {
+            uint8_t v = (uint8_t)(x->words[i - 1] >> (8 * b));
+            if (v != 0 || started) {
+                out[n++] = v;
+                started  = 1;
+            }
+        }
+    }
+    return n;
+}
+
+/** Эталон: побайтное декодирование; `0` — не помещается в `bignum_t`. */
+static int from_be(const uint8_t *p, size_t n, bignum_t *x)
+{
+    memset(x, 0, sizeof(*x));
+    for (size_t i = 0; i < n; ++i) {
+        size_t bit = 8 * (n - 1 - i);
+        if (p[i] == 0) {
+            continue;
+        }
+        if (bit / 64 >= BIGNUM_CAPACITY) {
+            return 0;
+        }
+        x->words[bit / 64] |= (uint64_t)p[i] << (bit % 64);
+        if (bit / 64 + 1 > x->len) {
+            x->len = bit / 64 + 1;
+        }
+    }
+    return 1;
+}
+
+static int expected(const bignum_t *a, const uint8_t *p, size_t n)
+{
+    bignum_t x;
+    if (!from_be(p, n, &x)) {
+        return BIGNUM_CMP_LESS;
+    }
+    bignum_t an = *a;
+    while (an.len > 0 && an.words[an.len - 1] == 0) {
+        an.len--;
+    }
+    return bignum_cmp(&an, &x);
+}
+
+/** @brief Тест: случайные пары. */
+int test_random() {
+    bignum_t a, x;
+    uint8_t  raw[BYTES_MAX + 1];
+    int ok = 1;
+    for (int iter = 0; ok && iter < 50000; ++iter) {
+        random_bignum(&a, (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        x = a;
+        if (iter % 3 == 0) {
+            random_bignum(&x, (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        }
+        uint8_t *p = raw + (iter & 1);          /* невыровненный адрес */
+        size_t   zeros = (size_t)(iter % 5 == 0 ? rand() % 40 : iter % 5 == 1);
+        size_t   n = to_be(&x, p, zeros);
+        if (iter % 3 == 1 && n > zeros) {
+            p[zeros + (size_t)rand() % (n - zeros)] ^= (uint8_t)(1u << (rand() % 8));
+        }
+        int want = expected(&a, p, n);
+        ok = bignum_cmp_be_bytes(&a, p, n) == want;
+    }
+    return ok;
+}
+
+/** @brief Тест: граничные случаи. */
+int test_edges() {
+    bignum_t zero, one, x;
+    uint8_t  b[BYTES_MAX];
+    bignum_init_u64(&zero, 0);
+    bignum_init_u64(&one, 1);
+
+    int ok = bignum_cmp_be_bytes(&zero, NULL, 0) == BIGNUM_CMP_EQ
+          && bignum_cmp_be_bytes(&one, NULL, 0) == BIGNUM_CMP_GREATER;
+    memset(b, 0, sizeof(b));
+    ok = ok && bignum_cmp_be_bytes(&zero, b, sizeof(b)) == BIGNUM_CMP_EQ
+            && bignum_cmp_be_bytes(&one, b, sizeof(b)) == BIGNUM_CMP_GREATER;
+    b[sizeof(b) - 1] = 1;
+    ok = ok && bignum_cmp_be_bytes(&one, b, sizeof(b)) == BIGNUM_CMP_EQ
+            && bignum_cmp_be_bytes(&zero, b, sizeof(b)) == BIGNUM_CMP_LESS;
+
+    /* Ненормализованный нуль. */
+    x = zero;
+    x.len = BIGNUM_CAPACITY;
+    ok = ok && bignum_cmp_be_bytes(&x, b, 0) == BIGNUM_CMP_EQ
+            && bignum_cmp_be_bytes(&x, b, sizeof(b)) == BIGNUM_CMP_LESS;
+
+    /* Все байтовые длины 1..8·CAPACITY: 0xFF…FF против соседей. */
+    for (size_t nb = 1; ok && nb <= BIGNUM_CAPACITY * 8; ++nb) {
+        memset(&x, 0, sizeof(x));
+        for (size_t i = 0; i < nb; ++i) {
+            x.words[i / 8] |= (uint64_t)0xFF << (8 * (i % 8));
+        }
+        x.len = (nb + 7) / 8;
+        memset(b, 0xFF, nb);
+        ok = bignum_cmp_be_bytes(&x, b, nb) == BIGNUM_CMP_EQ
+          && bignum_cmp_be_bytes(&x, b, nb - 1) == BIGNUM_CMP_GREATER;
+        b[nb - 1] = 0xFE;
+        ok = ok && bignum_cmp_be_bytes(&x, b, nb) == BIGNUM_CMP_GREATER;
+        b[nb - 1] = 0xFF;
+        b[nb]     = 0x00;
+        ok = ok && bignum_cmp_be_bytes(&x, b, nb + 1) == BIGNUM_CMP_LESS;
+        b[0] = 0x7F;
+        ok = ok && bignum_cmp_be_bytes(&x, b, nb) == BIGNUM_CMP_GREATER;
+    }
+
+    /* Буфер шире ёмкости. */
+    memset(&x, 0xFF, sizeof(x.words));
+    x.len = BIGNUM_CAPACITY;
+    memset(b, 0, sizeof(b));
+    b[0] = 1;
+    ok = ok && bignum_cmp_be_bytes(&x, b, BIGNUM_CAPACITY * 8 + 1) == BIGNUM_CMP_LESS;
+
+    ok = ok && bignum_cmp_be_bytes(NULL, b, 1) == BIGNUM_BE_ERROR_NULL
+            && bignum_cmp_be_bytes(&one, NULL, 1) == BIGNUM_BE_ERROR_NULL;
+    x.len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_cmp_be_bytes(&x, b, 1) == BIGNUM_BE_ERROR_RANGE;
+    return ok;
+}
+
+/** @brief Тест: пакетная функция. */
+int test_batch() {
+    const size_t n = 2000;
+    bignum_t *bounds = malloc(sizeof(bignum_t) * n);
+    size_t   *offs   = malloc(sizeof(size_t) * (n + 1));
+    uint8_t  *buf    = malloc(BYTES_MAX * n);
+    int8_t   *out    = malloc(n);
+    int ok = bounds != NULL && offs != NULL && buf != NULL && out != NULL;
+
+    offs[0] = 0;
+    for (size_t i = 0; ok && i < n; ++i) {
+        bignum_t x;
+        random_bignum(&bounds[i], (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        x = bounds[i];
+        if (i % 3 == 0) {
+            random_bignum(&x, (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        } else if (i % 3 == 1 && x.len > 0) {
+            x.words[0] ^= 1;
+        }
+        offs[i + 1] = offs[i] + (i % 7 == 0 ? 0 : to_be(&x, buf + offs[i], (size_t)(i % 4)));
+    }
+
+    /* Своя граница на каждое поле. */
+    ok = ok && bignum_cmp_be_bytes_batch(bounds, n, buf, offs, n, out) == BIGNUM_BE_OK;
+    for (size_t i = 0; ok && i < n; ++i) {
+        ok = out[i] == bignum_cmp_be_bytes(&bounds[i], buf + offs[i], offs[i + 1] - offs[i]);
+    }
+    /* Одна граница: каждая из первых границ против всех полей. */
+    for (size_t j = 0; ok && j < 40; ++j) {
+        ok = bignum_cmp_be_bytes_batch(&bounds[j], 1, buf, offs, n, out) == BIGNUM_BE_OK;
+        for (size_t i = 0; ok && i < n; ++i) {
+            ok = out[i] == expected(&bounds[j], buf + offs[i], offs[i + 1] - offs[i]);
+        }
+    }
+
+    ok = ok && bignum_cmp_be_bytes_batch(bounds, 2, buf, offs, n, out) == BIGNUM_BE_ERROR_RANGE
+            && bignum_cmp_be_bytes_batch(NULL, 1, buf, offs, n, out) == BIGNUM_BE_ERROR_NULL
+            && bignum_cmp_be_bytes_batch(bounds, 1, buf, NULL, n, out) == BIGNUM_BE_ERROR_NULL
+            && bignum_cmp_be_bytes_batch(bounds, 1, buf, offs, n, NULL) == BIGNUM_BE_ERROR_NULL
+            && bignum_cmp_be_bytes_batch(NULL, 0, NULL, NULL, 0, NULL) == BIGNUM_BE_OK;
+    if (ok) {
+        size_t saved = offs[5];
+        offs[5] = offs[6] + 1;
+        ok = bignum_cmp_be_bytes_batch(bounds, 1, buf, offs, n, out) == BIGNUM_BE_ERROR_RANGE;
+        offs[5] = saved;
+        bounds[3].len = BIGNUM_CAPACITY + 1;
+        ok = ok && bignum_cmp_be_bytes_batch(bounds, n, buf, offs, n, out) == BIGNUM_BE_ERROR_RANGE;
+    }
+    free(bounds);
+    free(offs);
+    free(buf);
+    free(out);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_be ---\n");
+    srand(49);
+
+    RUN_TEST(test_random);
+    RUN_TEST(test_edges);
+    RUN_TEST(test_batch);
+
+    printf("--- All bignum_be tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,234 @@
+/**
+ * @file    test_bignum_cmp_btree.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты статического B+-индекса (bignum_btree_*).
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Эквивалентность бинарному поиску:** `test_btree_bounds_match_reference` —
+ *     lower/upper_bound для размеров вокруг границ листа и уровня (0, 1, 16, 17,
+ *     272, 289, 290, 5000) на случайных и отсутствующих ключах; те же запросы
+ *     пакетом через `*_bound_batch` дают те же позиции.
+ * 2.  **Совпадающие префиксы:** `test_btree_shared_prefix` — ключи с одинаковыми
+ *     `len` и старшим словом, порядок решают младшие слова (полный `bignum_cmp`).
+ * 3.  **Дубликаты и диапазоны:** `test_btree_duplicates_and_range`.
+ * 4.  **Робастность:** `test_btree_errors` — неотсортированный вход, `len > BIGNUM_CAPACITY`, `NULL`
+ *     (в том числе у пакетных функций; пустой пакет допустим).
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_btree.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static uint64_t rnd64(void)
+{
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+/** Число длины `len` со старшим словом из маленького алфавита (чтобы префиксы совпадали). */
+static void make_key(bignum_t *x, size_t len, uint64_t top_mod)
+{
+    uint64_t w[BIGNUM_CAPACITY];
+    for (size_t i = 0; i < len; ++i) {
+        w[i] = rnd64();
+    }
+    if (len > 0) {
+        w[len - 1] = (top_mod ? (w[len - 1] % top_mod) : w[len - 1]) + 1;
+    }
+    bignum_init_from_array(x, w, len);
+}
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static size_t ref_bound(const bignum_t *keys, size_t n, const bignum_t *x, int upper)
+{
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int c = bignum_cmp(&keys[mid], x);
+        if (c < 0 || (upper && c == 0)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/** Сравнивает индекс с бинарным поиском на ключах массива и `probes` случайных значениях. */
+static int check_against_reference(const bignum_t *keys, size_t n, size_t max_len, uint64_t top_mod, int probes)
+{
+    bignum_btree_t t;
+    if (bignum_btree_build(&t, keys, n) != BIGNUM_BTREE_OK) {
+        return 0;
+    }
+    size_t    m  = n + (size_t)probes;
+    bignum_t *xs = malloc(m * sizeof(bignum_t));
+    size_t   *lb = malloc(m * sizeof(size_t)), *ub = malloc(m * sizeof(size_t));
+    int ok = xs != NULL && lb != NULL && ub != NULL;
+    for (size_t p = 0; ok && p < m; ++p) {
+        if (p < n) {
+            xs[p] = keys[p];
+        } else {
+            make_key(&xs[p], (size_t)(rand() % (int)(max_len + 1)), top_mod);
+        }
+        size_t l, u;
+        bignum_btree_lower_bound(&t, &xs[p], &l);
+        bignum_btree_upper_bound(&t, &xs[p], &u);
+        ok = l == ref_bound(keys, n, &xs[p], 0) && u == ref_bound(keys, n, &xs[p], 1);
+    }
+    ok = ok && bignum_btree_lower_bound_batch(&t, xs, m, lb) == BIGNUM_BTREE_OK
+            && bignum_btree_upper_bound_batch(&t, xs, m, ub) == BIGNUM_BTREE_OK;
+    for (size_t p = 0; ok && p < m; ++p) {
+        ok = lb[p] == ref_bound(keys, n, &xs[p], 0) && ub[p] == ref_bound(keys, n, &xs[p], 1);
+    }
+    free(xs);
+    free(lb);
+    free(ub);
+    bignum_btree_free(&t);
+    return ok;
+}
+
+/** @brief Тест: границы совпадают с бинарным поиском для размеров вокруг границ листа и уровня. */
+int test_btree_bounds_match_reference() {
+    static const size_t sizes[] = { 0, 1, 15, 16, 17, 272, 289, 290, 5000 };
+    bignum_t *keys = malloc(5000 * sizeof(bignum_t));
+    if (keys == NULL) {
+        return 0;
+    }
+    int ok = 1;
+    for (size_t s = 0; ok && s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        size_t n = sizes[s];
+        for (size_t i = 0; i < n; ++i) {
+            make_key(&keys[i], (size_t)(rand() % 5), 0);
+        }
+        qsort(keys, n, sizeof(bignum_t), cmp_qsort);
+        ok = check_against_reference(keys, n, 5, 0, 500);
+    }
+    free(keys);
+    return ok;
+}
+
+/** @brief Тест: совпадающие `len` и старшее слово — порядок решает полный `bignum_cmp`. */
+int test_btree_shared_prefix() {
+    const size_t n = 3000;
+    bignum_t *keys = malloc(n * sizeof(bignum_t));
+    if (keys == NULL) {
+        return 0;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        make_key(&keys[i], 3, 4);   /* всего 4 разных префикса */
+    }
+    qsort(keys, n, sizeof(bignum_t), cmp_qsort);
+    int ok = check_against_reference(keys, n, 3, 4, 2000);
+    free(keys);
+    return ok;
+}
+
+/** @brief Тест: дубликаты, find и диапазонные запросы. */
+int test_btree_duplicates_and_range() {
+    const size_t n = 1000;
+    bignum_t keys[1000];
+    for (size_t i = 0; i < n; ++i) {
+        bignum_init_u64(&keys[i], (uint64_t)(i / 10));   /* каждое значение 10 раз */
+    }
+    bignum_btree_t t;
+    if (bignum_btree_build(&t, keys, n) != BIGNUM_BTREE_OK) {
+        return 0;
+    }
+    bignum_t x, lo, hi, big;
+    size_t pos = 0, first = 0, last = 0;
+    int ok = 1;
+
+    bignum_init_u64(&x, 42);
+    ok = ok && bignum_btree_find(&t, &x, &pos) == 1 && pos == 420;
+    bignum_init_u64(&x, 100);
+    ok = ok && bignum_btree_find(&t, &x, &pos) == 0 && pos == n;
+
+    bignum_init_u64(&lo, 10);
+    bignum_init_u64(&hi, 20);
+    ok = ok && bignum_btree_range(&t, &lo, &hi, &first, &last) == BIGNUM_BTREE_OK
+            && first == 100 && last == 200;
+    ok = ok && bignum_btree_range(&t, &hi, &lo, &first, &last) == BIGNUM_BTREE_OK && first == last;
+    ok = ok && bignum_btree_range(&t, NULL, NULL, &first, &last) == BIGNUM_BTREE_OK
+            && first == 0 && last == n;
+
+    /* len > BIGNUM_CAPACITY больше любого ключа, как и в bignum_cmp. */
+    memset(&big, 0, sizeof(big));
+    big.len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_btree_lower_bound(&t, &big, &pos) == BIGNUM_BTREE_OK && pos == n;
+
+    bignum_btree_free(&t);
+    return ok;
+}
+
+/** @brief Тест: ошибки построения и NULL-аргументы. */
+int test_btree_errors() {
+    bignum_t keys[3];
+    bignum_btree_t t;
+    size_t pos, first, last;
+
+    bignum_init_u64(&keys[0], 1);
+    bignum_init_u64(&keys[1], 3);
+    bignum_init_u64(&keys[2], 2);
+    if (bignum_btree_build(&t, keys, 3) != BIGNUM_BTREE_ERROR_UNSORTED || t.n != 0) {
+        return 0;
+    }
+    keys[2].len = BIGNUM_CAPACITY + 1;
+    if (bignum_btree_build(&t, keys, 3) != BIGNUM_BTREE_ERROR_RANGE) {
+        return 0;
+    }
+    if (bignum_btree_build(NULL, keys, 3) != BIGNUM_BTREE_ERROR_NULL ||
+        bignum_btree_build(&t, NULL, 3) != BIGNUM_BTREE_ERROR_NULL) {
+        return 0;
+    }
+    if (bignum_btree_build(&t, keys, 2) != BIGNUM_BTREE_OK) {
+        return 0;
+    }
+    int ok = bignum_btree_lower_bound(&t, NULL, &pos) == BIGNUM_BTREE_ERROR_NULL
+          && bignum_btree_upper_bound(NULL, &keys[0], &pos) == BIGNUM_BTREE_ERROR_NULL
+          && bignum_btree_find(&t, NULL, NULL) == BIGNUM_BTREE_ERROR_NULL
+          && bignum_btree_range(&t, NULL, NULL, NULL, &last) == BIGNUM_BTREE_ERROR_NULL
+          && bignum_btree_range(&t, NULL, NULL, &first, NULL) == BIGNUM_BTREE_ERROR_NULL
+          && bignum_btree_lower_bound_batch(&t, NULL, 1, &pos) == BIGNUM_BTREE_ERROR_NULL
+          && bignum_btree_upper_bound_batch(&t, keys, 1, NULL) == BIGNUM_BTREE_ERROR_NULL
+          && bignum_btree_lower_bound_batch(NULL, keys, 1, &pos) == BIGNUM_BTREE_ERROR_NULL
+          && bignum_btree_lower_bound_batch(&t, NULL, 0, NULL) == BIGNUM_BTREE_OK;
+    bignum_btree_free(&t);
+    bignum_btree_free(NULL);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_btree ---\n");
+    srand(33);
+
+    RUN_TEST(test_btree_bounds_match_reference);
+    RUN_TEST(test_btree_shared_prefix);
+    RUN_TEST(test_btree_duplicates_and_range);
+    RUN_TEST(test_btree_errors);
+
+    printf("--- All bignum_btree tests passed ---\n");
+    return 0;
+}
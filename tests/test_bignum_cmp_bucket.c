@@ -0,0 +1,191 @@
+/**
+ * @file    test_bignum_cmp_bucket.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты bignum_bucketize и bignum_bucketize_mt.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Эталон:** `test_bucketize_matches_bsearch` — для числа разделителей
+ *     0, 1, 15, 16, 17, 255, 272, 4000 (границы листа и уровня индекса) номер
+ *     корзины совпадает с наивным upper_bound через `bignum_cmp`; значения
+ *     включают сами разделители и ключи с равным префиксом.
+ * 2.  **Дубликаты разделителей:** `test_duplicate_splitters` — пустые корзины
+ *     между равными разделителями не получают ни одного значения.
+ * 3.  **Потоки:** `test_bucketize_mt` — 1, 2, 3, 7 и 0 потоков дают тот же
+ *     результат, что и однопоточная версия.
+ * 4.  **Ошибки:** `test_bucket_errors` — неотсортированные разделители,
+ *     `len > BIGNUM_CAPACITY` у разделителя и у значения, `NULL`, `n == 0`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_bucket.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+/** Ключ длины 1..3; у многих ключей общее старшее слово (путь `bignum_cmp`). */
+static void rand_key(bignum_t *x)
+{
+    uint64_t w[3] = { (uint64_t)rand(), (uint64_t)(rand() % 5), (uint64_t)(rand() % 3) + 1 };
+    bignum_init_from_array(x, w, (size_t)(rand() % 3) + 1);
+    for (size_t k = x->len; k < BIGNUM_CAPACITY; ++k) {
+        x->words[k] = (uint64_t)rand();   /* мусор за len */
+    }
+}
+
+/** Эталон: количество разделителей `<= x`. */
+static uint32_t ref_bucket(const bignum_t *s, size_t k, const bignum_t *x)
+{
+    size_t lo = 0, hi = k;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (bignum_cmp(&s[mid], x) <= 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return (uint32_t)lo;
+}
+
+/** Значения: случайные ключи, часть — копии разделителей. */
+static void fill_values(bignum_t *x, size_t n, const bignum_t *s, size_t k)
+{
+    for (size_t i = 0; i < n; ++i) {
+        if (k > 0 && rand() % 4 == 0) {
+            x[i] = s[(size_t)rand() % k];
+        } else {
+            rand_key(&x[i]);
+        }
+    }
+}
+
+/** @brief Тест: совпадение с наивным двоичным поиском. */
+int test_bucketize_matches_bsearch() {
+    static const size_t ks[] = { 0, 1, 15, 16, 17, 255, 272, 4000 };
+    const size_t n = 20000;
+    bignum_t *s   = malloc(sizeof(bignum_t) * 4000);
+    bignum_t *x   = malloc(sizeof(bignum_t) * n);
+    uint32_t *out = malloc(sizeof(uint32_t) * n);
+    int ok = s && x && out;
+    for (size_t r = 0; ok && r < sizeof(ks) / sizeof(ks[0]); ++r) {
+        size_t k = ks[r];
+        for (size_t i = 0; i < k; ++i) {
+            rand_key(&s[i]);
+        }
+        qsort(s, k, sizeof(bignum_t), cmp_qsort);
+        fill_values(x, n, s, k);
+        ok = bignum_bucketize(s, k, x, n, out) == BIGNUM_BUCKET_OK;
+        for (size_t i = 0; ok && i < n; ++i) {
+            ok = out[i] == ref_bucket(s, k, &x[i]);
+        }
+    }
+    free(s);
+    free(x);
+    free(out);
+    return ok;
+}
+
+/** @brief Тест: равные разделители дают пустые корзины. */
+int test_duplicate_splitters() {
+    bignum_t s[6], x[5];
+    uint32_t out[5];
+    static const uint64_t sv[6] = { 10, 20, 20, 20, 30, 30 };
+    static const uint64_t xv[5] = { 5, 20, 25, 30, 99 };
+    for (size_t i = 0; i < 6; ++i) {
+        bignum_init_u64(&s[i], sv[i]);
+    }
+    for (size_t i = 0; i < 5; ++i) {
+        bignum_init_u64(&x[i], xv[i]);
+    }
+    return bignum_bucketize(s, 6, x, 5, out) == BIGNUM_BUCKET_OK
+        && out[0] == 0 && out[1] == 4 && out[2] == 4 && out[3] == 6 && out[4] == 6;
+}
+
+/** @brief Тест: многопоточная версия совпадает с однопоточной. */
+int test_bucketize_mt() {
+    const size_t n = 200000, k = 255;
+    static const unsigned threads[] = { 1, 2, 3, 7, 0 };
+    bignum_t *s   = malloc(sizeof(bignum_t) * k);
+    bignum_t *x   = malloc(sizeof(bignum_t) * n);
+    uint32_t *ref = malloc(sizeof(uint32_t) * n);
+    uint32_t *out = malloc(sizeof(uint32_t) * n);
+    int ok = s && x && ref && out;
+    if (ok) {
+        for (size_t i = 0; i < k; ++i) {
+            rand_key(&s[i]);
+        }
+        qsort(s, k, sizeof(bignum_t), cmp_qsort);
+        fill_values(x, n, s, k);
+        ok = bignum_bucketize(s, k, x, n, ref) == BIGNUM_BUCKET_OK;
+    }
+    for (size_t t = 0; ok && t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        memset(out, 0xFF, sizeof(uint32_t) * n);
+        ok = bignum_bucketize_mt(s, k, x, n, threads[t], out) == BIGNUM_BUCKET_OK
+          && memcmp(out, ref, sizeof(uint32_t) * n) == 0;
+    }
+    free(s);
+    free(x);
+    free(ref);
+    free(out);
+    return ok;
+}
+
+/** @brief Тест: ошибки. */
+int test_bucket_errors() {
+    bignum_t s[3], x[3];
+    uint32_t out[3];
+    for (size_t i = 0; i < 3; ++i) {
+        bignum_init_u64(&s[i], 10 * (i + 1));
+        bignum_init_u64(&x[i], i);
+    }
+    int ok = bignum_bucketize(s, 3, x, 0, NULL) == BIGNUM_BUCKET_OK
+          && bignum_bucketize(NULL, 0, x, 3, out) == BIGNUM_BUCKET_OK
+          && out[0] == 0 && out[2] == 0
+          && bignum_bucketize(NULL, 3, x, 3, out) == BIGNUM_BUCKET_ERROR_NULL
+          && bignum_bucketize(s, 3, NULL, 3, out) == BIGNUM_BUCKET_ERROR_NULL
+          && bignum_bucketize(s, 3, x, 3, NULL) == BIGNUM_BUCKET_ERROR_NULL;
+
+    x[2].len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_bucketize(s, 3, x, 3, out) == BIGNUM_BUCKET_ERROR_RANGE;
+    x[2].len = 1;
+    s[1].len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_bucketize(s, 3, x, 3, out) == BIGNUM_BUCKET_ERROR_RANGE;
+    bignum_init_u64(&s[1], 5);
+    ok = ok && bignum_bucketize_mt(s, 3, x, 3, 2, out) == BIGNUM_BUCKET_ERROR_UNSORTED;
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_bucketize ---\n");
+    srand(39);
+
+    RUN_TEST(test_bucketize_matches_bsearch);
+    RUN_TEST(test_duplicate_splitters);
+    RUN_TEST(test_bucketize_mt);
+    RUN_TEST(test_bucket_errors);
+
+    printf("--- All bignum_bucketize tests passed ---\n");
+    return 0;
+}
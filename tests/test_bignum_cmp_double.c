@@ -0,0 +1,401 @@
+/**
+ * @file    test_bignum_cmp_double.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты bignum_cmp_double и bignum_cmp_double_batch.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * Эталон `ref_cmp` точно переводит `d` в целую часть `bignum_t` (по мантиссе
+ * и порядку) плюс признак ненулевой дробной части и вызывает `bignum_cmp`.
+ * 1.  **Границы 2^k:** `test_pow2_boundaries` — для всех `k` до
+ *     `min(1023, 64·BIGNUM_CAPACITY - 1)`: `a` из `{2^k - 1, 2^k, 2^k + 1,
+ *     2^k + 2^(k-52), 2^k - 2^(k-53)}` против `d` из `{2^k, следующий и
+ *     предыдущий double, 2^k ± ulp/2 (дробные при k < 53)}`; все `a` на
+ *     границе слова (`k = 64j ± 1`) и с битом в младшем слове.
+ * 2.  **Случайные пары:** `test_random` — случайные `a`, `d` со случайными
+ *     битами и `d` — ближайшие к `a` значения (равные битовые длины, совпадение
+ *     53 старших бит, различие только в хвосте).
+ * 3.  **Особые значения:** `test_specials` — `±0`, `±inf`, NaN, субнормальные,
+ *     `0.5`, `1.5`, `DBL_MAX`, отрицательные, ненормализованная длина,
+ *     `len > BIGNUM_CAPACITY`, `NULL`.
+ * 4.  **Пакет:** `test_batch` — совпадение с одиночной функцией на смеси всех
+ *     классов (длины не кратны ширине вектора), ошибки NaN, `len` и `NULL`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_double.h"
+#include <bignum_common.h>
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static uint64_t rand64(void)
+{
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+static void random_bignum(bignum_t *x, size_t len)
+{
+    uint64_t w[BIGNUM_CAPACITY];
+    for (size_t i = 0; i < len; ++i) {
+        w[i] = rand64();
+    }
+    if (len > 0 && w[len - 1] == 0) {
+        w[len - 1] = 1;
+    }
+    bignum_init_from_array(x, w, len);
+}
+
+static double from_bits(uint64_t bits)
+{
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+static uint64_t to_bits(double d)
+{
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    return bits;
+}
+
+/** `2^k` как `bignum_t`; `0` — не помещается. */
+static int pow2(bignum_t *x, size_t k)
+{
+    memset(x, 0, sizeof(*x));
+    if (k / 64 >= BIGNUM_CAPACITY) {
+        return 0;
+    }
+    x->words[k / 64] = 1ull << (k % 64);
+    x->len = k / 64 + 1;
+    return 1;
+}
+
+/** `x += 2^k` (без выхода за ёмкость — иначе `0`). */
+static int add_pow2(bignum_t *x, size_t k)
+{
+    if (k / 64 >= BIGNUM_CAPACITY) {
+        return 0;
+    }
+    for (size_t i = x->len; i <= k / 64; ++i) {
+        x->words[i] = 0;
+    }
+    if (x->len <= k / 64) {
+        x->len = k / 64 + 1;
+    }
+    uint64_t carry = 1ull << (k % 64);
+    for (size_t i = k / 64; carry != 0; ++i) {
+        if (i == x->len) {
+            if (x->len == BIGNUM_CAPACITY) {
+                return 0;
+            }
+            x->words[x->len++] = 0;
+        }
+        x->words[i] += carry;
+        carry = x->words[i] < carry;
+    }
+    return 1;
+}
+
+/** `x -= 2^k`, `x >= 2^k`. */
+static void sub_pow2(bignum_t *x, size_t k)
+{
+    uint64_t borrow = 1ull << (k % 64);
+    for (size_t i = k / 64; borrow != 0; ++i) {
+        uint64_t w = x->words[i];
+        x->words[i] = w - borrow;
+        borrow = w < borrow;
+    }
+    while (x->len > 0 && x->words[x->len - 1] == 0) {
+        x->len--;
+    }
+}
+
+/** Эталон: целая часть `d` точно, дробь — признаком. */
+static int ref_cmp(const bignum_t *a, double d)
+{
+    bignum_t an = *a;
+    while (an.len > 0 && an.words[an.len - 1] == 0) {
+        an.len--;
+    }
+    if (d != d) {
+        return BIGNUM_DBL_ERROR_NAN;
+    }
+    if (d < 0) {
+        return BIGNUM_CMP_GREATER;
+    }
+    if (d == 0) {
+        return an.len == 0 ? BIGNUM_CMP_EQ : BIGNUM_CMP_GREATER;
+    }
+    if (d > DBL_MAX) {
+        return BIGNUM_CMP_LESS;
+    }
+    uint64_t bits = to_bits(d);
+    int      be   = (int)(bits >> 52);
+    if (be == 0) {                              /* субнормальное: 0 < d < 1 */
+        return an.len == 0 ? BIGNUM_CMP_LESS : BIGNUM_CMP_GREATER;
+    }
+    int      e = be - 1023 - 52;                /* d = M · 2^e */
+    uint64_t M = (bits & ((1ull << 52) - 1)) | (1ull << 52);
+    bignum_t ip;
+    int      frac;
+    if (e >= 0) {
+        frac = 0;
+        memset(&ip, 0, sizeof(ip));
+        for (int b = 0; b < 53; ++b) {
+            if ((M >> b) & 1) {
+                if (!add_pow2(&ip, (size_t)(b + e))) {
+                    return BIGNUM_CMP_LESS;     /* d больше любого bignum_t */
+                }
+            }
+        }
+    } else {
+        uint64_t q = -e >= 64 ? 0 : M >> -e;
+        frac = -e >= 64 ? 1 : (M & ((1ull << -e) - 1)) != 0;
+        bignum_init_u64(&ip, q);
+    }
+    int c = bignum_cmp(&an, &ip);
+    return (c == 0 && frac) ? BIGNUM_CMP_LESS : c;
+}
+
+static int check(const bignum_t *a, double d)
+{
+    int want = ref_cmp(a, d), got = bignum_cmp_double(a, d);
+    if (want != got) {
+        printf("\n  len=%zu d=%a: want %d got %d\n", a->len, d, want, got);
+    }
+    return want == got;
+}
+
+/** `2^k` как `double` (`k <= 1023`). */
+static double dpow2(int k)
+{
+    return from_bits((uint64_t)(k + 1023) << 52);
+}
+
+/** @brief Тест: окрестности 2^k. */
+int test_pow2_boundaries() {
+    size_t kmax = 64 * BIGNUM_CAPACITY - 1;
+    kmax = kmax < 1023 ? kmax : 1023;
+    int ok = 1;
+    for (size_t k = 0; ok && k <= kmax; ++k) {
+        bignum_t as[6];
+        size_t   na = 0;
+        pow2(&as[na++], k);                                 /* 2^k */
+        as[na] = as[0]; sub_pow2(&as[na], 0); na++;         /* 2^k - 1 */
+        as[na] = as[0];
+        if (add_pow2(&as[na], 0)) na++;                     /* 2^k + 1 */
+        as[na] = as[0];
+        if (k >= 52 && add_pow2(&as[na], k - 52)) na++;     /* следующий double */
+        if (k >= 53) {                                      /* предыдущий double */
+            as[na] = as[0]; sub_pow2(&as[na], k - 53); na++;
+        }
+        as[na] = as[0];
+        if (k >= 1 && add_pow2(&as[na], k - 1)) na++;       /* 1.5 · 2^k */
+
+        double base = dpow2((int)k);
+        double ds[7];
+        ds[0] = base;
+        ds[1] = from_bits(to_bits(base) + 1);               /* следующий double */
+        ds[2] = from_bits(to_bits(base) - 1);               /* предыдущий double */
+        ds[3] = base + 0.5;                                 /* дробная часть при k < 53 */
+        ds[4] = base - 0.5;
+        ds[5] = base * 1.5;
+        ds[6] = from_bits(to_bits(base) | ((1ull << 52) - 1));  /* 2^(k+1) - ulp */
+        for (size_t i = 0; ok && i < na; ++i) {
+            for (size_t j = 0; ok && j < 7; ++j) {
+                ok = check(&as[i], ds[j]);
+            }
+        }
+    }
+    return ok;
+}
+
+/** Ближайший к `a` `double` снизу (53 старших бита, усечение). */
+static double trunc_double(const bignum_t *a)
+{
+    size_t len = a->len;
+    if (len == 0) {
+        return 0.0;
+    }
+    size_t   B    = 64 * len - (size_t)__builtin_clzll(a->words[len - 1]);
+    uint64_t hi   = a->words[len - 1], lo = len > 1 ? a->words[len - 2] : 0;
+    unsigned lz   = (unsigned)__builtin_clzll(hi);
+    uint64_t norm = lz ? hi << lz | lo >> (64 - lz) : hi;
+    if (B > 1024) {
+        return from_bits(0x7FEFFFFFFFFFFFFFull);            /* DBL_MAX */
+    }
+    return from_bits((uint64_t)(B - 1 + 1023) << 52 | ((norm >> 11) & ((1ull << 52) - 1)));
+}
+
+/** @brief Тест: случайные пары. */
+int test_random() {
+    bignum_t a;
+    int ok = 1;
+    for (int iter = 0; ok && iter < 100000; ++iter) {
+        random_bignum(&a, (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        if (iter % 4 == 1 && a.len > 1) {
+            memset(a.words, 0, sizeof(uint64_t) * (a.len - 1));  /* хвост из нулей */
+            a.words[a.len - 1] &= ~0x7FFull;
+            a.words[a.len - 1] |= a.words[a.len - 1] == 0;
+        }
+        double d;
+        switch (iter % 4) {
+        case 0:
+            d = from_bits(rand64() & 0x7FEFFFFFFFFFFFFFull);
+            break;
+        case 3: {
+            uint64_t b = to_bits(trunc_double(&a));
+            d = from_bits(b + (uint64_t)(rand() % 3) - 1);
+            break;
+        }
+        default:
+            d = trunc_double(&a);
+            break;
+        }
+        ok = check(&a, d) && check(&a, -d);
+    }
+    return ok;
+}
+
+/** @brief Тест: особые значения. */
+int test_specials() {
+    bignum_t zero, one, two, full, x;
+    uint64_t w[BIGNUM_CAPACITY];
+    bignum_init_u64(&zero, 0);
+    bignum_init_u64(&one, 1);
+    bignum_init_u64(&two, 2);
+    for (size_t i = 0; i < BIGNUM_CAPACITY; ++i) {
+        w[i] = UINT64_MAX;
+    }
+    bignum_init_from_array(&full, w, BIGNUM_CAPACITY);
+    double inf = from_bits(0x7FF0000000000000ull), nan = from_bits(0x7FF8000000000001ull);
+    double sub = from_bits(1), neg_zero = from_bits(0x8000000000000000ull);
+
+    int ok = bignum_cmp_double(&zero, 0.0) == BIGNUM_CMP_EQ
+          && bignum_cmp_double(&zero, neg_zero) == BIGNUM_CMP_EQ
+          && bignum_cmp_double(&one, neg_zero) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&zero, sub) == BIGNUM_CMP_LESS
+          && bignum_cmp_double(&zero, -sub) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&one, sub) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&zero, 0.5) == BIGNUM_CMP_LESS
+          && bignum_cmp_double(&one, 0.5) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&one, 1.0) == BIGNUM_CMP_EQ
+          && bignum_cmp_double(&one, 1.5) == BIGNUM_CMP_LESS
+          && bignum_cmp_double(&two, 1.5) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&two, 1.9999999999999998) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&zero, -1.0) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&full, inf) == BIGNUM_CMP_LESS
+          && bignum_cmp_double(&zero, -inf) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&full, -DBL_MAX) == BIGNUM_CMP_GREATER
+          && bignum_cmp_double(&one, nan) == BIGNUM_DBL_ERROR_NAN
+          && bignum_cmp_double(&one, -nan) == BIGNUM_DBL_ERROR_NAN
+          && bignum_cmp_double(&one, inf - inf) == BIGNUM_DBL_ERROR_NAN;
+    ok = ok && check(&full, DBL_MAX) && check(&full, 1e300) && check(&full, 18446744073709551616.0);
+
+    /* Ненормализованная длина. */
+    x = one;
+    x.len = BIGNUM_CAPACITY < 3 ? BIGNUM_CAPACITY : 3;
+    ok = ok && bignum_cmp_double(&x, 1.0) == BIGNUM_CMP_EQ;
+    x = zero;
+    x.len = BIGNUM_CAPACITY;
+    ok = ok && bignum_cmp_double(&x, 0.0) == BIGNUM_CMP_EQ;
+
+    /* Точные целые 2^53 ± 1 (не представимы в double). */
+    bignum_init_u64(&x, (1ull << 53) + 1);
+    ok = ok && bignum_cmp_double(&x, 9007199254740992.0) == BIGNUM_CMP_GREATER;
+    bignum_init_u64(&x, UINT64_MAX);
+    ok = ok && bignum_cmp_double(&x, 18446744073709551616.0) == BIGNUM_CMP_LESS
+            && bignum_cmp_double(&x, 18446744073709549568.0) == BIGNUM_CMP_GREATER;
+
+    ok = ok && bignum_cmp_double(NULL, 1.0) == BIGNUM_DBL_ERROR_NULL;
+    x = full;
+    x.len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_cmp_double(&x, 1.0) == BIGNUM_DBL_ERROR_RANGE;
+    return ok;
+}
+
+/** @brief Тест: пакетная функция. */
+int test_batch() {
+    const size_t n = 1003;
+    bignum_t *a   = malloc(sizeof(bignum_t) * n);
+    double   *d   = malloc(sizeof(double) * n);
+    int8_t   *out = malloc(n);
+    int ok = a != NULL && d != NULL && out != NULL;
+    const double specials[] = { 0.0, -0.0, 0.5, 1.0, -1.0, 1e-310, 1e308, -1e308 };
+    for (size_t i = 0; ok && i < n; ++i) {
+        random_bignum(&a[i], (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        switch (i % 5) {
+        case 0:
+            d[i] = specials[(size_t)rand() % (sizeof(specials) / sizeof(specials[0]))];
+            break;
+        case 1:
+            d[i] = from_bits(0x7FF0000000000000ull | ((uint64_t)(rand() % 2) << 63));
+            break;
+        case 2:
+            d[i] = from_bits(rand64() & 0x7FEFFFFFFFFFFFFFull);
+            break;
+        default:
+            d[i] = trunc_double(&a[i]);
+            break;
+        }
+    }
+    ok = ok && bignum_cmp_double_batch(a, d, n, out) == BIGNUM_DBL_OK;
+    for (size_t i = 0; ok && i < n; ++i) {
+        ok = out[i] == bignum_cmp_double(&a[i], d[i]);
+    }
+    /* Хвосты короче вектора. */
+    for (size_t m = 1; ok && m < 9; ++m) {
+        ok = bignum_cmp_double_batch(a + 1, d + 1, m, out) == BIGNUM_DBL_OK;
+        for (size_t i = 0; ok && i < m; ++i) {
+            ok = out[i] == bignum_cmp_double(&a[i + 1], d[i + 1]);
+        }
+    }
+
+    if (ok) {
+        double saved = d[700];
+        d[700] = from_bits(0xFFF0000000000002ull);
+        ok = bignum_cmp_double_batch(a, d, n, out) == BIGNUM_DBL_ERROR_NAN;
+        d[700] = saved;
+        a[500].len = BIGNUM_CAPACITY + 1;
+        ok = ok && bignum_cmp_double_batch(a, d, n, out) == BIGNUM_DBL_ERROR_RANGE;
+    }
+    ok = ok && bignum_cmp_double_batch(NULL, d, n, out) == BIGNUM_DBL_ERROR_NULL
+            && bignum_cmp_double_batch(a, NULL, n, out) == BIGNUM_DBL_ERROR_NULL
+            && bignum_cmp_double_batch(a, d, n, NULL) == BIGNUM_DBL_ERROR_NULL
+            && bignum_cmp_double_batch(NULL, NULL, 0, NULL) == BIGNUM_DBL_OK;
+    free(a);
+    free(d);
+    free(out);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_double ---\n");
+    srand(50);
+
+    RUN_TEST(test_pow2_boundaries);
+    RUN_TEST(test_random);
+    RUN_TEST(test_specials);
+    RUN_TEST(test_batch);
+
+    printf("--- All bignum_double tests passed ---\n");
+    return 0;
+}
@@ -6,7 +6,7 @@
  *
  *  1. NULL-аргументы (a == NULL, b == NULL, оба NULL) — отдельные потоки
  *     гоняют ветку .return_null с возвратом BIGNUM_CMP_ERROR_NULL (0x80000000).
- *  2. Граничные длины: len=1, len=BIGNUM_CAPACITY (32).
+ *  2. Граничные длины: len=1, len=BIGNUM_CAPACITY.
  *  3. len=0 (оба нуля) — отдельный путь в .same_len через jz .return_ok.
  *  4. Большие числа с различием в старшем слове.
  *  5. Self-cmp под нагрузкой.
@@ -0,0 +1,267 @@
+/**
+ * @file    test_bignum_cmp_filter.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты фильтров bignum_bloom_* и bignum_fuse_*.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Нет ложноотрицательных:** `test_bloom_no_false_negatives`,
+ *     `test_fuse_no_false_negatives` — все вставленные ключи находятся, в том
+ *     числе копии с мусором за `len`; доля ложных срабатываний на чужих ключах
+ *     ограничена сверху (Блум 10 бит/ключ < 3%, fuse < 1%).
+ * 2.  **Пакетные запросы:** `test_batch_matches_single` — ответы
+ *     `*_contains_batch` совпадают с поштучными, включая хвост меньше пакета.
+ * 3.  **Сериализация:** `test_serialize_view` — образ Блума и fuse, за которым
+ *     лежит массив ключей, открывается без копирования и отвечает так же;
+ *     испорченные и чужие образы отвергаются, view только для чтения.
+ * 4.  **Граничные случаи:** `test_filter_edge_cases` — пустой и одноэлементный
+ *     fuse, дубликаты, `len > BIGNUM_CAPACITY`, `NULL`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_filter.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+#define N_KEYS   20000
+#define N_PROBES 100000
+
+/** Детерминированный ключ номер `i` длины 1..6. */
+static void key_of(bignum_t *x, uint64_t i)
+{
+    uint64_t w[6];
+    size_t len = (size_t)(i % 6) + 1;
+    for (size_t k = 0; k < len; ++k) {
+        w[k] = (i + 1) * 0x9E3779B97F4A7C15ull ^ (k << 56);
+    }
+    w[len - 1] |= 1;
+    bignum_init_from_array(x, w, len);
+}
+
+static bignum_t *make_keys(uint64_t first, size_t n)
+{
+    bignum_t *keys = malloc(sizeof(bignum_t) * n);
+    for (size_t i = 0; keys != NULL && i < n; ++i) {
+        key_of(&keys[i], first + i);
+    }
+    return keys;
+}
+
+/** Копия ключа с мусором за `len`. */
+static bignum_t with_garbage(const bignum_t *x)
+{
+    bignum_t y = *x;
+    for (size_t k = y.len; k < BIGNUM_CAPACITY; ++k) {
+        y.words[k] = ~(uint64_t)k;
+    }
+    return y;
+}
+
+/** @brief Тест: Блум находит все ключи, ложных срабатываний < 3%. */
+int test_bloom_no_false_negatives() {
+    bignum_bloom_t b;
+    bignum_t *keys = make_keys(0, N_KEYS);
+    if (keys == NULL || bignum_bloom_init(&b, N_KEYS, 10) != BIGNUM_FILTER_OK) {
+        free(keys);
+        return 0;
+    }
+    int ok = 1;
+    for (size_t i = 0; ok && i < N_KEYS; ++i) {
+        ok = bignum_bloom_add(&b, &keys[i]) == BIGNUM_FILTER_OK;
+    }
+    for (size_t i = 0; ok && i < N_KEYS; ++i) {
+        bignum_t g = with_garbage(&keys[i]);
+        ok = bignum_bloom_contains(&b, &keys[i]) == 1 && bignum_bloom_contains(&b, &g) == 1;
+    }
+    size_t fp = 0;
+    for (uint64_t i = 0; ok && i < N_PROBES; ++i) {
+        bignum_t x;
+        key_of(&x, N_KEYS + i);
+        fp += (size_t)bignum_bloom_contains(&b, &x);
+    }
+    ok = ok && fp * 100 < N_PROBES * 3;
+    bignum_bloom_free(&b);
+    free(keys);
+    return ok;
+}
+
+/** @brief Тест: fuse находит все ключи, ложных срабатываний < 1%. */
+int test_fuse_no_false_negatives() {
+    bignum_fuse_t f;
+    bignum_t *keys = make_keys(0, N_KEYS);
+    if (keys == NULL || bignum_fuse_build(&f, keys, N_KEYS) != BIGNUM_FILTER_OK) {
+        free(keys);
+        return 0;
+    }
+    int ok = f.size == N_KEYS && f.array_length < N_KEYS * 13 / 10;
+    for (size_t i = 0; ok && i < N_KEYS; ++i) {
+        bignum_t g = with_garbage(&keys[i]);
+        ok = bignum_fuse_contains(&f, &keys[i]) == 1 && bignum_fuse_contains(&f, &g) == 1;
+    }
+    size_t fp = 0;
+    for (uint64_t i = 0; ok && i < N_PROBES; ++i) {
+        bignum_t x;
+        key_of(&x, N_KEYS + i);
+        fp += (size_t)bignum_fuse_contains(&f, &x);
+    }
+    ok = ok && fp * 100 < N_PROBES;
+    bignum_fuse_free(&f);
+    free(keys);
+    return ok;
+}
+
+/** @brief Тест: пакетные запросы совпадают с поштучными. */
+int test_batch_matches_single() {
+    const size_t n = 1000, q = 2 * 1000 + 7;   /* хвост не кратен пакету */
+    bignum_t *keys   = make_keys(0, n);
+    bignum_t *probes = make_keys(n / 2, q);
+    uint8_t  *out    = malloc(q);
+    bignum_bloom_t b;
+    bignum_fuse_t  f;
+    int ok = keys && probes && out
+          && bignum_bloom_init(&b, n, 8) == BIGNUM_FILTER_OK
+          && bignum_fuse_build(&f, keys, n) == BIGNUM_FILTER_OK;
+    for (size_t i = 0; ok && i < n; ++i) {
+        ok = bignum_bloom_add(&b, &keys[i]) == BIGNUM_FILTER_OK;
+    }
+    ok = ok && bignum_bloom_contains_batch(&b, probes, q, out) == BIGNUM_FILTER_OK;
+    for (size_t i = 0; ok && i < q; ++i) {
+        ok = out[i] == bignum_bloom_contains(&b, &probes[i]);
+    }
+    ok = ok && bignum_fuse_contains_batch(&f, probes, q, out) == BIGNUM_FILTER_OK;
+    for (size_t i = 0; ok && i < q; ++i) {
+        ok = out[i] == bignum_fuse_contains(&f, &probes[i]) && (i >= n / 2 || out[i] == 1);
+    }
+    ok = ok && bignum_fuse_contains_batch(&f, NULL, 0, NULL) == BIGNUM_FILTER_OK;
+    bignum_bloom_free(&b);
+    bignum_fuse_free(&f);
+    free(keys);
+    free(probes);
+    free(out);
+    return ok;
+}
+
+/** @brief Тест: образ фильтра + отсортированные ключи открываются без копирования. */
+int test_serialize_view() {
+    const size_t n = 3000;
+    bignum_t *keys = make_keys(0, n);
+    bignum_bloom_t b, bv;
+    bignum_fuse_t  f, fv;
+    if (keys == NULL || bignum_bloom_init(&b, n, 12) != BIGNUM_FILTER_OK) {
+        free(keys);
+        return 0;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        bignum_bloom_add(&b, &keys[i]);
+    }
+    if (bignum_fuse_build(&f, keys, n) != BIGNUM_FILTER_OK) {
+        bignum_bloom_free(&b);
+        free(keys);
+        return 0;
+    }
+
+    size_t bsz = bignum_bloom_serialized_size(&b), fsz = bignum_fuse_serialized_size(&f);
+    size_t total = bsz + fsz + n * sizeof(bignum_t);
+    uint8_t *buf = aligned_alloc(64, (total + 63) & ~(size_t)63);
+    size_t w1 = 0, w2 = 0, c1 = 0, c2 = 0;
+    int ok = buf != NULL && bsz % 64 == 0 && fsz % 64 == 0
+          && bignum_bloom_serialize(&b, buf, bsz - 1, NULL) == BIGNUM_FILTER_ERROR_RANGE
+          && bignum_bloom_serialize(&b, buf, total, &w1) == BIGNUM_FILTER_OK && w1 == bsz
+          && bignum_fuse_serialize(&f, buf + w1, total - w1, &w2) == BIGNUM_FILTER_OK && w2 == fsz;
+    if (ok) {
+        memcpy(buf + w1 + w2, keys, n * sizeof(bignum_t));
+        ok = bignum_bloom_view(&bv, buf, total, &c1) == BIGNUM_FILTER_OK && c1 == bsz
+          && bignum_fuse_view(&fv, buf + c1, total - c1, &c2) == BIGNUM_FILTER_OK && c2 == fsz
+          && (const void *)fv.fingerprints == (const void *)(buf + c1 + BIGNUM_FILTER_HEADER_SIZE)
+          && bignum_bloom_add(&bv, &keys[0]) == BIGNUM_FILTER_ERROR_READONLY;
+    }
+    const bignum_t *table = (const bignum_t *)(buf + c1 + c2);
+    for (size_t i = 0; ok && i < n + 500; ++i) {
+        bignum_t x;
+        key_of(&x, i);
+        ok = bignum_bloom_contains(&bv, &x) == bignum_bloom_contains(&b, &x)
+          && bignum_fuse_contains(&fv, &x) == bignum_fuse_contains(&f, &x)
+          && (i >= n || bignum_cmp(&table[i], &x) == 0);
+    }
+    if (ok) {
+        /* Чужой тип, испорченная магия, усечённый буфер, невыровненный адрес. */
+        ok = bignum_fuse_view(&fv, buf, total, NULL) == BIGNUM_FILTER_ERROR_FORMAT
+          && bignum_bloom_view(&bv, buf, BIGNUM_FILTER_HEADER_SIZE + 8, NULL) == BIGNUM_FILTER_ERROR_FORMAT
+          && bignum_bloom_view(&bv, buf + 4, total - 4, NULL) == BIGNUM_FILTER_ERROR_FORMAT;
+        buf[0] ^= 0xFF;
+        ok = ok && bignum_bloom_view(&bv, buf, total, NULL) == BIGNUM_FILTER_ERROR_FORMAT;
+    }
+    bignum_bloom_free(&bv);
+    bignum_fuse_free(&fv);
+    bignum_bloom_free(&b);
+    bignum_fuse_free(&f);
+    free(buf);
+    free(keys);
+    return ok;
+}
+
+/** @brief Тест: пустой и крошечный fuse, дубликаты, ошибки. */
+int test_filter_edge_cases() {
+    bignum_fuse_t f;
+    bignum_bloom_t b;
+    bignum_t k[4], bad;
+    key_of(&k[0], 1);
+    key_of(&k[1], 2);
+    k[2] = with_garbage(&k[0]);   /* дубликаты с точки зрения bignum_cmp */
+    k[3] = k[1];
+    memset(&bad, 0, sizeof(bad));
+    bad.len = BIGNUM_CAPACITY + 1;
+
+    int ok = bignum_fuse_build(&f, NULL, 0) == BIGNUM_FILTER_OK && f.size == 0
+          && bignum_fuse_contains(&f, &k[0]) == 0;
+    bignum_fuse_free(&f);
+    ok = ok && bignum_fuse_build(&f, k, 1) == BIGNUM_FILTER_OK && bignum_fuse_contains(&f, &k[0]) == 1;
+    bignum_fuse_free(&f);
+    ok = ok && bignum_fuse_build(&f, k, 4) == BIGNUM_FILTER_OK && f.size == 2
+          && bignum_fuse_contains(&f, &k[0]) == 1 && bignum_fuse_contains(&f, &k[1]) == 1;
+    bignum_fuse_free(&f);
+
+    ok = ok && bignum_fuse_build(&f, &bad, 1) == BIGNUM_FILTER_ERROR_RANGE
+          && bignum_fuse_build(NULL, k, 1) == BIGNUM_FILTER_ERROR_NULL
+          && bignum_fuse_contains(&f, &k[0]) == BIGNUM_FILTER_ERROR_NULL
+          && bignum_bloom_init(&b, 10, 0) == BIGNUM_FILTER_ERROR_RANGE
+          && bignum_bloom_init(&b, 0, 10) == BIGNUM_FILTER_OK && b.nblocks == 1
+          && bignum_bloom_add(&b, &bad) == BIGNUM_FILTER_ERROR_RANGE
+          && bignum_bloom_add(&b, NULL) == BIGNUM_FILTER_ERROR_NULL
+          && bignum_bloom_contains(NULL, &k[0]) == BIGNUM_FILTER_ERROR_NULL
+          && bignum_bloom_contains(&b, &k[0]) == 0;
+    bignum_bloom_free(&b);
+    bignum_bloom_free(NULL);
+    bignum_fuse_free(NULL);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum filters ---\n");
+
+    RUN_TEST(test_bloom_no_false_negatives);
+    RUN_TEST(test_fuse_no_false_negatives);
+    RUN_TEST(test_batch_matches_single);
+    RUN_TEST(test_serialize_view);
+    RUN_TEST(test_filter_edge_cases);
+
+    printf("--- All bignum filter tests passed ---\n");
+    return 0;
+}
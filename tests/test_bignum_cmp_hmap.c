@@ -0,0 +1,176 @@
+/**
+ * @file    test_bignum_cmp_hmap.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты хеш-таблицы bignum_hmap_* и хеша bignum_hash64.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Хеш:** `test_hash_ignores_tail` — слова за `len` не влияют на хеш,
+ *     `len` влияет (ключи `{1}` и `{1, 0…}` различаются длиной).
+ * 2.  **Вставка/поиск с ростом:** `test_hmap_insert_find_grow` — 20000 ключей
+ *     из таблицы на 16 слотов, повторная вставка возвращает `EXISTS` и прежний индекс.
+ * 3.  **Удаление:** `test_hmap_erase_model` — случайная последовательность
+ *     insert/erase/find сверяется с простой моделью (массив флагов), включая
+ *     перенос последней записи и переиспользование `DELETED`.
+ * 4.  **Множество и ошибки:** `test_hmap_set_and_errors` — `values == NULL`,
+ *     `len > BIGNUM_CAPACITY`, `NULL`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_hmap.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+/** Детерминированный ключ номер `i`: длина 1..4, слова зависят от `i`. */
+static void key_of(bignum_t *x, uint64_t i)
+{
+    uint64_t w[4];
+    size_t len = (size_t)(i % 4) + 1;
+    for (size_t k = 0; k < len; ++k) {
+        w[k] = (i + 1) * 0x9E3779B97F4A7C15ull + k;
+    }
+    w[len - 1] |= 1;
+    bignum_init_from_array(x, w, len);
+}
+
+/** @brief Тест: хеш читает только `len` слов. */
+int test_hash_ignores_tail() {
+    bignum_t a, b;
+    key_of(&a, 7);
+    b = a;
+    for (size_t k = b.len; k < BIGNUM_CAPACITY; ++k) {
+        b.words[k] = 0xDEADBEEFull + k;   /* мусор за len */
+    }
+    if (bignum_hash64(&a, 1) != bignum_hash64(&b, 1) || bignum_hash64(&a, 1) == bignum_hash64(&a, 2)) {
+        return 0;
+    }
+    bignum_t one, one_long;
+    bignum_init_u64(&one, 1);
+    one_long = one;
+    one_long.len = 2;                     /* ненормализованное {1, 0} */
+    one_long.words[1] = 0;
+    return bignum_hash64(&one, 0) != bignum_hash64(&one_long, 0);
+}
+
+/** @brief Тест: вставка с ростом, поиск попаданий и промахов. */
+int test_hmap_insert_find_grow() {
+    const uint64_t n = 20000;
+    bignum_hmap_t m;
+    if (bignum_hmap_init(&m, 0, 1) != BIGNUM_HMAP_OK) {
+        return 0;
+    }
+    int ok = 1;
+    for (uint64_t i = 0; ok && i < n; ++i) {
+        bignum_t k;
+        size_t idx;
+        key_of(&k, i);
+        ok = bignum_hmap_insert(&m, &k, i * 10, &idx) == BIGNUM_HMAP_OK && idx == i;
+    }
+    ok = ok && m.size == n && m.capacity >= n;
+    for (uint64_t i = 0; ok && i < n; ++i) {
+        bignum_t k;
+        size_t idx = 0;
+        key_of(&k, i);
+        ok = bignum_hmap_find(&m, &k, &idx) == 1 && m.values[idx] == i * 10
+          && bignum_hmap_insert(&m, &k, 0, &idx) == BIGNUM_HMAP_EXISTS && m.values[idx] == i * 10;
+        key_of(&k, i + n);
+        ok = ok && bignum_hmap_find(&m, &k, NULL) == 0;
+    }
+    bignum_hmap_free(&m);
+    return ok;
+}
+
+/** @brief Тест: случайные insert/erase/find против модели. */
+int test_hmap_erase_model() {
+    enum { UNIVERSE = 3000, OPS = 200000 };
+    static unsigned char present[UNIVERSE];
+    bignum_hmap_t m;
+    size_t live = 0;
+
+    memset(present, 0, sizeof(present));
+    if (bignum_hmap_init(&m, 64, 1) != BIGNUM_HMAP_OK) {
+        return 0;
+    }
+    int ok = 1;
+    for (int op = 0; ok && op < OPS; ++op) {
+        uint64_t i = (uint64_t)(rand() % UNIVERSE);
+        bignum_t k;
+        size_t idx = 0;
+        key_of(&k, i);
+        switch (rand() % 3) {
+        case 0: {
+            bignum_hmap_status_t st = bignum_hmap_insert(&m, &k, i, &idx);
+            ok = present[i] ? st == BIGNUM_HMAP_EXISTS : st == BIGNUM_HMAP_OK;
+            if (!present[i]) { present[i] = 1; live++; }
+            break;
+        }
+        case 1: {
+            bignum_hmap_status_t st = bignum_hmap_erase(&m, &k);
+            ok = present[i] ? st == BIGNUM_HMAP_OK : st == BIGNUM_HMAP_NOT_FOUND;
+            if (present[i]) { present[i] = 0; live--; }
+            break;
+        }
+        default:
+            ok = bignum_hmap_find(&m, &k, &idx) == present[i]
+              && (!present[i] || (m.values[idx] == i && bignum_cmp(&m.keys[idx], &k) == 0));
+            break;
+        }
+        ok = ok && m.size == live;
+    }
+    bignum_hmap_free(&m);
+    return ok;
+}
+
+/** @brief Тест: множество без значений, ошибки и NULL. */
+int test_hmap_set_and_errors() {
+    bignum_hmap_t s;
+    bignum_t k, bad;
+    if (bignum_hmap_init(&s, 10, 0) != BIGNUM_HMAP_OK || s.values != NULL) {
+        return 0;
+    }
+    key_of(&k, 1);
+    memset(&bad, 0, sizeof(bad));
+    bad.len = BIGNUM_CAPACITY + 1;
+    int ok = bignum_hmap_insert(&s, &k, 123, NULL) == BIGNUM_HMAP_OK
+          && bignum_hmap_find(&s, &k, NULL) == 1
+          && bignum_hmap_insert(&s, &bad, 0, NULL) == BIGNUM_HMAP_ERROR_RANGE
+          && bignum_hmap_insert(&s, NULL, 0, NULL) == BIGNUM_HMAP_ERROR_NULL
+          && bignum_hmap_find(NULL, &k, NULL) == BIGNUM_HMAP_ERROR_NULL
+          && bignum_hmap_erase(&s, NULL) == BIGNUM_HMAP_ERROR_NULL
+          && bignum_hmap_init(NULL, 0, 0) == BIGNUM_HMAP_ERROR_NULL;
+    bignum_hmap_free(&s);
+    bignum_hmap_free(NULL);
+    /* Освобождённая таблица ведёт себя как неинициализированная. */
+    ok = ok && bignum_hmap_find(&s, &k, NULL) == BIGNUM_HMAP_ERROR_NULL;
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_hmap ---\n");
+    srand(34);
+
+    RUN_TEST(test_hash_ignores_tail);
+    RUN_TEST(test_hmap_insert_find_grow);
+    RUN_TEST(test_hmap_erase_model);
+    RUN_TEST(test_hmap_set_and_errors);
+
+    printf("--- All bignum_hmap tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file    test_bignum_cmp_hpp.cpp
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты C++20-обёртки bignum_cmp.hpp.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **constexpr-путь:** `static_assert` ниже — сравнение вычисляется компилятором
+ *     для `bignum_t` и для других ёмкостей (`basic_bignum_storage<4>`).
+ * 2.  **Эквивалентность ядру:** `test_hpp_matches_cmp` — `operator<=>` во время
+ *     выполнения совпадает с `bignum_cmp` на случайных парах.
+ * 3.  **uint64_t:** `test_hpp_u64` — ноль (`len = 0`), одно слово, многословные числа.
+ * 4.  **Прозрачные компараторы:** `test_hpp_sort_and_map` — `std::sort` и
+ *     гетерогенный `std::map::find` по `uint64_t`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp.hpp"
+extern "C" {
+#include <bignum_common.h>
+}
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+// --- Проверки на этапе компиляции ---
+namespace {
+
+constexpr bignum_t k_zero   = {{0}, 0};
+constexpr bignum_t k_one    = {{1}, 1};
+constexpr bignum_t k_2_64   = {{0, 1}, 2};
+constexpr bignum_t k_2_64p1 = {{1, 1}, 2};
+
+static_assert(bignum::bignum_view{k_zero} == 0u);
+static_assert(bignum::bignum_view{k_one} == 1u);
+static_assert(bignum::bignum_view{k_2_64} > UINT64_MAX);
+static_assert(bignum::bignum_view{k_2_64} < bignum::bignum_view{k_2_64p1});
+static_assert((bignum::bignum_view{k_2_64} <=> bignum::bignum_view{k_2_64}) == std::strong_ordering::equal);
+static_assert(bignum::less{}(k_one, k_2_64) && !bignum::less{}(k_2_64, k_one));
+static_assert(bignum::less{}(0u, k_one) && bignum::greater{}(k_2_64, 5u));
+
+constexpr bignum::basic_bignum_storage<4> k_small_a = {{7, 0, 0, 3}, 4};
+constexpr bignum::basic_bignum_storage<4> k_small_b = {{9, 0, 0, 3}, 4};
+static_assert(bignum::basic_bignum<4>{k_small_a} < bignum::basic_bignum<4>{k_small_b});
+static_assert(bignum::basic_less<4>{}(k_small_a, k_small_b));
+
+static_assert(bignum::bignum_operand<bignum_t, BIGNUM_CAPACITY>);
+static_assert(bignum::bignum_operand<unsigned, BIGNUM_CAPACITY>);
+static_assert(!bignum::bignum_operand<int, BIGNUM_CAPACITY>);
+
+void random_bignum(bignum_t *x, size_t len)
+{
+    uint64_t w[BIGNUM_CAPACITY];
+    for (size_t i = 0; i < len; ++i) {
+        w[i] = ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 11) ^ (uint64_t)rand();
+    }
+    bignum_init_from_array(x, w, len);
+}
+
+int sign(int v) { return (v > 0) - (v < 0); }
+int sign(std::strong_ordering o) { return (o > 0) - (o < 0); }
+
+} // namespace
+
+/** @brief Тест: `operator<=>` во время выполнения совпадает с `bignum_cmp`. */
+int test_hpp_matches_cmp() {
+    for (int it = 0; it < 20000; ++it) {
+        bignum_t a, b;
+        random_bignum(&a, (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        if (rand() & 1) {
+            b = a;
+            if (b.len > 0) {
+                b.words[rand() % b.len] ^= (uint64_t)rand() & 3;
+            }
+        } else {
+            random_bignum(&b, (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        }
+        bignum::bignum_view va{a}, vb{b};
+        int ref = sign(bignum_cmp(&a, &b));
+        if (sign(va <=> vb) != ref || sign(bignum::compare(va, vb)) != ref) {
+            return 0;
+        }
+        if ((va == vb) != (ref == 0) || (va < vb) != (ref < 0)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/** @brief Тест: сравнение с `uint64_t`. */
+int test_hpp_u64() {
+    bignum_t zero, small, big;
+    bignum_init_u64(&zero, 0);
+    bignum_init_u64(&small, 100);
+    random_bignum(&big, 3);
+
+    bignum::bignum_view z{zero}, s{small}, b{big};
+    return z == 0u && z < 1u && !(z > 0u)
+        && s == 100u && s > 99u && s < 101u && 100u == s
+        && b > UINT64_MAX && UINT64_MAX < b && b != 0u;
+}
+
+/** @brief Тест: `std::sort` и гетерогенный поиск в `std::map`. */
+int test_hpp_sort_and_map() {
+    std::vector<bignum_t> v(500);
+    for (auto &x : v) {
+        random_bignum(&x, (size_t)(rand() % 4));
+    }
+    std::sort(v.begin(), v.end(), bignum::less{});
+    for (size_t i = 1; i < v.size(); ++i) {
+        if (bignum_cmp(&v[i - 1], &v[i]) > 0) {
+            return 0;
+        }
+    }
+    std::sort(v.begin(), v.end(), bignum::greater{});
+    if (!std::is_sorted(v.begin(), v.end(), bignum::greater{})) {
+        return 0;
+    }
+
+    std::map<bignum_t, int, bignum::less> m;
+    for (uint64_t i = 0; i < 64; ++i) {
+        bignum_t k;
+        bignum_init_u64(&k, i * 3);
+        m.emplace(k, (int)i);
+    }
+    bignum_t wide;
+    random_bignum(&wide, 2);
+    m.emplace(wide, -1);
+
+    auto it = m.find(uint64_t{27});
+    if (it == m.end() || it->second != 9 || m.find(uint64_t{28}) != m.end()) {
+        return 0;
+    }
+    // Все однословные ключи меньше 2^64, многословный — последний.
+    auto ub = m.upper_bound(UINT64_MAX);
+    return ub != m.end() && ub->second == -1 && std::next(ub) == m.end()
+        && m.count(0u) == 1;
+}
+
+int main() {
+    printf("--- Running tests for bignum_cmp.hpp ---\n");
+    srand(7);
+
+    RUN_TEST(test_hpp_matches_cmp);
+    RUN_TEST(test_hpp_u64);
+    RUN_TEST(test_hpp_sort_and_map);
+
+    printf("--- All bignum_cmp.hpp tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file    test_bignum_cmp_join.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты bignum_merge_join и bignum_set_op (одно- и многопоточных).
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Эталон:** `test_join_matches_reference` — для случайных пар массивов с
+ *     дубликатами и равными префиксами merge-join и все три операции совпадают
+ *     с наивным слиянием через `bignum_cmp` (семантика `std::set_*`); размеры
+ *     сбалансированные, сильно перекошенные в обе стороны (galloping) и пустые.
+ * 2.  **Неполный буфер:** `test_join_truncated_output` — при `cap` меньше
+ *     результата записаны его первые `cap` элементов, `count` — полный размер.
+ * 3.  **Потоки:** `test_join_mt` — `*_mt` при 1, 2, 3, 7 и 0 потоках совпадают
+ *     с однопоточными, в том числе когда граница отрезка попадает в длинную
+ *     группу равных ключей.
+ * 4.  **Ошибки:** `test_join_errors` — `NULL`, неизвестная операция,
+ *     `len > BIGNUM_CAPACITY`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_join.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+/** Отсортированный массив из `n` ключей примерно `distinct` различных значений. */
+static void fill_sorted(bignum_t *v, size_t n, unsigned distinct)
+{
+    for (size_t i = 0; i < n; ++i) {
+        unsigned r = (unsigned)rand() % distinct;
+        uint64_t w[2] = { r / 3, (r % 3) + 1 };   /* по три ключа на префикс */
+        bignum_init_from_array(&v[i], w, (r % 2) + 1);
+        for (size_t k = v[i].len; k < BIGNUM_CAPACITY; ++k) {
+            v[i].words[k] = (uint64_t)rand();     /* мусор за len */
+        }
+    }
+    qsort(v, n, sizeof(bignum_t), cmp_qsort);
+}
+
+/** Наивное слияние: пары (op < 0) или указатели. */
+static size_t ref_merge(int op, const bignum_t *a, size_t na, const bignum_t *b, size_t nb,
+                        bignum_join_pair_t *pairs, const bignum_t **refs)
+{
+    size_t i = 0, j = 0, c = 0;
+    while (i < na && j < nb) {
+        int r = bignum_cmp(&a[i], &b[j]);
+        if (r < 0) {
+            if (op == BIGNUM_SET_UNION || op == BIGNUM_SET_DIFFERENCE) refs[c++] = &a[i];
+            ++i;
+        } else if (r > 0) {
+            if (op == BIGNUM_SET_UNION) refs[c++] = &b[j];
+            ++j;
+        } else if (op < 0) {
+            for (size_t y = j; y < nb && bignum_cmp(&a[i], &b[y]) == 0; ++y) {
+                pairs[c].a = i;
+                pairs[c++].b = y;
+            }
+            ++i;
+        } else {
+            if (op != BIGNUM_SET_DIFFERENCE) refs[c++] = &a[i];
+            ++i;
+            ++j;
+        }
+    }
+    for (; op == BIGNUM_SET_UNION || op == BIGNUM_SET_DIFFERENCE ? i < na : 0; ++i) refs[c++] = &a[i];
+    for (; op == BIGNUM_SET_UNION && j < nb; ++j) refs[c++] = &b[j];
+    return c;
+}
+
+/** Сравнивает все операции с эталоном при заданном числе потоков. */
+static int check_all(const bignum_t *a, size_t na, const bignum_t *b, size_t nb, unsigned threads,
+                     bignum_join_pair_t *rp, bignum_join_pair_t *gp,
+                     const bignum_t **rr, const bignum_t **gr, size_t cap)
+{
+    size_t rc = ref_merge(-1, a, na, b, nb, rp, NULL), count = 0;
+    if (bignum_merge_join_mt(a, na, b, nb, threads, gp, cap, &count) != BIGNUM_JOIN_OK
+        || count != rc || memcmp(rp, gp, rc * sizeof(*rp)) != 0) {
+        return 0;
+    }
+    for (int op = BIGNUM_SET_INTERSECTION; op <= BIGNUM_SET_DIFFERENCE; ++op) {
+        rc = ref_merge(op, a, na, b, nb, NULL, rr);
+        if (bignum_set_op_mt((bignum_set_op_t)op, a, na, b, nb, threads, gr, cap, &count) != BIGNUM_JOIN_OK
+            || count != rc || memcmp((const void *)rr, (const void *)gr, rc * sizeof(*rr)) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/** Буферы под худший случай (merge-join по группам). */
+#define OUT_CAP 4000000
+
+/** @brief Тест: совпадение с наивным слиянием. */
+int test_join_matches_reference() {
+    bignum_t *a = malloc(sizeof(bignum_t) * 20000);
+    bignum_t *b = malloc(sizeof(bignum_t) * 20000);
+    bignum_join_pair_t *rp = malloc(sizeof(*rp) * OUT_CAP), *gp = malloc(sizeof(*gp) * OUT_CAP);
+    const bignum_t **rr = malloc(sizeof(*rr) * OUT_CAP), **gr = malloc(sizeof(*gr) * OUT_CAP);
+    int ok = a && b && rp && gp && rr && gr;
+    static const size_t sizes[][2] = {
+        { 0, 0 }, { 0, 100 }, { 100, 0 }, { 1, 1 }, { 1000, 1000 }, { 5000, 3000 },
+        { 20000, 10 }, { 10, 20000 }, { 20000, 300 }, { 1, 20000 }
+    };
+    for (size_t r = 0; ok && r < sizeof(sizes) / sizeof(sizes[0]); ++r) {
+        for (unsigned distinct = 50; ok && distinct <= 50000; distinct *= 10) {
+            fill_sorted(a, sizes[r][0], distinct);
+            fill_sorted(b, sizes[r][1], distinct);
+            if (sizes[r][0] * sizes[r][1] / distinct < OUT_CAP / 2) {
+                ok = check_all(a, sizes[r][0], b, sizes[r][1], 1, rp, gp, rr, gr, OUT_CAP);
+            }
+        }
+    }
+    ok = ok && bignum_set_intersection(a, 100, b, 100, gr, OUT_CAP, &(size_t){0}) == BIGNUM_JOIN_OK
+            && bignum_set_union(a, 100, b, 100, gr, OUT_CAP, &(size_t){0}) == BIGNUM_JOIN_OK
+            && bignum_set_difference(a, 100, b, 100, gr, OUT_CAP, &(size_t){0}) == BIGNUM_JOIN_OK;
+    free(a); free(b); free(rp); free(gp); free((void *)rr); free((void *)gr);
+    return ok;
+}
+
+/** @brief Тест: результат больше буфера. */
+int test_join_truncated_output() {
+    bignum_t a[500], b[500];
+    bignum_join_pair_t rp[20000], gp[20000];
+    const bignum_t *rr[1000], *gr[1000];
+    fill_sorted(a, 500, 100);
+    fill_sorted(b, 500, 100);
+    size_t rc = ref_merge(-1, a, 500, b, 500, rp, NULL), count = 0;
+    int ok = rc > 100
+          && bignum_merge_join(a, 500, b, 500, gp, 100, &count) == BIGNUM_JOIN_OK && count == rc
+          && memcmp(rp, gp, 100 * sizeof(*rp)) == 0
+          && bignum_merge_join(a, 500, b, 500, NULL, 0, &count) == BIGNUM_JOIN_OK && count == rc;
+    rc = ref_merge(BIGNUM_SET_UNION, a, 500, b, 500, NULL, rr);
+    ok = ok && bignum_set_union(a, 500, b, 500, gr, 77, &count) == BIGNUM_JOIN_OK && count == rc
+            && memcmp((const void *)rr, (const void *)gr, 77 * sizeof(*rr)) == 0;
+    return ok;
+}
+
+/** @brief Тест: многопоточные варианты. */
+int test_join_mt() {
+    const size_t n = 300000;
+    static const unsigned threads[] = { 1, 2, 3, 7, 0 };
+    bignum_t *a = malloc(sizeof(bignum_t) * n);
+    bignum_t *b = malloc(sizeof(bignum_t) * n);
+    bignum_join_pair_t *rp = malloc(sizeof(*rp) * OUT_CAP), *gp = malloc(sizeof(*gp) * OUT_CAP);
+    const bignum_t **rr = malloc(sizeof(*rr) * OUT_CAP), **gr = malloc(sizeof(*gr) * OUT_CAP);
+    int ok = a && b && rp && gp && rr && gr;
+    for (int round = 0; ok && round < 3; ++round) {
+        size_t na = n, nb = (round == 1) ? n / 100 : n / 2;
+        fill_sorted(a, na, (round == 2) ? 5 : 1000000);   /* round 2: группы длиной ~n/5 */
+        fill_sorted(b, nb, (round == 2) ? 50 : 1000000);
+        if (round == 2) {
+            nb = 20;                                      /* p * q пар остаётся в пределах буфера */
+        }
+        for (size_t t = 0; ok && t < sizeof(threads) / sizeof(threads[0]); ++t) {
+            ok = check_all(a, na, b, nb, threads[t], rp, gp, rr, gr, OUT_CAP)
+              && check_all(b, nb, a, na, threads[t], rp, gp, rr, gr, OUT_CAP);
+        }
+    }
+    free(a); free(b); free(rp); free(gp); free((void *)rr); free((void *)gr);
+    return ok;
+}
+
+/** @brief Тест: ошибки. */
+int test_join_errors() {
+    bignum_t a[4], b[4];
+    const bignum_t *out[8];
+    bignum_join_pair_t pairs[8];
+    size_t count = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        bignum_init_u64(&a[i], i);
+        bignum_init_u64(&b[i], i + 2);
+    }
+    int ok = bignum_merge_join(NULL, 1, b, 4, pairs, 8, &count) == BIGNUM_JOIN_ERROR_NULL
+          && bignum_merge_join(a, 4, b, 4, NULL, 8, &count) == BIGNUM_JOIN_ERROR_NULL
+          && bignum_merge_join(a, 4, b, 4, pairs, 8, NULL) == BIGNUM_JOIN_ERROR_NULL
+          && bignum_set_op((bignum_set_op_t)7, a, 4, b, 4, out, 8, &count) == BIGNUM_JOIN_ERROR_RANGE
+          && bignum_merge_join(a, 4, b, 4, pairs, 8, &count) == BIGNUM_JOIN_OK && count == 2
+          && pairs[0].a == 2 && pairs[0].b == 0 && pairs[1].a == 3 && pairs[1].b == 1;
+    b[1].len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_merge_join(a, 4, b, 4, pairs, 8, &count) == BIGNUM_JOIN_ERROR_RANGE
+            && bignum_set_union(a, 4, b, 4, out, 8, &count) == BIGNUM_JOIN_ERROR_RANGE;
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum join ---\n");
+    srand(40);
+
+    RUN_TEST(test_join_matches_reference);
+    RUN_TEST(test_join_truncated_output);
+    RUN_TEST(test_join_mt);
+    RUN_TEST(test_join_errors);
+
+    printf("--- All bignum join tests passed ---\n");
+    return 0;
+}
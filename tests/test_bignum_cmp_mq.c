@@ -0,0 +1,226 @@
+/**
+ * @file    test_bignum_cmp_mq.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты MultiQueue (bignum_mq_*).
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Точный порядок:** `test_single_queue_exact` — при одной куче извлечение
+ *     идёт строго по `bignum_cmp` (MIN и MAX), включая ключи с равными
+ *     префиксами и дубликаты.
+ * 2.  **Ошибка ранга:** `test_rank_error_bounded` — при 16 кучах средний ранг
+ *     извлечённого элемента среди оставшихся мал (O(m)), а не O(n).
+ * 3.  **Конкурентность:** `test_concurrent_no_loss` — 4 производителя и
+ *     4 потребителя одновременно; каждое значение извлечено ровно один раз.
+ * 4.  **Границы:** `test_full_empty_errors` — `BIGNUM_MQ_FULL` при заполнении
+ *     всех куч, `BIGNUM_MQ_EMPTY`, `len > BIGNUM_CAPACITY`, `NULL`.
+ *
+ * @note Для сборки этого теста требуется флаг `-pthread`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_mq.h"
+#include <bignum_common.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+/** Ключ с номером `id` в младшем слове: у многих ключей общий префикс. */
+static void make_key(bignum_t *x, uint64_t id, uint64_t top)
+{
+    uint64_t w[2] = { id, top };
+    bignum_init_from_array(x, w, top ? 2 : 1);
+}
+
+/** @brief Тест: одна куча — точная очередь. */
+int test_single_queue_exact() {
+    const size_t n = 3000;
+    bignum_t *v = malloc(sizeof(bignum_t) * n);
+    bignum_mq_t q;
+    int ok = v != NULL;
+    for (int order = BIGNUM_MQ_MIN; ok && order <= BIGNUM_MQ_MAX; ++order) {
+        for (size_t i = 0; i < n; ++i) {
+            make_key(&v[i], (uint64_t)(rand() % 500), (uint64_t)(rand() % 4));
+        }
+        ok = bignum_mq_init(&q, 1, n, (bignum_mq_order_t)order) == BIGNUM_MQ_OK;
+        for (size_t i = 0; ok && i < n; ++i) {
+            ok = bignum_mq_push(&q, &v[i]) == BIGNUM_MQ_OK;
+        }
+        qsort(v, n, sizeof(bignum_t), cmp_qsort);
+        for (size_t i = 0; ok && i < n; ++i) {
+            bignum_t out;
+            const bignum_t *want = (order == BIGNUM_MQ_MIN) ? &v[i] : &v[n - 1 - i];
+            ok = bignum_mq_pop(&q, &out) == BIGNUM_MQ_OK && bignum_cmp(&out, want) == 0;
+        }
+        ok = ok && bignum_mq_size(&q) == 0;
+        bignum_mq_free(&q);
+    }
+    free(v);
+    return ok;
+}
+
+/** @brief Тест: ранг извлечённого элемента ограничен O(m). */
+int test_rank_error_bounded() {
+    const size_t n = 20000, m = 16;
+    unsigned char *gone = calloc(n, 1);
+    bignum_mq_t q;
+    int ok = gone != NULL && bignum_mq_init(&q, m, n, BIGNUM_MQ_MIN) == BIGNUM_MQ_OK;
+    for (size_t i = 0; ok && i < n; ++i) {
+        bignum_t x;
+        make_key(&x, (i * 7919) % n, 0);     /* перестановка 0 … n-1 */
+        ok = bignum_mq_push(&q, &x) == BIGNUM_MQ_OK;
+    }
+    /* Ранг = число ещё не извлечённых меньших ключей; наименьший оставшийся — `low`. */
+    size_t low = 0, total = 0, worst = 0;
+    for (size_t k = 0; ok && k < n; ++k) {
+        bignum_t out;
+        ok = bignum_mq_pop(&q, &out) == BIGNUM_MQ_OK && out.words[0] < n && !gone[out.words[0]];
+        if (!ok) {
+            break;
+        }
+        size_t rank = 0;
+        for (size_t r = low; r < out.words[0]; ++r) {
+            rank += !gone[r];
+        }
+        gone[out.words[0]] = 1;
+        while (low < n && gone[low]) {
+            ++low;
+        }
+        total += rank;
+        worst = rank > worst ? rank : worst;
+    }
+    ok = ok && (double)total / (double)n < 4.0 * (double)m && worst < n / 10;
+    bignum_mq_free(&q);
+    free(gone);
+    return ok;
+}
+
+#define PRODUCERS 4
+#define PER_PRODUCER 20000
+
+typedef struct {
+    bignum_mq_t   *q;
+    unsigned       id;
+    atomic_int    *seen;
+    atomic_size_t *popped;
+    atomic_int    *failed;
+} mq_thread_t;
+
+static void *producer(void *arg)
+{
+    mq_thread_t *t = arg;
+    for (uint64_t i = 0; i < PER_PRODUCER; ++i) {
+        bignum_t x;
+        make_key(&x, t->id * PER_PRODUCER + i, i % 3);
+        if (bignum_mq_push(t->q, &x) != BIGNUM_MQ_OK) {
+            atomic_store(t->failed, 1);
+        }
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg)
+{
+    mq_thread_t *t = arg;
+    while (atomic_load(t->popped) < PRODUCERS * PER_PRODUCER && !atomic_load(t->failed)) {
+        bignum_t out;
+        if (bignum_mq_pop(t->q, &out) != BIGNUM_MQ_OK) {
+            continue;
+        }
+        uint64_t id = out.words[0];
+        if (id >= PRODUCERS * PER_PRODUCER || atomic_fetch_add(&t->seen[id], 1) != 0) {
+            atomic_store(t->failed, 1);
+        }
+        atomic_fetch_add(t->popped, 1);
+    }
+    return NULL;
+}
+
+/** @brief Тест: одновременные вставки и извлечения ничего не теряют и не дублируют. */
+int test_concurrent_no_loss() {
+    bignum_mq_t q;
+    atomic_int *seen = calloc(PRODUCERS * PER_PRODUCER, sizeof(atomic_int));
+    atomic_size_t popped = 0;
+    atomic_int failed = 0;
+    pthread_t tids[2 * PRODUCERS];
+    mq_thread_t args[2 * PRODUCERS];
+    int ok = seen != NULL && bignum_mq_init(&q, 8, PRODUCERS * PER_PRODUCER, BIGNUM_MQ_MAX) == BIGNUM_MQ_OK;
+    for (unsigned i = 0; ok && i < 2 * PRODUCERS; ++i) {
+        args[i] = (mq_thread_t){ &q, i % PRODUCERS, seen, &popped, &failed };
+        ok = pthread_create(&tids[i], NULL, (i < PRODUCERS) ? producer : consumer, &args[i]) == 0;
+    }
+    for (unsigned i = 0; ok && i < 2 * PRODUCERS; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    ok = ok && !atomic_load(&failed) && atomic_load(&popped) == PRODUCERS * PER_PRODUCER
+            && bignum_mq_size(&q) == 0;
+    for (size_t i = 0; ok && i < PRODUCERS * PER_PRODUCER; ++i) {
+        ok = atomic_load(&seen[i]) == 1;
+    }
+    bignum_mq_free(&q);
+    free(seen);
+    return ok;
+}
+
+/** @brief Тест: заполнение, пустая очередь и ошибки. */
+int test_full_empty_errors() {
+    bignum_mq_t q;
+    bignum_t x, out;
+    make_key(&x, 1, 0);
+    int ok = bignum_mq_init(&q, 4, 10, BIGNUM_MQ_MIN) == BIGNUM_MQ_OK && q.queue_cap == 3;
+    for (int i = 0; ok && i < 12; ++i) {
+        ok = bignum_mq_push(&q, &x) == BIGNUM_MQ_OK;    /* 4 кучи по 3 */
+    }
+    ok = ok && bignum_mq_push(&q, &x) == BIGNUM_MQ_FULL && bignum_mq_size(&q) == 12;
+    for (int i = 0; ok && i < 12; ++i) {
+        ok = bignum_mq_pop(&q, &out) == BIGNUM_MQ_OK && bignum_cmp(&out, &x) == 0;
+    }
+    ok = ok && bignum_mq_pop(&q, &out) == BIGNUM_MQ_EMPTY;
+    x.len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_mq_push(&q, &x) == BIGNUM_MQ_ERROR_RANGE
+            && bignum_mq_push(&q, NULL) == BIGNUM_MQ_ERROR_NULL
+            && bignum_mq_pop(&q, NULL) == BIGNUM_MQ_ERROR_NULL;
+    bignum_mq_free(&q);
+    bignum_mq_free(NULL);
+    ok = ok && bignum_mq_push(&q, &out) == BIGNUM_MQ_ERROR_NULL
+            && bignum_mq_init(&q, 2, 0, BIGNUM_MQ_MIN) == BIGNUM_MQ_ERROR_RANGE
+            && bignum_mq_init(NULL, 2, 4, BIGNUM_MQ_MIN) == BIGNUM_MQ_ERROR_NULL
+            && bignum_mq_init(&q, 0, 100, BIGNUM_MQ_MAX) == BIGNUM_MQ_OK && q.nqueues >= 2;
+    bignum_mq_free(&q);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_mq ---\n");
+    srand(41);
+
+    RUN_TEST(test_single_queue_exact);
+    RUN_TEST(test_rank_error_bounded);
+    RUN_TEST(test_concurrent_no_loss);
+    RUN_TEST(test_full_empty_errors);
+
+    printf("--- All bignum_mq tests passed ---\n");
+    return 0;
+}
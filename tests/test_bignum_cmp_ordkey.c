@@ -0,0 +1,195 @@
+/**
+ * @file    test_bignum_cmp_ordkey.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты байтовых ключей bignum_to_ordkey / bignum_from_ordkey.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Формат:** `test_ordkey_layout` — префикс длины и big-endian слова.
+ * 2.  **Свойство порядка:** `test_ordkey_order_property` — для случайных пар
+ *     (включая общие префиксы, равные и разные `len`) знак лексикографического
+ *     сравнения ключей совпадает со знаком `bignum_cmp`.
+ * 3.  **Обратимость:** `test_ordkey_roundtrip`, включая `len = 0` и `len = BIGNUM_CAPACITY`.
+ * 4.  **Пакетный кодировщик:** `test_ordkey_batch_matches_single` — побайтно
+ *     совпадает с поштучным кодированием (проверяет SIMD-путь на всех длинах).
+ * 5.  **Робастность:** `test_ordkey_errors` — NULL, малый буфер, усечённый ключ.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_ordkey.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+#define PROPERTY_ITERATIONS 20000
+
+static int sign(int x) { return (x > 0) - (x < 0); }
+
+/** Лексикографическое сравнение байтовых строк — так, как это делает хранилище. */
+static int bytes_cmp(const uint8_t *a, size_t na, const uint8_t *b, size_t nb)
+{
+    int r = memcmp(a, b, na < nb ? na : nb);
+    if (r != 0) return sign(r);
+    return (na > nb) - (na < nb);
+}
+
+static uint64_t rand64(void)
+{
+    return ((uint64_t)rand() << 62) ^ ((uint64_t)rand() << 31) ^ (uint64_t)rand();
+}
+
+/** Случайное нормализованное число; слова берутся из маленького алфавита, чтобы чаще совпадали. */
+static void random_bignum(bignum_t *x, size_t len)
+{
+    static const uint64_t alphabet[] = {0, 1, 0xFF, 0x100, 0x8000000000000000ULL, UINT64_MAX};
+    uint64_t d[BIGNUM_CAPACITY] = {0};
+    for (size_t i = 0; i < len; ++i) {
+        d[i] = (rand() % 2) ? alphabet[rand() % 6] : rand64();
+    }
+    if (len > 0 && d[len - 1] == 0) d[len - 1] = 1;
+    bignum_init_from_array(x, d, len);
+}
+
+/** @brief Тест: раскладка ключа. */
+int test_ordkey_layout() {
+    bignum_t a;
+    uint64_t d[] = {0x0102030405060708ULL, 0x1112131415161718ULL};
+    bignum_init_from_array(&a, d, 2);
+
+    uint8_t key[BIGNUM_ORDKEY_MAX_SIZE];
+    size_t n = 0;
+    if (bignum_to_ordkey(&a, key, sizeof(key), &n) != BIGNUM_ORDKEY_OK) return 0;
+    if (n != BIGNUM_ORDKEY_PREFIX_SIZE + 16 || n != bignum_ordkey_size(&a)) return 0;
+
+    const uint8_t *p = key + BIGNUM_ORDKEY_PREFIX_SIZE;
+    if (key[BIGNUM_ORDKEY_PREFIX_SIZE - 1] != 2) return 0;
+    if (p[0] != 0x11 || p[7] != 0x18 || p[8] != 0x01 || p[15] != 0x08) return 0;
+    return 1;
+}
+
+/** @brief Тест: порядок ключей совпадает с порядком bignum_cmp. */
+int test_ordkey_order_property() {
+    srand(2026);
+    uint8_t ka[BIGNUM_ORDKEY_MAX_SIZE], kb[BIGNUM_ORDKEY_MAX_SIZE];
+
+    for (int iter = 0; iter < PROPERTY_ITERATIONS; ++iter) {
+        bignum_t a, b;
+        size_t len_a = (size_t)(rand() % (BIGNUM_CAPACITY + 1));
+        random_bignum(&a, len_a);
+        if (iter % 3 == 0) {
+            /* Общий старший префикс, различие глубже. */
+            b = a;
+            if (b.len > 0) {
+                size_t depth = (size_t)rand() % b.len;
+                b.words[depth] = rand64();
+                if (b.words[b.len - 1] == 0) b.words[b.len - 1] = 1;
+            }
+        } else {
+            random_bignum(&b, (iter % 2) ? len_a : (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        }
+
+        size_t na = 0, nb = 0;
+        bignum_to_ordkey(&a, ka, sizeof(ka), &na);
+        bignum_to_ordkey(&b, kb, sizeof(kb), &nb);
+
+        int expected = bignum_cmp(&a, &b);
+        if (bytes_cmp(ka, na, kb, nb) != expected) {
+            printf("\n  mismatch: iter=%d len_a=%zu len_b=%zu expected=%d\n",
+                   iter, a.len, b.len, expected);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/** @brief Тест: decode(encode(x)) == x. */
+int test_ordkey_roundtrip() {
+    srand(7);
+    uint8_t key[BIGNUM_ORDKEY_MAX_SIZE];
+    for (size_t len = 0; len <= BIGNUM_CAPACITY; ++len) {
+        bignum_t a, b;
+        random_bignum(&a, len);
+        memset(&b, 0xA5, sizeof(b));
+
+        size_t n = 0, used = 0;
+        if (bignum_to_ordkey(&a, key, sizeof(key), &n) != BIGNUM_ORDKEY_OK) return 0;
+        if (bignum_from_ordkey(&b, key, n, &used) != BIGNUM_ORDKEY_OK) return 0;
+        if (used != n) return 0;
+        if (memcmp(&a, &b, sizeof(a)) != 0) return 0;
+    }
+    return 1;
+}
+
+/** @brief Тест: пакетное кодирование побайтно совпадает с поштучным. */
+int test_ordkey_batch_matches_single() {
+    enum { N = BIGNUM_CAPACITY + 1 };
+    srand(99);
+    bignum_t src[N];
+    for (size_t i = 0; i < N; ++i) {
+        random_bignum(&src[i], i);
+    }
+
+    static uint8_t buf[N * BIGNUM_ORDKEY_MAX_SIZE];
+    size_t offsets[N + 1];
+    if (bignum_to_ordkey_batch(src, N, buf, sizeof(buf), offsets) != BIGNUM_ORDKEY_OK) return 0;
+
+    uint8_t key[BIGNUM_ORDKEY_MAX_SIZE];
+    for (size_t i = 0; i < N; ++i) {
+        size_t n = 0;
+        bignum_to_ordkey(&src[i], key, sizeof(key), &n);
+        if (offsets[i + 1] - offsets[i] != n) return 0;
+        if (memcmp(buf + offsets[i], key, n) != 0) return 0;
+    }
+    return 1;
+}
+
+/** @brief Тест: ошибки аргументов и формата. */
+int test_ordkey_errors() {
+    bignum_t a;
+    uint64_t d[] = {1, 2, 3};
+    bignum_init_from_array(&a, d, 3);
+    uint8_t key[BIGNUM_ORDKEY_MAX_SIZE];
+    size_t n = 0, off[2];
+
+    if (bignum_to_ordkey(NULL, key, sizeof(key), &n) != BIGNUM_ORDKEY_ERROR_NULL) return 0;
+    if (bignum_to_ordkey(&a, NULL, sizeof(key), &n) != BIGNUM_ORDKEY_ERROR_NULL) return 0;
+    if (bignum_to_ordkey(&a, key, 10, &n) != BIGNUM_ORDKEY_ERROR_BUFFER) return 0;
+    if (bignum_to_ordkey_batch(&a, 1, key, 10, off) != BIGNUM_ORDKEY_ERROR_BUFFER) return 0;
+
+    if (bignum_to_ordkey(&a, key, sizeof(key), &n) != BIGNUM_ORDKEY_OK) return 0;
+    if (bignum_from_ordkey(&a, key, n - 1, NULL) != BIGNUM_ORDKEY_ERROR_FORMAT) return 0;
+    if (bignum_from_ordkey(&a, key, 0, NULL) != BIGNUM_ORDKEY_ERROR_FORMAT) return 0;
+
+    memset(key, 0xFF, sizeof(key));   /* len = 255 > BIGNUM_CAPACITY */
+    if (bignum_from_ordkey(&a, key, sizeof(key), NULL) != BIGNUM_ORDKEY_ERROR_FORMAT) return 0;
+    return bignum_from_ordkey(NULL, key, sizeof(key), NULL) == BIGNUM_ORDKEY_ERROR_NULL;
+}
+
+int main() {
+    printf("\n--- Running Tests for bignum_cmp_ordkey ---\n");
+
+    RUN_TEST(test_ordkey_layout);
+    RUN_TEST(test_ordkey_order_property);
+    RUN_TEST(test_ordkey_roundtrip);
+    RUN_TEST(test_ordkey_batch_matches_single);
+    RUN_TEST(test_ordkey_errors);
+
+    printf("--- All ordkey tests passed ---\n");
+    return 0;
+}
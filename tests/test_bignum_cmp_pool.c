@@ -0,0 +1,209 @@
+/**
+ * @file    test_bignum_cmp_pool.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты пула потоков и bignum_parallel_for.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Покрытие индексов:** `test_each_index_once` — каждый индекс `[0, n)`
+ *     обработан ровно один раз при `n`, не кратном `grain`, при `n <= grain`
+ *     (без пула), `n = 0` и мелком `grain = 1`; пул из 4 потоков.
+ * 2.  **Кража работы:** `test_imbalanced_chunks` — тяжёлые куски собраны в
+ *     начале диапазона (очередь участника 0); результат корректен, сумма
+ *     совпадает с последовательной.
+ * 3.  **Вложенность и конкурентные вызовы:** `test_nested_and_concurrent` —
+ *     `bignum_parallel_for` изнутри тела цикла выполняется на месте; 4 потока
+ *     вызывают пул одновременно и получают свои результаты.
+ * 4.  **Настройка и ошибки:** `test_config_and_errors` — `bignum_pool_set_threads`,
+ *     пул из одного потока, перезапуск после `bignum_pool_shutdown`,
+ *     `fn == NULL`.
+ *
+ * @note Для сборки этого теста требуется флаг `-pthread`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_pool.h"
+#include <bignum_common.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static void mark(size_t begin, size_t end, void *arg)
+{
+    unsigned char *seen = arg;
+    for (size_t i = begin; i < end; ++i) {
+        seen[i]++;
+    }
+}
+
+static int each_once(size_t n, size_t grain)
+{
+    unsigned char *seen = calloc(n + 1, 1);
+    int ok = seen != NULL && bignum_parallel_for(n, grain, mark, seen) == BIGNUM_POOL_OK;
+    for (size_t i = 0; ok && i < n; ++i) {
+        ok = seen[i] == 1;
+    }
+    ok = ok && seen[n] == 0;
+    free(seen);
+    return ok;
+}
+
+/** @brief Тест: каждый индекс ровно один раз. */
+int test_each_index_once() {
+    int ok = bignum_pool_set_threads(4) == BIGNUM_POOL_OK && bignum_pool_threads() == 4;
+    ok = ok && each_once(100003, 100) && each_once(5000, 1) && each_once(50, 64)
+            && each_once(0, 16) && each_once(64, 0) && each_once(7, 1);
+    return ok;
+}
+
+typedef struct {
+    const bignum_t *a, *b;
+    int            *out;
+} cmp_args_t;
+
+/** Куски с индексами < n/8 в 64 раза тяжелее остальных. */
+static void heavy_cmp(size_t begin, size_t end, void *arg)
+{
+    cmp_args_t *c = arg;
+    for (size_t i = begin; i < end; ++i) {
+        int r = 0;
+        for (int rep = 0; rep < (i < 1000 ? 64 : 1); ++rep) {
+            r += bignum_cmp(&c->a[i], &c->b[i]);
+        }
+        c->out[i] = r;
+    }
+}
+
+/** @brief Тест: несбалансированные куски. */
+int test_imbalanced_chunks() {
+    const size_t n = 8000;
+    bignum_t *a = malloc(sizeof(bignum_t) * n), *b = malloc(sizeof(bignum_t) * n);
+    int *out = malloc(sizeof(int) * n);
+    int ok = a != NULL && b != NULL && out != NULL;
+    for (size_t i = 0; ok && i < n; ++i) {
+        bignum_init_u64(&a[i], (uint64_t)rand());
+        bignum_init_u64(&b[i], (uint64_t)rand());
+    }
+    cmp_args_t args = { a, b, out };
+    ok = ok && bignum_parallel_for(n, 16, heavy_cmp, &args) == BIGNUM_POOL_OK;
+    for (size_t i = 0; ok && i < n; ++i) {
+        int expect = bignum_cmp(&a[i], &b[i]) * (i < 1000 ? 64 : 1);
+        ok = out[i] == expect;
+    }
+    free(a);
+    free(b);
+    free(out);
+    return ok;
+}
+
+typedef struct {
+    _Atomic uint64_t sum;
+    size_t           inner;
+} nested_args_t;
+
+static void inner_sum(size_t begin, size_t end, void *arg)
+{
+    nested_args_t *na = arg;
+    uint64_t s = 0;
+    for (size_t i = begin; i < end; ++i) {
+        s += i;
+    }
+    atomic_fetch_add(&na->sum, s);
+}
+
+static void outer(size_t begin, size_t end, void *arg)
+{
+    nested_args_t *na = arg;
+    for (size_t i = begin; i < end; ++i) {
+        bignum_parallel_for(na->inner, 8, inner_sum, na);   /* на месте */
+    }
+}
+
+static void *caller(void *arg)
+{
+    nested_args_t *na = arg;
+    bignum_parallel_for(200, 4, outer, na);
+    return NULL;
+}
+
+/** @brief Тест: вложенные и одновременные вызовы. */
+int test_nested_and_concurrent() {
+    nested_args_t args[4];
+    pthread_t     tids[4];
+    for (int t = 0; t < 4; ++t) {
+        atomic_init(&args[t].sum, 0);
+        args[t].inner = 100 + (size_t)t;
+        if (pthread_create(&tids[t], NULL, caller, &args[t]) != 0) {
+            return 0;
+        }
+    }
+    int ok = 1;
+    for (int t = 0; t < 4; ++t) {
+        pthread_join(tids[t], NULL);
+        uint64_t m = args[t].inner;
+        ok = ok && atomic_load(&args[t].sum) == 200 * (m * (m - 1) / 2);
+    }
+    return ok;
+}
+
+/** @brief Тест: настройка размера и ошибки. */
+int test_config_and_errors() {
+    int ok = bignum_parallel_for(10, 1, NULL, NULL) == BIGNUM_POOL_ERROR_NULL;
+    ok = ok && bignum_pool_set_threads(1) == BIGNUM_POOL_OK && bignum_pool_threads() == 1
+            && each_once(1000, 10);
+    ok = ok && bignum_pool_set_threads(3) == BIGNUM_POOL_OK && each_once(1000, 10)
+            && bignum_pool_threads() == 3;
+    bignum_pool_shutdown();
+    bignum_pool_shutdown();
+    ok = ok && each_once(1000, 10) && bignum_pool_threads() == 3;
+    ok = ok && bignum_pool_set_threads(0) == BIGNUM_POOL_OK && bignum_pool_threads() >= 1;
+    bignum_pool_shutdown();
+    return ok;
+}
+
+/** @brief Тест: общая политика числа частей `*_mt`. */
+int test_parts_policy() {
+    int ok = bignum_pool_set_threads(3) == BIGNUM_POOL_OK;
+    ok = ok && bignum_pool_parts(0, 1000000, 1000) == 3;       /* 0 — размер пула */
+    ok = ok && bignum_pool_parts(8, 1000000, 1000) == 8;
+    ok = ok && bignum_pool_parts(1000, 1u << 30, 1) == 256;    /* предел пула */
+    ok = ok && bignum_pool_parts(8, 2500, 1000) == 2;          /* >= min_chunk на часть */
+    ok = ok && bignum_pool_parts(8, 65537, 65536) == 1;
+    ok = ok && bignum_pool_parts(8, 999, 1000) == 1;
+    ok = ok && bignum_pool_parts(8, 0, 1000) == 1;
+    ok = ok && bignum_pool_parts(8, 5, 0) == 5;                /* min_chunk 0 — как 1, не больше n */
+    bignum_pool_set_threads(0);
+    bignum_pool_shutdown();
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_pool ---\n");
+    srand(44);
+
+    RUN_TEST(test_each_index_once);
+    RUN_TEST(test_imbalanced_chunks);
+    RUN_TEST(test_nested_and_concurrent);
+    RUN_TEST(test_config_and_errors);
+    RUN_TEST(test_parts_policy);
+
+    printf("--- All bignum_pool tests passed ---\n");
+    return 0;
+}
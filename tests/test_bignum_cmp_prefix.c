@@ -0,0 +1,201 @@
+/**
+ * @file    test_bignum_cmp_prefix.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты префиксных ключей и bignum_cmp_cached.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Согласованность с bignum_cmp:** `test_random_pairs` — случайные пары
+ *     разных и равных длин, с общим старшим словом и различием только в
+ *     младших битах старшего слова: различные ключи упорядочены как числа,
+ *     `bignum_cmp_cached` совпадает с `bignum_cmp`.
+ * 2.  **Граничные случаи:** `test_edges` — `len = 0`, `len = BIGNUM_CAPACITY`,
+ *     старшее слово `1` против `UINT64_MAX` при соседних длинах, различие в
+ *     отброшенных младших битах (равные ключи), `len > BIGNUM_CAPACITY`.
+ * 3.  **Массивы:** `test_arrays` — `bignum_prefix_keys`, `bignum_prefixed_init`,
+ *     сортировка `bignum_prefixed_t` через `bignum_cmp_prefixed`, `NULL`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_prefix.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static uint64_t rand64(void)
+{
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+static void random_bignum(bignum_t *x, size_t len)
+{
+    uint64_t w[BIGNUM_CAPACITY];
+    for (size_t i = 0; i < len; ++i) {
+        w[i] = rand64();
+    }
+    if (len > 0 && w[len - 1] == 0) {
+        w[len - 1] = 1;
+    }
+    bignum_init_from_array(x, w, len);
+}
+
+static int sign(int v)
+{
+    return (v > 0) - (v < 0);
+}
+
+/** Ключи согласованы с числами, `bignum_cmp_cached` — с `bignum_cmp`. */
+static int consistent(const bignum_t *a, const bignum_t *b)
+{
+    uint64_t ka = bignum_prefix_key(a), kb = bignum_prefix_key(b);
+    int expect = bignum_cmp(a, b);
+    if (ka != kb && sign(ka > kb ? 1 : -1) != expect) {
+        return 0;
+    }
+    return bignum_cmp_cached(ka, a, kb, b) == expect;
+}
+
+/** @brief Тест: случайные пары. */
+int test_random_pairs() {
+    bignum_t a, b;
+    int ok = 1;
+    for (int iter = 0; ok && iter < 20000; ++iter) {
+        size_t la = (size_t)(rand() % (BIGNUM_CAPACITY + 1));
+        size_t lb = (iter % 2) ? la : (size_t)(rand() % (BIGNUM_CAPACITY + 1));
+        random_bignum(&a, la);
+        random_bignum(&b, lb);
+        switch (iter % 5) {
+        case 2:                                 /* общее старшее слово */
+            if (la == lb && la > 0) {
+                b.words[la - 1] = a.words[la - 1];
+            }
+            break;
+        case 3:                                 /* различие только в младших битах старшего слова */
+            if (la == lb && la > 0) {
+                b = a;
+                b.words[la - 1] ^= (uint64_t)(rand() % (1 << BIGNUM_PREFIX_LEN_BITS));
+                b.words[la - 1] |= (b.words[la - 1] == 0);
+            }
+            break;
+        case 4:                                 /* маленькое старшее слово */
+            if (la > 0) {
+                a.words[la - 1] = (uint64_t)(rand() % 100) + 1;
+            }
+            break;
+        default:
+            break;
+        }
+        ok = consistent(&a, &b) && consistent(&b, &a) && consistent(&a, &a);
+    }
+    return ok;
+}
+
+/** @brief Тест: граничные случаи. */
+int test_edges() {
+    bignum_t zero, one, big, full, x, y;
+    uint64_t w[BIGNUM_CAPACITY];
+    bignum_init_u64(&zero, 0);
+    bignum_init_u64(&one, 1);
+    bignum_init_u64(&big, UINT64_MAX);
+    for (size_t i = 0; i < BIGNUM_CAPACITY; ++i) {
+        w[i] = UINT64_MAX;
+    }
+    bignum_init_from_array(&full, w, BIGNUM_CAPACITY);
+    int ok = bignum_prefix_key(&zero) == 0 && bignum_prefix_key(&one) > 0
+          && bignum_prefix_key(&one) < bignum_prefix_key(&big);
+    ok = ok && consistent(&zero, &one) && consistent(&one, &big) && consistent(&big, &full);
+
+    /* Соседние длины: {1, 1} (len 2, старшее 1) больше UINT64_MAX (len 1). */
+    uint64_t w2[2] = { 0, 1 };
+    bignum_init_from_array(&x, w2, 2);
+    ok = ok && bignum_prefix_key(&x) > bignum_prefix_key(&big) && consistent(&x, &big);
+
+    /* Различие только в отброшенных младших битах: ключи равны, решает bignum_cmp. */
+    uint64_t w3[2] = { 5, 0x8000000000000000ull };
+    bignum_init_from_array(&x, w3, 2);
+    y = x;
+    y.words[1] |= 1;
+    ok = ok && bignum_prefix_key(&x) == bignum_prefix_key(&y)
+            && bignum_cmp_cached(bignum_prefix_key(&x), &x, bignum_prefix_key(&y), &y) == BIGNUM_CMP_LESS
+            && bignum_cmp_cached(bignum_prefix_key(&y), &y, bignum_prefix_key(&x), &x) == BIGNUM_CMP_GREATER;
+
+    /* Поле len не переполняется: len = BIGNUM_CAPACITY влезает, больше — насыщение. */
+    ok = ok && (bignum_prefix_key(&full) >> (64 - BIGNUM_PREFIX_LEN_BITS)) == BIGNUM_CAPACITY;
+    x = full;
+    x.len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_prefix_key(&x) == UINT64_MAX;
+
+    /* Различные ключи решают без обращения к числам. */
+    ok = ok && bignum_cmp_cached(1, NULL, 2, NULL) == BIGNUM_CMP_LESS
+            && bignum_cmp_cached(3, NULL, 2, NULL) == BIGNUM_CMP_GREATER
+            && bignum_cmp_cached(2, NULL, 2, NULL) == BIGNUM_CMP_ERROR_NULL;
+    return ok;
+}
+
+static int cmp_prefixed_qsort(const void *p, const void *q)
+{
+    return bignum_cmp_prefixed(p, q);
+}
+
+/** @brief Тест: массивы. */
+int test_arrays() {
+    const size_t n = 3000;
+    bignum_t *xs = malloc(sizeof(bignum_t) * n);
+    uint64_t *keys = malloc(sizeof(uint64_t) * n);
+    bignum_prefixed_t *v = malloc(sizeof(bignum_prefixed_t) * n);
+    int ok = xs != NULL && keys != NULL && v != NULL;
+    for (size_t i = 0; ok && i < n; ++i) {
+        random_bignum(&xs[i], (size_t)(rand() % 4));
+        if (i % 3 == 0 && i > 0) {
+            xs[i] = xs[i - 1];                  /* дубликаты */
+        }
+    }
+    ok = ok && bignum_prefix_keys(xs, n, keys) == BIGNUM_PREFIX_OK
+            && bignum_prefixed_init(xs, n, v) == BIGNUM_PREFIX_OK;
+    for (size_t i = 0; ok && i < n; ++i) {
+        ok = keys[i] == bignum_prefix_key(&xs[i]) && v[i].key == keys[i] && v[i].num == &xs[i];
+    }
+    if (ok) {
+        qsort(v, n, sizeof(*v), cmp_prefixed_qsort);
+    }
+    for (size_t i = 1; ok && i < n; ++i) {
+        ok = bignum_cmp(v[i - 1].num, v[i].num) <= 0 && v[i - 1].key <= v[i].key;
+    }
+    ok = ok && bignum_prefix_keys(NULL, 1, keys) == BIGNUM_PREFIX_ERROR_NULL
+            && bignum_prefix_keys(xs, 1, NULL) == BIGNUM_PREFIX_ERROR_NULL
+            && bignum_prefixed_init(NULL, 1, v) == BIGNUM_PREFIX_ERROR_NULL
+            && bignum_prefix_keys(NULL, 0, NULL) == BIGNUM_PREFIX_OK
+            && bignum_prefixed_init(NULL, 0, NULL) == BIGNUM_PREFIX_OK;
+    free(xs);
+    free(keys);
+    free(v);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_prefix ---\n");
+    srand(47);
+
+    RUN_TEST(test_random_pairs);
+    RUN_TEST(test_edges);
+    RUN_TEST(test_arrays);
+
+    printf("--- All bignum_prefix tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file    test_bignum_cmp_runs.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты bignum_is_sorted и bignum_sorted_runs (одно- и многопоточных).
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Отсортированный массив:** `test_sorted_array` — с сериями равных ключей
+ *     и ключами, отличающимися только младшими словами (путь `bignum_cmp`);
+ *     длины массива вокруг границы блока из 8 пар.
+ * 2.  **Нарушения:** `test_runs_match_reference` — случайные массивы из
+ *     отсортированных кусков: `until` и границы серий совпадают с наивной
+ *     проверкой `bignum_cmp` на каждой паре; неполный буфер `starts`.
+ * 3.  **Потоки:** `test_mt_matches_st` — `*_mt` при 1, 2, 3, 7 и 0 потоках
+ *     дают те же ответы, в том числе когда нарушение стоит на стыке отрезков.
+ * 4.  **Ошибки:** `test_runs_errors` — `len > BIGNUM_CAPACITY`, `NULL`,
+ *     пустой и одноэлементный массивы.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_runs.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+/** Случайный ключ длины 1..3 с общим старшим словом у многих ключей. */
+static void rand_key(bignum_t *x)
+{
+    uint64_t w[3] = { (uint64_t)rand(), (uint64_t)rand(), (uint64_t)(rand() % 3) + 1 };
+    bignum_init_from_array(x, w, (size_t)(rand() % 3) + 1);
+    for (size_t k = x->len; k < BIGNUM_CAPACITY; ++k) {
+        x->words[k] = (uint64_t)rand();   /* мусор за len */
+    }
+}
+
+/** Массив из кусков-серий случайной длины. */
+static void fill_runs(bignum_t *a, size_t n, size_t max_run)
+{
+    size_t i = 0;
+    while (i < n) {
+        size_t len = (size_t)(rand() % (int)max_run) + 1;
+        if (len > n - i) {
+            len = n - i;
+        }
+        for (size_t k = 0; k < len; ++k) {
+            rand_key(&a[i + k]);
+            if (k > 0 && rand() % 4 == 0) {
+                a[i + k] = a[i + k - 1];   /* равные соседи */
+            }
+        }
+        qsort(&a[i], len, sizeof(bignum_t), cmp_qsort);
+        i += len;
+    }
+}
+
+/** Эталон: начала серий наивной проверкой. */
+static size_t ref_runs(const bignum_t *a, size_t n, size_t *starts)
+{
+    size_t c = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (i == 0 || bignum_cmp(&a[i - 1], &a[i]) > 0) {
+            starts[c++] = i;
+        }
+    }
+    return c;
+}
+
+/** @brief Тест: отсортированные массивы разных длин. */
+int test_sorted_array() {
+    bignum_t *a = malloc(sizeof(bignum_t) * 2000);
+    int ok = a != NULL;
+    for (size_t n = 0; ok && n < 40; ++n) {
+        fill_runs(a, n, 40);
+        qsort(a, n, sizeof(bignum_t), cmp_qsort);
+        size_t until = 12345, count = 0, s[2];
+        ok = bignum_is_sorted(a, n, &until) == 1 && until == n
+          && bignum_sorted_runs(a, n, s, 2, &count) == BIGNUM_RUNS_OK
+          && count == (n > 0) && (n == 0 || s[0] == 0);
+    }
+    if (ok) {
+        fill_runs(a, 2000, 2000);
+        qsort(a, 2000, sizeof(bignum_t), cmp_qsort);
+        ok = bignum_is_sorted(a, 2000, NULL) == 1;
+    }
+    free(a);
+    return ok;
+}
+
+/** @brief Тест: границы серий совпадают с эталоном. */
+int test_runs_match_reference() {
+    const size_t n = 5000;
+    bignum_t *a   = malloc(sizeof(bignum_t) * n);
+    size_t   *ref = malloc(sizeof(size_t) * n);
+    size_t   *got = malloc(sizeof(size_t) * n);
+    int ok = a && ref && got;
+    for (int round = 0; ok && round < 50; ++round) {
+        fill_runs(a, n, (size_t)(rand() % 300) + 1);
+        size_t rc = ref_runs(a, n, ref), count = 0, until = 0;
+        ok = bignum_sorted_runs(a, n, got, n, &count) == BIGNUM_RUNS_OK && count == rc
+          && memcmp(got, ref, rc * sizeof(size_t)) == 0
+          && bignum_is_sorted(a, n, &until) == (rc == 1) && until == (rc > 1 ? ref[1] : n);
+        /* Неполный буфер: записаны первые cap, count — полное число. */
+        size_t cap = rc / 2;
+        ok = ok && bignum_sorted_runs(a, n, got, cap, &count) == BIGNUM_RUNS_OK && count == rc
+          && memcmp(got, ref, cap * sizeof(size_t)) == 0;
+    }
+    free(a);
+    free(ref);
+    free(got);
+    return ok;
+}
+
+/** @brief Тест: многопоточные варианты совпадают с однопоточными. */
+int test_mt_matches_st() {
+    const size_t n = 400000;
+    bignum_t *a   = malloc(sizeof(bignum_t) * n);
+    size_t   *ref = malloc(sizeof(size_t) * n);
+    size_t   *got = malloc(sizeof(size_t) * n);
+    static const unsigned threads[] = { 1, 2, 3, 7, 0 };
+    int ok = a && ref && got;
+    if (ok) {
+        fill_runs(a, n, n);
+        qsort(a, n, sizeof(bignum_t), cmp_qsort);
+    }
+    for (int round = 0; ok && round < 4; ++round) {
+        if (round == 1) {
+            memset(&a[n / 2], 0, sizeof(bignum_t));   /* нуль на стыке двух отрезков */
+        } else if (round == 2) {
+            fill_runs(a, n, 5000);
+        } else if (round == 3) {
+            fill_runs(a, n, 3);
+        }
+        size_t rc = ref_runs(a, n, ref);
+        for (size_t t = 0; ok && t < sizeof(threads) / sizeof(threads[0]); ++t) {
+            size_t count = 0, until = 0;
+            ok = bignum_sorted_runs_mt(a, n, threads[t], got, n, &count) == BIGNUM_RUNS_OK
+              && count == rc && memcmp(got, ref, rc * sizeof(size_t)) == 0
+              && bignum_is_sorted_mt(a, n, threads[t], &until) == (rc == 1)
+              && until == (rc > 1 ? ref[1] : n);
+        }
+    }
+    free(a);
+    free(ref);
+    free(got);
+    return ok;
+}
+
+/** @brief Тест: ошибки и вырожденные массивы. */
+int test_runs_errors() {
+    bignum_t a[20];
+    size_t count = 9, until = 9, s[4];
+    for (size_t i = 0; i < 20; ++i) {
+        bignum_init_u64(&a[i], i);
+    }
+    int ok = bignum_is_sorted(a, 1, &until) == 1 && until == 1
+          && bignum_is_sorted(NULL, 0, &until) == 1 && until == 0
+          && bignum_sorted_runs(NULL, 0, NULL, 0, &count) == BIGNUM_RUNS_OK && count == 0
+          && bignum_sorted_runs(a, 20, NULL, 0, &count) == BIGNUM_RUNS_OK && count == 1
+          && bignum_is_sorted(NULL, 3, NULL) == BIGNUM_RUNS_ERROR_NULL
+          && bignum_sorted_runs(a, 3, s, 4, NULL) == BIGNUM_RUNS_ERROR_NULL
+          && bignum_sorted_runs(a, 3, NULL, 4, &count) == BIGNUM_RUNS_ERROR_NULL;
+    a[13].len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_is_sorted(a, 20, NULL) == BIGNUM_RUNS_ERROR_RANGE
+            && bignum_sorted_runs(a, 20, s, 4, &count) == BIGNUM_RUNS_ERROR_RANGE;
+    a[13].len = 1;
+    a[0].len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_is_sorted(a, 20, NULL) == BIGNUM_RUNS_ERROR_RANGE;
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum runs ---\n");
+    srand(38);
+
+    RUN_TEST(test_sorted_array);
+    RUN_TEST(test_runs_match_reference);
+    RUN_TEST(test_mt_matches_st);
+    RUN_TEST(test_runs_errors);
+
+    printf("--- All bignum runs tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file    test_bignum_cmp_search.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты пакетного двоичного поиска (bignum_lower/upper_bound_batch).
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Эквивалентность поштучному поиску:** `test_batch_matches_reference` —
+ *     размеры массива 0, 1, 2, 17, 1000 и пакеты меньше, равные и больше числа
+ *     дорожек (1, 16, 17, 3000); ключи массива и случайные значения.
+ * 2.  **Дубликаты:** `test_batch_duplicates` — lower/upper_bound дают границы
+ *     групп равных ключей.
+ * 3.  **Крайние запросы:** `test_batch_extremes` — меньше всех, больше всех,
+ *     `len > BIGNUM_CAPACITY`, повторяющийся запрос в пакете.
+ * 4.  **Робастность:** `test_batch_errors` — `NULL`-аргументы, пустой пакет.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_search.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static uint64_t rnd64(void)
+{
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+static void make_key(bignum_t *x, size_t len)
+{
+    uint64_t w[BIGNUM_CAPACITY];
+    for (size_t i = 0; i < len; ++i) {
+        w[i] = rnd64();
+    }
+    if (len > 0) {
+        w[len - 1] = w[len - 1] % 8 + 1;     /* частые совпадения старшего слова */
+    }
+    bignum_init_from_array(x, w, len);
+}
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+static size_t ref_bound(const bignum_t *keys, size_t n, const bignum_t *x, int upper)
+{
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int c = bignum_cmp(&keys[mid], x);
+        if (c < 0 || (upper && c == 0)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/** Проверяет оба пакетных поиска на `m` запросах против поштучного. */
+static int check_batch(const bignum_t *keys, size_t n, const bignum_t *xs, size_t m)
+{
+    size_t *lb = malloc((m + 1) * sizeof(size_t)), *ub = malloc((m + 1) * sizeof(size_t));
+    int ok = lb != NULL && ub != NULL
+          && bignum_lower_bound_batch(keys, n, xs, m, lb) == BIGNUM_SEARCH_OK
+          && bignum_upper_bound_batch(keys, n, xs, m, ub) == BIGNUM_SEARCH_OK;
+    for (size_t i = 0; ok && i < m; ++i) {
+        ok = lb[i] == ref_bound(keys, n, &xs[i], 0) && ub[i] == ref_bound(keys, n, &xs[i], 1);
+    }
+    free(lb);
+    free(ub);
+    return ok;
+}
+
+/** @brief Тест: совпадение с поштучным поиском для разных размеров массива и пакета. */
+int test_batch_matches_reference() {
+    static const size_t sizes[]   = { 0, 1, 2, 17, 1000 };
+    static const size_t batches[] = { 1, 16, 17, 3000 };
+    bignum_t *keys = malloc(1000 * sizeof(bignum_t));
+    bignum_t *xs   = malloc(3000 * sizeof(bignum_t));
+    int ok = keys != NULL && xs != NULL;
+    for (size_t s = 0; ok && s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        size_t n = sizes[s];
+        for (size_t i = 0; i < n; ++i) {
+            make_key(&keys[i], (size_t)(rand() % 4));
+        }
+        qsort(keys, n, sizeof(bignum_t), cmp_qsort);
+        for (size_t b = 0; ok && b < sizeof(batches) / sizeof(batches[0]); ++b) {
+            size_t m = batches[b];
+            for (size_t i = 0; i < m; ++i) {
+                if (n > 0 && i % 2 == 0) {
+                    xs[i] = keys[(size_t)rand() % n];
+                } else {
+                    make_key(&xs[i], (size_t)(rand() % 4));
+                }
+            }
+            ok = check_batch(keys, n, xs, m);
+        }
+    }
+    free(keys);
+    free(xs);
+    return ok;
+}
+
+/** @brief Тест: границы групп дубликатов. */
+int test_batch_duplicates() {
+    bignum_t keys[500], xs[60];
+    size_t lb[60], ub[60];
+    for (size_t i = 0; i < 500; ++i) {
+        bignum_init_u64(&keys[i], (uint64_t)(i / 10) * 2);   /* чётные, по 10 раз */
+    }
+    for (size_t i = 0; i < 60; ++i) {
+        bignum_init_u64(&xs[i], (uint64_t)i * 2 + (i % 3 == 0));
+    }
+    int ok = bignum_lower_bound_batch(keys, 500, xs, 60, lb) == BIGNUM_SEARCH_OK
+          && bignum_upper_bound_batch(keys, 500, xs, 60, ub) == BIGNUM_SEARCH_OK;
+    for (size_t i = 0; ok && i < 60; ++i) {
+        /* x = 2i (+1 при i % 3 == 0): группа i занимает [10i, 10i + 10). */
+        size_t expect_lb = i * 10 + (i % 3 == 0 ? 10 : 0);
+        size_t expect_ub = (i % 3 == 0) ? expect_lb : expect_lb + 10;
+        ok = lb[i] == (expect_lb < 500 ? expect_lb : 500) && ub[i] == (expect_ub < 500 ? expect_ub : 500);
+    }
+    return ok;
+}
+
+/** @brief Тест: запросы меньше и больше всех ключей, `len > BIGNUM_CAPACITY`, повторы. */
+int test_batch_extremes() {
+    bignum_t keys[100], xs[5];
+    size_t pos[5];
+    for (size_t i = 0; i < 100; ++i) {
+        bignum_init_u64(&keys[i], (uint64_t)i + 1);
+    }
+    bignum_init_u64(&xs[0], 0);
+    bignum_init_u64(&xs[1], 1000);
+    memset(&xs[2], 0, sizeof(bignum_t));
+    xs[2].len = BIGNUM_CAPACITY + 1;                  /* больше любого ключа */
+    bignum_init_u64(&xs[3], 50);
+    xs[4] = xs[3];
+    int ok = bignum_lower_bound_batch(keys, 100, xs, 5, pos) == BIGNUM_SEARCH_OK
+          && pos[0] == 0 && pos[1] == 100 && pos[2] == 100 && pos[3] == 49 && pos[4] == 49;
+    ok = ok && bignum_upper_bound_batch(keys, 100, xs, 5, pos) == BIGNUM_SEARCH_OK
+            && pos[0] == 0 && pos[1] == 100 && pos[2] == 100 && pos[3] == 50 && pos[4] == 50;
+    return ok;
+}
+
+/** @brief Тест: NULL-аргументы и пустой пакет. */
+int test_batch_errors() {
+    bignum_t keys[2], x;
+    size_t pos = 7;
+    bignum_init_u64(&keys[0], 1);
+    bignum_init_u64(&keys[1], 2);
+    bignum_init_u64(&x, 2);
+    return bignum_lower_bound_batch(NULL, 2, &x, 1, &pos) == BIGNUM_SEARCH_ERROR_NULL
+        && bignum_lower_bound_batch(keys, 2, NULL, 1, &pos) == BIGNUM_SEARCH_ERROR_NULL
+        && bignum_upper_bound_batch(keys, 2, &x, 1, NULL) == BIGNUM_SEARCH_ERROR_NULL
+        && bignum_lower_bound_batch(keys, 2, NULL, 0, NULL) == BIGNUM_SEARCH_OK
+        && bignum_lower_bound_batch(NULL, 0, &x, 1, &pos) == BIGNUM_SEARCH_OK && pos == 0;
+}
+
+int main() {
+    printf("--- Running tests for bignum_search ---\n");
+    srand(45);
+
+    RUN_TEST(test_batch_matches_reference);
+    RUN_TEST(test_batch_duplicates);
+    RUN_TEST(test_batch_extremes);
+    RUN_TEST(test_batch_errors);
+
+    printf("--- All bignum_search tests passed ---\n");
+    return 0;
+}
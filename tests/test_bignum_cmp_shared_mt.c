@@ -0,0 +1,310 @@
+/**
+ * @file    test_bignum_cmp_shared_mt.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief MT-тесты seqlock-значения (bignum_shared_*, bignum_cmp_snapshot).
+ *
+ * @details
+ * В отличие от test_bignum_cmp_ext_mt.c, где потоки разделяют пул только на
+ * чтение, здесь писатели меняют общий `bignum_shared_t`, пока читатели
+ * сравнивают его с порогами. Значение версии `2k` известно заранее
+ * (`make_value(k)`), поэтому каждый результат проверяется точно: читатель
+ * получает версию снимка, строит то же значение у себя и сравнивает
+ * `bignum_cmp`. Разорванное чтение (слова двух разных версий) дало бы
+ * расхождение.
+ *
+ * ### Анализ полноты покрытия
+ * 1.  **Однопоточная семантика:** `test_store_load_cmp` — init/store/load,
+ *     рост версии на 2, `bignum_cmp_snapshot` против `bignum_cmp` на значениях
+ *     с равными префиксами, нулём и `len = BIGNUM_CAPACITY`.
+ * 2.  **Согласованность сравнения:** `test_snapshot_vs_writer` — 1 писатель,
+ *     `NUM_READERS` читателей; каждый результат совпадает с `bignum_cmp` для
+ *     значения своей версии, версии у читателя не убывают.
+ * 3.  **Несколько писателей:** `test_multiple_writers` — 4 писателя
+ *     сериализуются на версии (итоговая версия = 2 · число записей), читатели
+ *     `bignum_shared_load` не видят смешанных значений.
+ * 4.  **Ошибки:** `test_errors` — `NULL`, `len > BIGNUM_CAPACITY`.
+ *
+ * Для Helgrind (`make test_helgrind`) проверка гонок на самом объекте
+ * отключается: seqlock читает его атомарными операциями, которые Helgrind не
+ * моделирует. ThreadSanitizer (`-fsanitize=thread`) проверяет объект полностью.
+ *
+ * @note Для сборки этого теста требуется флаг `-pthread`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_shared.h"
+#include <bignum_common.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__has_include)
+#  if __has_include(<valgrind/helgrind.h>)
+#    include <valgrind/helgrind.h>
+#  endif
+#endif
+#ifndef VALGRIND_HG_DISABLE_CHECKING
+#  define VALGRIND_HG_DISABLE_CHECKING(addr, len) ((void)(addr), (void)(len))
+#endif
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+#define NUM_READERS  7
+#define NUM_WRITES   200000
+#define NUM_WRITERS  4
+#define WRITER_OPS   20000
+
+/* Атомарный флаг ошибки — единый для всех потоков. */
+static atomic_int g_test_failed = ATOMIC_VAR_INIT(0);
+static atomic_int g_writers_done = ATOMIC_VAR_INIT(0);
+
+static uint64_t mix(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Значение номер `k`: длина меняется раз в 8 номеров, старшее слово —
+ *        раз в 2, младшие слова у соседних номеров разные. Сравнения соседних
+ *        значений доходят до младших слов, где разрыв был бы заметен.
+ */
+static void make_value(bignum_t *x, uint64_t k)
+{
+    size_t len = 2 + (size_t)(k / 8) % (BIGNUM_CAPACITY - 1);
+    memset(x, 0, sizeof(*x));
+    x->len = len;
+    for (size_t i = 0; i + 1 < len; ++i) {
+        x->words[i] = mix(k * 64 + i);
+    }
+    x->words[len - 1] = k / 2 + 1;
+}
+
+/** @brief Тест: однопоточная семантика. */
+int test_store_load_cmp() {
+    bignum_shared_t s;
+    bignum_t x, y, out;
+    uint64_t ver = 99;
+    int ok = bignum_shared_init(&s, NULL) == BIGNUM_SHARED_OK;
+    bignum_init_u64(&y, 0);
+    ok = ok && bignum_cmp_snapshot(&s, &y, &ver) == 0 && ver == 0;
+
+    for (uint64_t k = 0; ok && k < 200; ++k) {
+        make_value(&x, k);
+        ok = bignum_shared_store(&s, &x) == BIGNUM_SHARED_OK
+          && bignum_shared_load(&s, &out, &ver) == BIGNUM_SHARED_OK
+          && ver == 2 * (k + 1) && bignum_cmp(&out, &x) == 0;
+        for (uint64_t j = (k < 10 ? 0 : k - 10); ok && j < k + 10; ++j) {
+            make_value(&y, j);
+            ok = bignum_cmp_snapshot(&s, &y, NULL) == bignum_cmp(&x, &y);
+        }
+    }
+
+    /* Полная длина: различие только в младшем слове. */
+    for (size_t i = 0; i < BIGNUM_CAPACITY; ++i) {
+        x.words[i] = UINT64_MAX;
+    }
+    x.len = BIGNUM_CAPACITY;
+    y = x;
+    y.words[0] = UINT64_MAX - 1;
+    ok = ok && bignum_shared_init(&s, &x) == BIGNUM_SHARED_OK
+            && bignum_cmp_snapshot(&s, &x, &ver) == 0 && ver == 0
+            && bignum_cmp_snapshot(&s, &y, NULL) == 1;
+    ok = ok && bignum_shared_store(&s, &y) == BIGNUM_SHARED_OK
+            && bignum_cmp_snapshot(&s, &x, NULL) == -1;
+    return ok;
+}
+
+typedef struct {
+    bignum_shared_t *s;
+    int              id;
+} thread_task_t;
+
+static void *writer_func(void *arg)
+{
+    thread_task_t *t = arg;
+    bignum_t x;
+    for (uint64_t k = 1; k <= NUM_WRITES && !atomic_load(&g_test_failed); ++k) {
+        make_value(&x, k);
+        bignum_shared_store(t->s, &x);
+    }
+    atomic_fetch_add(&g_writers_done, 1);
+    return NULL;
+}
+
+static void *reader_func(void *arg)
+{
+    thread_task_t *t = arg;
+    bignum_t thr, expect;
+    uint64_t last = 0, ver;
+    uint64_t rng = (uint64_t)t->id + 1;
+    size_t iter = 0;
+
+    while (!atomic_load(&g_test_failed) && (atomic_load(&g_writers_done) == 0 || iter < 1000)) {
+        ++iter;
+        rng = mix(rng);
+        /* Порог рядом с последним виденным значением: сравнение идёт вглубь слов. */
+        uint64_t cur = last / 2;
+        make_value(&thr, cur + rng % 5 - 2 + (cur < 2 ? 2 : 0));
+
+        int r = bignum_cmp_snapshot(t->s, &thr, &ver);
+        make_value(&expect, ver / 2);
+        if ((ver & 1) != 0 || ver < last || r != bignum_cmp(&expect, &thr)) {
+            printf("Reader %d iter %zu: version %llu, got %d, expected %d\n", t->id, iter,
+                   (unsigned long long)ver, r, bignum_cmp(&expect, &thr));
+            atomic_store(&g_test_failed, 1);
+            return NULL;
+        }
+        last = ver;
+    }
+    return NULL;
+}
+
+/** @brief Тест: один писатель и `NUM_READERS` читателей. */
+int test_snapshot_vs_writer() {
+    bignum_shared_t s;
+    bignum_t x;
+    make_value(&x, 0);
+    bignum_shared_init(&s, &x);
+    VALGRIND_HG_DISABLE_CHECKING(&s, sizeof(s));
+    atomic_store(&g_writers_done, 0);
+
+    pthread_t     tids[NUM_READERS + 1];
+    thread_task_t tasks[NUM_READERS + 1];
+    for (int i = 0; i <= NUM_READERS; ++i) {
+        tasks[i].s  = &s;
+        tasks[i].id = i;
+        if (pthread_create(&tids[i], NULL, i == 0 ? writer_func : reader_func, &tasks[i]) != 0) {
+            perror("pthread_create");
+            return 0;
+        }
+    }
+    for (int i = 0; i <= NUM_READERS; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    uint64_t ver;
+    bignum_t out;
+    make_value(&x, NUM_WRITES);
+    return !atomic_load(&g_test_failed)
+        && bignum_shared_load(&s, &out, &ver) == BIGNUM_SHARED_OK
+        && ver == 2 * NUM_WRITES && bignum_cmp(&out, &x) == 0;
+}
+
+/** Значение писателя: все `len` слов равны `id << 32 | i`, длина зависит от `i`. */
+static void *multi_writer_func(void *arg)
+{
+    thread_task_t *t = arg;
+    bignum_t x;
+    for (uint64_t i = 0; i < WRITER_OPS; ++i) {
+        x.len = 1 + (size_t)(i % BIGNUM_CAPACITY);
+        for (size_t w = 0; w < x.len; ++w) {
+            x.words[w] = (uint64_t)t->id << 32 | i;
+        }
+        bignum_shared_store(t->s, &x);
+    }
+    atomic_fetch_add(&g_writers_done, 1);
+    return NULL;
+}
+
+static void *multi_reader_func(void *arg)
+{
+    thread_task_t *t = arg;
+    bignum_t out;
+    while (!atomic_load(&g_test_failed) && atomic_load(&g_writers_done) < NUM_WRITERS) {
+        bignum_shared_load(t->s, &out, NULL);
+        for (size_t w = 1; w < out.len; ++w) {
+            if (out.words[w] != out.words[0]) {
+                printf("Reader %d: torn value, word %zu\n", t->id, w);
+                atomic_store(&g_test_failed, 1);
+                return NULL;
+            }
+        }
+        uint64_t i = out.words[0] & 0xFFFFFFFFu;
+        if (out.len > 0 && out.len != 1 + (size_t)(i % BIGNUM_CAPACITY)) {
+            printf("Reader %d: len %zu does not match value\n", t->id, out.len);
+            atomic_store(&g_test_failed, 1);
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+/** @brief Тест: `NUM_WRITERS` писателей и 2 читателя. */
+int test_multiple_writers() {
+    bignum_shared_t s;
+    bignum_shared_init(&s, NULL);
+    VALGRIND_HG_DISABLE_CHECKING(&s, sizeof(s));
+    atomic_store(&g_writers_done, 0);
+
+    pthread_t     tids[NUM_WRITERS + 2];
+    thread_task_t tasks[NUM_WRITERS + 2];
+    for (int i = 0; i < NUM_WRITERS + 2; ++i) {
+        tasks[i].s  = &s;
+        tasks[i].id = i + 1;
+        if (pthread_create(&tids[i], NULL, i < NUM_WRITERS ? multi_writer_func : multi_reader_func,
+                           &tasks[i]) != 0) {
+            perror("pthread_create");
+            return 0;
+        }
+    }
+    for (int i = 0; i < NUM_WRITERS + 2; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    uint64_t ver;
+    bignum_t out;
+    return !atomic_load(&g_test_failed)
+        && bignum_shared_load(&s, &out, &ver) == BIGNUM_SHARED_OK
+        && ver == 2ull * NUM_WRITERS * WRITER_OPS && out.words[0] % (1ull << 32) == WRITER_OPS - 1;
+}
+
+/** @brief Тест: ошибки. */
+int test_errors() {
+    bignum_shared_t s;
+    bignum_t x, out;
+    bignum_init_u64(&x, 5);
+    int ok = bignum_shared_init(NULL, &x) == BIGNUM_SHARED_ERROR_NULL
+          && bignum_shared_init(&s, &x) == BIGNUM_SHARED_OK
+          && bignum_shared_store(NULL, &x) == BIGNUM_SHARED_ERROR_NULL
+          && bignum_shared_store(&s, NULL) == BIGNUM_SHARED_ERROR_NULL
+          && bignum_shared_load(NULL, &out, NULL) == BIGNUM_SHARED_ERROR_NULL
+          && bignum_shared_load(&s, NULL, NULL) == BIGNUM_SHARED_ERROR_NULL
+          && bignum_cmp_snapshot(NULL, &x, NULL) == BIGNUM_CMP_ERROR_NULL
+          && bignum_cmp_snapshot(&s, NULL, NULL) == BIGNUM_CMP_ERROR_NULL;
+    x.len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_shared_init(&s, &x) == BIGNUM_SHARED_ERROR_RANGE
+            && bignum_shared_store(&s, &x) == BIGNUM_SHARED_ERROR_RANGE
+            && bignum_cmp_snapshot(&s, &x, NULL) == -1;     /* сравнение по длине */
+    uint64_t ver;
+    ok = ok && bignum_shared_load(&s, &out, &ver) == BIGNUM_SHARED_OK
+            && ver == 0 && out.len == 1 && out.words[0] == 5;
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_shared ---\n");
+
+    RUN_TEST(test_store_load_cmp);
+    RUN_TEST(test_snapshot_vs_writer);
+    RUN_TEST(test_multiple_writers);
+    RUN_TEST(test_errors);
+
+    printf("--- All bignum_shared tests passed ---\n");
+    return 0;
+}
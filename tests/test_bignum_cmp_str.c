@@ -0,0 +1,369 @@
+/**
+ * @file    test_bignum_cmp_str.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты bignum_cmp_hexstr и bignum_cmp_decstr.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * Эталон — `bignum_cmp(a, x)`, где строка получена из `x` печатью
+ * (`to_hex` / `to_dec` ниже).
+ * 1.  **Случайные пары:** `test_hex_random`, `test_dec_random` — случайные
+ *     длины, `x = a`, `x = a ± 1` (совпадают все старшие цифры — полный
+ *     разбор), ведущие нули, префикс `0x`/`0X`, смешанный регистр.
+ * 2.  **Границы длины:** `test_dec_boundaries` — `2^k`, `2^k - 1`, `10^j`,
+ *     `10^j - 1` и соседи на всём диапазоне битовых длин (границы десятичной
+ *     длины и оценок `log2`); `test_hex_boundaries` — `16^j` и `16^j - 1`.
+ * 3.  **Ошибки и крайние случаи:** `test_errors` — нуль и ненормализованная
+ *     длина, строка из одних нулей, пустая строка, `"0x"`, недопустимые
+ *     символы в начале, середине и хвосте, строка шире ёмкости, `NULL`,
+ *     `len > BIGNUM_CAPACITY`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_str.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+#define STR_MAX (BIGNUM_CAPACITY * 20 + 64)
+
+static uint64_t rand64(void)
+{
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+static void random_bignum(bignum_t *x, size_t len)
+{
+    uint64_t w[BIGNUM_CAPACITY];
+    for (size_t i = 0; i < len; ++i) {
+        w[i] = rand64();
+    }
+    if (len > 0 && w[len - 1] == 0) {
+        w[len - 1] = 1;
+    }
+    bignum_init_from_array(x, w, len);
+}
+
+/** `x += 1`; `0` — переполнение ёмкости. */
+static int inc(bignum_t *x)
+{
+    for (size_t i = 0; i < x->len; ++i) {
+        if (++x->words[i] != 0) {
+            return 1;
+        }
+    }
+    if (x->len == BIGNUM_CAPACITY) {
+        return 0;
+    }
+    x->words[x->len++] = 1;
+    return 1;
+}
+
+/** `x -= 1`, `x > 0`. */
+static void dec(bignum_t *x)
+{
+    for (size_t i = 0; i < x->len; ++i) {
+        if (x->words[i]-- != 0) {
+            break;
+        }
+    }
+    while (x->len > 0 && x->words[x->len - 1] == 0) {
+        x->len--;
+    }
+}
+
+/** Шестнадцатеричная запись `x`: `zeros` ведущих нулей, регистр букв — `upper`. */
+static size_t to_hex(const bignum_t *x, char *out, size_t zeros, int upper)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < zeros; ++i) {
+        out[n++] = '0';
+    }
+    if (x->len == 0) {
+        out[n++] = '0';
+        return n;
+    }
+    n += (size_t)sprintf(out + n, upper ? "%llX" : "%llx", (unsigned long long)x->words[x->len - 1]);
+    for (size_t i = x->len - 1; i > 0; --i) {
+        n += (size_t)sprintf(out + n, upper ? "%016llX" : "%016llx", (unsigned long long)x->words[i - 1]);
+    }
+    return n;
+}
+
+/** Десятичная запись `x` делением на `10^19`. */
+static size_t to_dec(const bignum_t *x, char *out, size_t zeros)
+{
+    __extension__ typedef unsigned __int128 u128;
+    uint64_t chunks[BIGNUM_CAPACITY * 2];
+    size_t   nc = 0;
+    bignum_t q  = *x;
+    while (q.len > 0) {
+        uint64_t r = 0;
+        for (size_t i = q.len; i > 0; --i) {
+            u128 cur = (u128)r << 64 | q.words[i - 1];
+            q.words[i - 1] = (uint64_t)(cur / 10000000000000000000ull);
+            r              = (uint64_t)(cur % 10000000000000000000ull);
+        }
+        while (q.len > 0 && q.words[q.len - 1] == 0) {
+            q.len--;
+        }
+        chunks[nc++] = r;
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < zeros; ++i) {
+        out[n++] = '0';
+    }
+    if (nc == 0) {
+        out[n++] = '0';
+        return n;
+    }
+    n += (size_t)sprintf(out + n, "%llu", (unsigned long long)chunks[nc - 1]);
+    for (size_t i = nc - 1; i > 0; --i) {
+        n += (size_t)sprintf(out + n, "%019llu", (unsigned long long)chunks[i - 1]);
+    }
+    return n;
+}
+
+static int check_hex(const bignum_t *a, const bignum_t *x)
+{
+    char   s[STR_MAX];
+    size_t off = 0;
+    if (rand() % 3 == 0) {
+        s[0] = '0';
+        s[1] = rand() % 2 ? 'x' : 'X';
+        off  = 2;
+    }
+    size_t n = off + to_hex(x, s + off, (size_t)(rand() % 3 ? 0 : rand() % 40), rand() % 2);
+    return bignum_cmp_hexstr(a, s, n) == bignum_cmp(a, x);
+}
+
+static int check_dec(const bignum_t *a, const bignum_t *x)
+{
+    char   s[STR_MAX];
+    size_t n = to_dec(x, s, (size_t)(rand() % 3 ? 0 : rand() % 40));
+    return bignum_cmp_decstr(a, s, n) == bignum_cmp(a, x);
+}
+
+/** Случайная пара с заданным соотношением: разные, равные, соседи. */
+static void random_pair(bignum_t *a, bignum_t *x, int iter)
+{
+    size_t la = (size_t)(rand() % (BIGNUM_CAPACITY + 1));
+    random_bignum(a, la);
+    switch (iter % 4) {
+    case 0:
+        random_bignum(x, (size_t)(rand() % (BIGNUM_CAPACITY + 1)));
+        break;
+    case 1:
+        *x = *a;
+        break;
+    case 2:
+        *x = *a;
+        if (!inc(x)) {
+            dec(a);
+        }
+        break;
+    default:
+        *x = *a;
+        if (x->len > 0) {
+            dec(x);
+        }
+        break;
+    }
+}
+
+/** @brief Тест: случайные пары, шестнадцатеричная строка. */
+int test_hex_random() {
+    bignum_t a, x;
+    int ok = 1;
+    for (int iter = 0; ok && iter < 20000; ++iter) {
+        random_pair(&a, &x, iter);
+        ok = check_hex(&a, &x) && check_hex(&x, &a);
+    }
+    return ok;
+}
+
+/** @brief Тест: случайные пары, десятичная строка. */
+int test_dec_random() {
+    bignum_t a, x;
+    int ok = 1;
+    for (int iter = 0; ok && iter < 5000; ++iter) {
+        random_pair(&a, &x, iter);
+        ok = check_dec(&a, &x) && check_dec(&x, &a);
+    }
+    return ok;
+}
+
+/** Сверяет все пары из `{v - 1, v, v + 1}` для обоих `v`. */
+static int check_neighbourhood(const bignum_t *u, const bignum_t *v, int (*check)(const bignum_t *, const bignum_t *))
+{
+    bignum_t us[3], vs[3];
+    us[0] = us[1] = us[2] = *u;
+    vs[0] = vs[1] = vs[2] = *v;
+    if (us[0].len > 0) dec(&us[0]);
+    if (vs[0].len > 0) dec(&vs[0]);
+    int ok = 1;
+    if (!inc(&us[2])) us[2] = us[1];
+    if (!inc(&vs[2])) vs[2] = vs[1];
+    for (int i = 0; ok && i < 3; ++i) {
+        for (int j = 0; ok && j < 3; ++j) {
+            ok = check(&us[i], &vs[j]) && check(&vs[j], &us[i]);
+        }
+    }
+    return ok;
+}
+
+/** `x *= m`, `0` — переполнение ёмкости. */
+static int mul_small(bignum_t *x, uint64_t m)
+{
+    __extension__ typedef unsigned __int128 u128;
+    uint64_t carry = 0;
+    for (size_t i = 0; i < x->len; ++i) {
+        u128 t = (u128)x->words[i] * m + carry;
+        x->words[i] = (uint64_t)t;
+        carry       = (uint64_t)(t >> 64);
+    }
+    if (carry != 0) {
+        if (x->len == BIGNUM_CAPACITY) {
+            return 0;
+        }
+        x->words[x->len++] = carry;
+    }
+    return 1;
+}
+
+/** @brief Тест: степени двойки против степеней десяти. */
+int test_dec_boundaries() {
+    bignum_t p2, p10;
+    int ok = 1;
+    bignum_init_u64(&p10, 1);
+    for (size_t k = 0; ok && k < 64 * BIGNUM_CAPACITY; ++k) {
+        uint64_t w[BIGNUM_CAPACITY] = { 0 };
+        w[k / 64] = 1ull << (k % 64);
+        bignum_init_from_array(&p2, w, k / 64 + 1);
+        ok = check_neighbourhood(&p2, &p10, check_dec);
+        /* Ближайшая степень десяти не меньше 2^k. */
+        while (ok && bignum_cmp(&p10, &p2) < 0) {
+            if (!mul_small(&p10, 10)) {
+                return ok;
+            }
+        }
+    }
+    return ok;
+}
+
+/** @brief Тест: `16^j` и соседи, в том числе на границе слов. */
+int test_hex_boundaries() {
+    bignum_t p, q;
+    int ok = 1;
+    bignum_init_u64(&q, 1);
+    for (size_t j = 0; ok && j < 16 * BIGNUM_CAPACITY; ++j) {
+        uint64_t w[BIGNUM_CAPACITY] = { 0 };
+        w[j / 16] = 1ull << (4 * (j % 16));
+        bignum_init_from_array(&p, w, j / 16 + 1);
+        ok = check_neighbourhood(&p, &q, check_hex);
+        q = p;
+    }
+    return ok;
+}
+
+/** @brief Тест: ошибки и крайние случаи. */
+int test_errors() {
+    bignum_t zero, one, x;
+    char     s[STR_MAX];
+    bignum_init_u64(&zero, 0);
+    bignum_init_u64(&one, 1);
+
+    int ok = bignum_cmp_hexstr(&zero, "0", 1) == BIGNUM_CMP_EQ
+          && bignum_cmp_decstr(&zero, "0000", 4) == BIGNUM_CMP_EQ
+          && bignum_cmp_hexstr(&zero, "0x000", 5) == BIGNUM_CMP_EQ
+          && bignum_cmp_decstr(&one, "0", 1) == BIGNUM_CMP_GREATER
+          && bignum_cmp_decstr(&zero, "1", 1) == BIGNUM_CMP_LESS
+          && bignum_cmp_hexstr(&one, "0X1", 3) == BIGNUM_CMP_EQ
+          && bignum_cmp_decstr(&one, "12", 1) == BIGNUM_CMP_EQ;  /* учитываются только n байт */
+
+    /* Ненормализованная длина: старшие нулевые слова. */
+    x = one;
+    x.len = BIGNUM_CAPACITY < 3 ? BIGNUM_CAPACITY : 3;
+    ok = ok && bignum_cmp_hexstr(&x, "1", 1) == BIGNUM_CMP_EQ
+            && bignum_cmp_decstr(&x, "1", 1) == BIGNUM_CMP_EQ;
+
+    /* Синтаксис. */
+    ok = ok && bignum_cmp_hexstr(&one, "", 0) == BIGNUM_CMP_STR_ERROR_SYNTAX
+            && bignum_cmp_decstr(&one, "", 0) == BIGNUM_CMP_STR_ERROR_SYNTAX
+            && bignum_cmp_hexstr(&one, "0x", 2) == BIGNUM_CMP_STR_ERROR_SYNTAX
+            && bignum_cmp_decstr(&one, "0x1", 3) == BIGNUM_CMP_STR_ERROR_SYNTAX
+            && bignum_cmp_hexstr(&one, "-1", 2) == BIGNUM_CMP_STR_ERROR_SYNTAX
+            && bignum_cmp_decstr(&one, "+1", 2) == BIGNUM_CMP_STR_ERROR_SYNTAX
+            && bignum_cmp_hexstr(&one, "1g", 2) == BIGNUM_CMP_STR_ERROR_SYNTAX
+            && bignum_cmp_decstr(&one, "1a", 2) == BIGNUM_CMP_STR_ERROR_SYNTAX
+            && bignum_cmp_decstr(&one, " 1", 2) == BIGNUM_CMP_STR_ERROR_SYNTAX;
+    for (size_t len = 1; ok && len < 80; ++len) {
+        for (size_t pos = 0; ok && pos < len; ++pos) {
+            memset(s, '7', len);
+            s[pos] = (char)(pos % 2 ? ':' : '\xB7');
+            ok = bignum_cmp_hexstr(&one, s, len) == BIGNUM_CMP_STR_ERROR_SYNTAX
+              && bignum_cmp_decstr(&one, s, len) == BIGNUM_CMP_STR_ERROR_SYNTAX;
+            s[pos] = '/';
+            ok = ok && bignum_cmp_hexstr(&one, s, len) == BIGNUM_CMP_STR_ERROR_SYNTAX
+                    && bignum_cmp_decstr(&one, s, len) == BIGNUM_CMP_STR_ERROR_SYNTAX;
+            s[pos] = 'G';
+            ok = ok && bignum_cmp_hexstr(&one, s, len) == BIGNUM_CMP_STR_ERROR_SYNTAX;
+        }
+    }
+
+    /* Строка шире ёмкости: любое bignum_t меньше. */
+    uint64_t w[BIGNUM_CAPACITY];
+    for (size_t i = 0; i < BIGNUM_CAPACITY; ++i) {
+        w[i] = UINT64_MAX;
+    }
+    bignum_init_from_array(&x, w, BIGNUM_CAPACITY);
+    size_t n = to_hex(&x, s, 0, 0);
+    s[n] = '0';
+    ok = ok && bignum_cmp_hexstr(&x, s, n) == BIGNUM_CMP_EQ
+            && bignum_cmp_hexstr(&x, s, n + 1) == BIGNUM_CMP_LESS;
+    n = to_dec(&x, s, 0);
+    s[n] = '0';
+    ok = ok && bignum_cmp_decstr(&x, s, n) == BIGNUM_CMP_EQ
+            && bignum_cmp_decstr(&x, s, n + 1) == BIGNUM_CMP_LESS;
+    /* Та же длина, что у 2^(64·CAPACITY) - 1, но больше: полный разбор переполняет ёмкость. */
+    memset(s, '9', n);
+    ok = ok && bignum_cmp_decstr(&x, s, n) == BIGNUM_CMP_LESS;
+
+    /* NULL и len > BIGNUM_CAPACITY. */
+    ok = ok && bignum_cmp_hexstr(NULL, "1", 1) == BIGNUM_CMP_ERROR_NULL
+            && bignum_cmp_decstr(&one, NULL, 1) == BIGNUM_CMP_ERROR_NULL;
+    x.len = BIGNUM_CAPACITY + 1;
+    ok = ok && bignum_cmp_hexstr(&x, "1", 1) == BIGNUM_CMP_STR_ERROR_RANGE
+            && bignum_cmp_decstr(&x, "1", 1) == BIGNUM_CMP_STR_ERROR_RANGE;
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_str ---\n");
+    srand(48);
+
+    RUN_TEST(test_hex_random);
+    RUN_TEST(test_dec_random);
+    RUN_TEST(test_dec_boundaries);
+    RUN_TEST(test_hex_boundaries);
+    RUN_TEST(test_errors);
+
+    printf("--- All bignum_str tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file    test_bignum_cmp_stream.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты потокового сравнения (bignum_cmp_stream_*).
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Решение по длине:** `test_stream_diff_len` — результат известен после init.
+ * 2.  **Ранний выход:** `test_stream_early_decision` — решение по первому слову,
+ *     остальные порции не влияют на результат.
+ * 3.  **Равенство:** `test_stream_equal_chunks` — `0` только после последнего слова.
+ * 4.  **Нули:** `test_stream_zero` — `len = 0` равно нулевому эталону.
+ * 5.  **Эквивалентность bignum_cmp:** `test_stream_matches_cmp` — случайные пары
+ *     и все размеры порций от 1 до `len`.
+ * 6.  **Робастность:** `test_stream_null`, `test_stream_overflow`, `test_stream_range`.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_stream.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+/** Подаёт слова `x` (little-endian, как в bignum_t) порциями по `chunk` от старшего к младшему. */
+static int feed_msf(bignum_cmp_stream_t *s, const bignum_t *x, size_t chunk)
+{
+    uint64_t buf[BIGNUM_CAPACITY];
+    size_t   left = x->len;
+    int      st   = bignum_cmp_stream_result(s);
+
+    while (left > 0) {
+        size_t n = (chunk < left) ? chunk : left;
+        for (size_t i = 0; i < n; ++i) {
+            buf[i] = x->words[left - 1 - i];
+        }
+        st = bignum_cmp_stream_update(s, buf, n);
+        left -= n;
+    }
+    return st;
+}
+
+/** @brief Тест: разные длины — результат известен сразу после init. */
+int test_stream_diff_len() {
+    bignum_t ref;
+    uint64_t d[] = {1, 2};
+    bignum_init_from_array(&ref, d, 2);
+
+    bignum_cmp_stream_t s;
+    if (bignum_cmp_stream_init(&s, &ref, 3) != BIGNUM_CMP_GREATER) return 0;
+    if (bignum_cmp_stream_init(&s, &ref, 1) != BIGNUM_CMP_LESS) return 0;
+    if (bignum_cmp_stream_init(&s, &ref, 2) != BIGNUM_CMP_STREAM_PENDING) return 0;
+    return 1;
+}
+
+/** @brief Тест: различие в старшем слове решает сравнение по первой порции. */
+int test_stream_early_decision() {
+    bignum_t ref;
+    uint64_t d[] = {5, 5, 5, 5};
+    bignum_init_from_array(&ref, d, 4);
+
+    bignum_cmp_stream_t s;
+    bignum_cmp_stream_init(&s, &ref, 4);
+    uint64_t first[] = {6};
+    if (bignum_cmp_stream_update(&s, first, 1) != BIGNUM_CMP_GREATER) return 0;
+
+    /* Младшие слова меньше эталона, но решение уже принято. */
+    uint64_t rest[] = {0, 0, 0};
+    if (bignum_cmp_stream_update(&s, rest, 3) != BIGNUM_CMP_GREATER) return 0;
+    return bignum_cmp_stream_result(&s) == BIGNUM_CMP_GREATER;
+}
+
+/** @brief Тест: равные числа дают 0 только после последнего слова. */
+int test_stream_equal_chunks() {
+    bignum_t ref;
+    uint64_t d[] = {1, 2, 3};
+    bignum_init_from_array(&ref, d, 3);
+
+    bignum_cmp_stream_t s;
+    bignum_cmp_stream_init(&s, &ref, 3);
+    uint64_t c0[] = {3, 2};
+    uint64_t c1[] = {1};
+    if (bignum_cmp_stream_update(&s, c0, 2) != BIGNUM_CMP_STREAM_PENDING) return 0;
+    if (bignum_cmp_stream_update(&s, NULL, 0) != BIGNUM_CMP_STREAM_PENDING) return 0;
+    if (bignum_cmp_stream_update(&s, c1, 1) != BIGNUM_CMP_EQ) return 0;
+    return 1;
+}
+
+/** @brief Тест: ноль против нуля. */
+int test_stream_zero() {
+    bignum_t ref;
+    bignum_init_u64(&ref, 0);
+
+    bignum_cmp_stream_t s;
+    if (bignum_cmp_stream_init(&s, &ref, 0) != BIGNUM_CMP_EQ) return 0;
+    return bignum_cmp_stream_result(&s) == BIGNUM_CMP_EQ;
+}
+
+/** @brief Тест: на случайных парах результат совпадает с bignum_cmp при любом размере порции. */
+int test_stream_matches_cmp() {
+    srand(12345);
+    for (int iter = 0; iter < 2000; ++iter) {
+        bignum_t a, b;
+        uint64_t da[BIGNUM_CAPACITY], db[BIGNUM_CAPACITY];
+        size_t len_a = (size_t)(rand() % BIGNUM_CAPACITY) + 1;
+        size_t len_b = (iter % 4 == 0) ? (size_t)(rand() % BIGNUM_CAPACITY) + 1 : len_a;
+        for (size_t i = 0; i < BIGNUM_CAPACITY; ++i) {
+            da[i] = (uint64_t)(rand() % 4);
+            db[i] = (iter % 3 == 0) ? da[i] : (uint64_t)(rand() % 4);
+        }
+        da[len_a - 1] |= 1;
+        db[len_b - 1] |= 1;
+        bignum_init_from_array(&a, da, len_a);
+        bignum_init_from_array(&b, db, len_b);
+
+        int expected = bignum_cmp(&a, &b);
+        for (size_t chunk = 1; chunk <= a.len; ++chunk) {
+            bignum_cmp_stream_t s;
+            bignum_cmp_stream_init(&s, &b, a.len);
+            if (feed_msf(&s, &a, chunk) != expected) {
+                printf("\n  mismatch: iter=%d chunk=%zu expected=%d\n", iter, chunk, expected);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/** @brief Тест: NULL-аргументы. */
+int test_stream_null() {
+    bignum_t ref;
+    bignum_init_u64(&ref, 1);
+    bignum_cmp_stream_t s;
+
+    if (bignum_cmp_stream_init(NULL, &ref, 1) != BIGNUM_CMP_ERROR_NULL) return 0;
+    if (bignum_cmp_stream_init(&s, NULL, 1) != BIGNUM_CMP_ERROR_NULL) return 0;
+    bignum_cmp_stream_init(&s, &ref, 1);
+    if (bignum_cmp_stream_update(&s, NULL, 1) != BIGNUM_CMP_ERROR_NULL) return 0;
+    if (bignum_cmp_stream_update(NULL, NULL, 0) != BIGNUM_CMP_ERROR_NULL) return 0;
+    return bignum_cmp_stream_result(NULL) == BIGNUM_CMP_ERROR_NULL;
+}
+
+/** @brief Тест: подача слов сверх объявленной длины. */
+int test_stream_overflow() {
+    bignum_t ref;
+    uint64_t d[] = {7, 7};
+    bignum_init_from_array(&ref, d, 2);
+
+    bignum_cmp_stream_t s;
+    bignum_cmp_stream_init(&s, &ref, 2);
+    uint64_t c[] = {7, 7, 7};
+    if (bignum_cmp_stream_update(&s, c, 3) != BIGNUM_CMP_STREAM_ERROR_OVERFLOW) return 0;
+    /* Ошибочная порция не должна сдвинуть состояние. */
+    if (bignum_cmp_stream_update(&s, c, 2) != BIGNUM_CMP_EQ) return 0;
+    return bignum_cmp_stream_update(&s, c, 1) == BIGNUM_CMP_STREAM_ERROR_OVERFLOW;
+}
+
+/** @brief Тест: эталон с длиной больше BIGNUM_CAPACITY. */
+int test_stream_range() {
+    bignum_t ref;
+    bignum_init_u64(&ref, 1);
+    ref.len = BIGNUM_CAPACITY + 1;
+
+    bignum_cmp_stream_t s;
+    uint64_t c[BIGNUM_CAPACITY + 1] = {0};
+    if (bignum_cmp_stream_init(&s, &ref, BIGNUM_CAPACITY + 1) != BIGNUM_CMP_STREAM_ERROR_RANGE) return 0;
+    if (bignum_cmp_stream_update(&s, c, BIGNUM_CAPACITY + 1) != BIGNUM_CMP_STREAM_ERROR_RANGE) return 0;
+    if (bignum_cmp_stream_result(&s) != BIGNUM_CMP_STREAM_ERROR_RANGE) return 0;
+    /* Длины различны, но эталон всё равно некорректен. */
+    return bignum_cmp_stream_init(&s, &ref, 1) == BIGNUM_CMP_STREAM_ERROR_RANGE;
+}
+
+int main() {
+    printf("\n--- Running Tests for bignum_cmp_stream ---\n");
+
+    RUN_TEST(test_stream_diff_len);
+    RUN_TEST(test_stream_early_decision);
+    RUN_TEST(test_stream_equal_chunks);
+    RUN_TEST(test_stream_zero);
+    RUN_TEST(test_stream_matches_cmp);
+    RUN_TEST(test_stream_null);
+    RUN_TEST(test_stream_overflow);
+    RUN_TEST(test_stream_range);
+
+    printf("--- All stream tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,236 @@
+/**
+ * @file    test_bignum_cmp_topk.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты bignum_nth_element, bignum_partial_sort и bignum_topk_*.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **nth_element:** `test_nth_element_matches_sort` — для случайных массивов
+ *     с длинными сериями равных ключей и с равными префиксами `a[k]` совпадает
+ *     с эталонной сортировкой, слева не больше, справа не меньше, мультимножество
+ *     сохранено.
+ * 2.  **partial_sort:** `test_partial_sort_prefix` — `a[0 … k-1]` совпадает с
+ *     началом отсортированного массива, включая `k = 0` и `k = n`.
+ * 3.  **top-k:** `test_topk_stream_and_mt` — потоковая куча (поштучно и
+ *     пакетами), слияние двух куч, `bignum_topk` и `bignum_topk_mt` при разном
+ *     числе потоков дают k наибольших по убыванию.
+ * 4.  **Вырожденные входы:** `test_all_equal_and_errors` — 200000 равных
+ *     ключей (не деградирует до квадратичного времени), `n < k`, ошибки.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_topk.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return bignum_cmp((const bignum_t *)a, (const bignum_t *)b);
+}
+
+/**
+ * Массив с сериями: треть — из 8 «горячих» значений, часть ключей имеет
+ * одинаковые `len` и старшее слово, но разные младшие слова.
+ */
+static void fill(bignum_t *a, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t w[3] = { (uint64_t)rand(), (uint64_t)(rand() % 4), (uint64_t)rand() + 1 };
+        int kind = rand() % 3;
+        if (kind == 0) {
+            bignum_init_u64(&a[i], (uint64_t)(rand() % 8) + 1000);
+        } else if (kind == 1) {
+            bignum_init_from_array(&a[i], w, 3);
+        } else {
+            bignum_init_from_array(&a[i], w, 2);
+        }
+        for (size_t k = a[i].len; k < BIGNUM_CAPACITY; ++k) {
+            a[i].words[k] = (uint64_t)rand();   /* мусор за len */
+        }
+    }
+}
+
+static int same_multiset(const bignum_t *a, const bignum_t *sorted, size_t n)
+{
+    bignum_t *c = malloc(sizeof(bignum_t) * (n ? n : 1));
+    if (c == NULL) {
+        return 0;
+    }
+    memcpy(c, a, sizeof(bignum_t) * n);
+    qsort(c, n, sizeof(bignum_t), cmp_qsort);
+    int ok = 1;
+    for (size_t i = 0; ok && i < n; ++i) {
+        ok = bignum_cmp(&c[i], &sorted[i]) == 0;
+    }
+    free(c);
+    return ok;
+}
+
+/** @brief Тест: nth_element против полной сортировки. */
+int test_nth_element_matches_sort() {
+    int ok = 1;
+    for (int round = 0; ok && round < 30; ++round) {
+        size_t n = (size_t)(rand() % 5000) + 1;
+        size_t k = (size_t)rand() % n;
+        bignum_t *a = malloc(sizeof(bignum_t) * n);
+        bignum_t *s = malloc(sizeof(bignum_t) * n);
+        if (a == NULL || s == NULL) {
+            free(a); free(s);
+            return 0;
+        }
+        fill(a, n);
+        memcpy(s, a, sizeof(bignum_t) * n);
+        qsort(s, n, sizeof(bignum_t), cmp_qsort);
+
+        ok = bignum_nth_element(a, n, k) == BIGNUM_TOPK_OK && bignum_cmp(&a[k], &s[k]) == 0;
+        for (size_t i = 0; ok && i < n; ++i) {
+            int c = bignum_cmp(&a[i], &a[k]);
+            ok = (i < k) ? c <= 0 : (i > k) ? c >= 0 : 1;
+        }
+        ok = ok && same_multiset(a, s, n);
+        free(a);
+        free(s);
+    }
+    return ok;
+}
+
+/** @brief Тест: partial_sort упорядочивает k наименьших. */
+int test_partial_sort_prefix() {
+    int ok = 1;
+    for (int round = 0; ok && round < 30; ++round) {
+        size_t n = (size_t)(rand() % 3000) + 1;
+        size_t k = (round == 0) ? 0 : (round == 1) ? n : (size_t)rand() % (n + 1);
+        bignum_t *a = malloc(sizeof(bignum_t) * n);
+        bignum_t *s = malloc(sizeof(bignum_t) * n);
+        if (a == NULL || s == NULL) {
+            free(a); free(s);
+            return 0;
+        }
+        fill(a, n);
+        memcpy(s, a, sizeof(bignum_t) * n);
+        qsort(s, n, sizeof(bignum_t), cmp_qsort);
+
+        ok = bignum_partial_sort(a, n, k) == BIGNUM_TOPK_OK;
+        for (size_t i = 0; ok && i < k; ++i) {
+            ok = bignum_cmp(&a[i], &s[i]) == 0;
+        }
+        ok = ok && same_multiset(a, s, n);
+        free(a);
+        free(s);
+    }
+    return ok;
+}
+
+/** @brief Тест: потоковый, пакетный, слитый и многопоточный top-k. */
+int test_topk_stream_and_mt() {
+    const size_t n = 300000, k = 1000;
+    bignum_t *a   = malloc(sizeof(bignum_t) * n);
+    bignum_t *s   = malloc(sizeof(bignum_t) * n);
+    bignum_t *out = malloc(sizeof(bignum_t) * k);
+    bignum_topk_t t1, t2;
+    if (a == NULL || s == NULL || out == NULL) {
+        free(a); free(s); free(out);
+        return 0;
+    }
+    fill(a, n);
+    memcpy(s, a, sizeof(bignum_t) * n);
+    qsort(s, n, sizeof(bignum_t), cmp_qsort);
+
+    int ok = bignum_topk_init(&t1, k) == BIGNUM_TOPK_OK && bignum_topk_init(&t2, k) == BIGNUM_TOPK_OK;
+    for (size_t i = 0; ok && i < n / 2; ++i) {
+        ok = bignum_topk_push(&t1, &a[i]) == BIGNUM_TOPK_OK;
+    }
+    ok = ok && bignum_topk_push_batch(&t2, a + n / 2, n - n / 2) == BIGNUM_TOPK_OK
+            && bignum_topk_merge(&t1, &t2) == BIGNUM_TOPK_OK;
+    /* Эталон: s[n-1], s[n-2], …, s[n-k]. */
+    size_t count = 0;
+    ok = ok && bignum_topk_result(&t1, out, &count) == BIGNUM_TOPK_OK && count == k;
+    for (size_t i = 0; ok && i < k; ++i) {
+        ok = bignum_cmp(&out[i], &s[n - 1 - i]) == 0;
+    }
+    bignum_topk_free(&t1);
+    bignum_topk_free(&t2);
+
+    static const unsigned threads[] = { 1, 2, 3, 8, 0 };
+    for (size_t t = 0; ok && t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        memset(out, 0, sizeof(bignum_t) * k);
+        ok = bignum_topk_mt(a, n, k, threads[t], out, &count) == BIGNUM_TOPK_OK && count == k;
+        for (size_t i = 0; ok && i < k; ++i) {
+            ok = bignum_cmp(&out[i], &s[n - 1 - i]) == 0;
+        }
+    }
+    ok = ok && bignum_topk(a, 10, k, out, &count) == BIGNUM_TOPK_OK && count == 10;
+    free(a);
+    free(s);
+    free(out);
+    return ok;
+}
+
+/** @brief Тест: массив равных ключей и ошибки. */
+int test_all_equal_and_errors() {
+    const size_t n = 200000;
+    bignum_t *a = malloc(sizeof(bignum_t) * n);
+    bignum_t out[4], bad;
+    size_t count = 0;
+    bignum_topk_t t;
+    if (a == NULL) {
+        return 0;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        bignum_init_u64(&a[i], 42);
+    }
+    int ok = bignum_nth_element(a, n, n / 2) == BIGNUM_TOPK_OK
+          && bignum_partial_sort(a, n, n) == BIGNUM_TOPK_OK
+          && bignum_cmp(&a[0], &a[n - 1]) == 0
+          && bignum_topk(a, n, 4, out, &count) == BIGNUM_TOPK_OK && count == 4
+          && bignum_cmp(&out[3], &a[0]) == 0;
+
+    memset(&bad, 0, sizeof(bad));
+    bad.len = BIGNUM_CAPACITY + 1;
+    a[7] = bad;
+    ok = ok && bignum_nth_element(a, n, 0) == BIGNUM_TOPK_ERROR_RANGE
+            && bignum_nth_element(a, 0, 0) == BIGNUM_TOPK_ERROR_RANGE
+            && bignum_partial_sort(a, 3, 4) == BIGNUM_TOPK_ERROR_RANGE
+            && bignum_partial_sort(NULL, 3, 1) == BIGNUM_TOPK_ERROR_NULL
+            && bignum_topk_init(&t, 0) == BIGNUM_TOPK_ERROR_RANGE
+            && bignum_topk_init(&t, 2) == BIGNUM_TOPK_OK
+            && bignum_topk_push(&t, &bad) == BIGNUM_TOPK_ERROR_RANGE
+            && bignum_topk_push(&t, NULL) == BIGNUM_TOPK_ERROR_NULL
+            && bignum_topk_result(&t, out, &count) == BIGNUM_TOPK_OK && count == 0
+            && bignum_topk_mt(a, n, 4, 2, NULL, &count) == BIGNUM_TOPK_ERROR_NULL
+            && bignum_topk_mt(a, n, 4, 4, out, &count) == BIGNUM_TOPK_ERROR_RANGE;
+    bignum_topk_free(&t);
+    bignum_topk_free(NULL);
+    free(a);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_topk ---\n");
+    srand(37);
+
+    RUN_TEST(test_nth_element_matches_sort);
+    RUN_TEST(test_partial_sort_prefix);
+    RUN_TEST(test_topk_stream_and_mt);
+    RUN_TEST(test_all_equal_and_errors);
+
+    printf("--- All bignum_topk tests passed ---\n");
+    return 0;
+}
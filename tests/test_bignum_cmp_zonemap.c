@@ -0,0 +1,225 @@
+/**
+ * @file    test_bignum_cmp_zonemap.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief Тесты зональной карты bignum_zonemap_*.
+ *
+ * @details
+ * ### Анализ полноты покрытия
+ * 1.  **Сводки:** `test_zonemap_summaries` — min/max каждого блока совпадают с
+ *     полным перебором; ключи подобраны так, что у многих совпадают `len` и
+ *     старшее слово (путь полного сравнения).
+ * 2.  **Инкрементальное дописывание:** `test_zonemap_incremental_append` —
+ *     карта, построенная порциями случайного размера (с переездом столбца),
+ *     совпадает с построенной за один вызов.
+ * 3.  **Выборка:** `test_zonemap_select_matches_scan` — результат
+ *     `bignum_zonemap_select` совпадает с полным сканированием для случайных
+ *     диапазонов, границ-ключей столбца, открытых границ и `lo > hi`;
+ *     на кластеризованных данных узкий диапазон сравнивает мало строк.
+ * 4.  **Ошибки:** `test_zonemap_errors` — `NULL`, `len > BIGNUM_CAPACITY`,
+ *     укорочение столбца, пустая карта.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Первоначальное создание набора тестов.
+ */
+
+#include "bignum_cmp_zonemap.h"
+#include <bignum_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Макрос для упрощения вывода результатов тестов
+#define RUN_TEST(test_name) \
+    printf("Running test: %s... ", #test_name); \
+    if (test_name()) { \
+        printf("PASSED\n"); \
+    } else { \
+        printf("FAILED\n"); \
+        return -1; \
+    }
+
+#define ROWS  20000
+#define BLOCK 128
+
+static uint64_t rnd64(void)
+{
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+/**
+ * Ключ строки `r`: растущее старшее слово с шумом (кластеризация по блокам),
+ * длина 2, младшее слово случайно — соседние строки часто совпадают префиксом.
+ */
+static void row_key(bignum_t *x, size_t r)
+{
+    uint64_t w[2] = { rnd64(), (uint64_t)(r / 16) + (uint64_t)(rand() % 8) + 1 };
+    bignum_init_from_array(x, w, 2);
+}
+
+static bignum_t *make_column(size_t n)
+{
+    bignum_t *col = malloc(sizeof(bignum_t) * n);
+    for (size_t r = 0; col != NULL && r < n; ++r) {
+        row_key(&col[r], r);
+        if (r % 4099 == 0) {
+            bignum_init_u64(&col[r], rnd64());   /* редкие короткие ключи */
+        }
+    }
+    return col;
+}
+
+/** @brief Тест: сводки блоков совпадают с перебором. */
+int test_zonemap_summaries() {
+    bignum_t *col = make_column(ROWS);
+    bignum_zonemap_t z;
+    int ok = col != NULL
+          && bignum_zonemap_init(&z, BLOCK) == BIGNUM_ZONEMAP_OK
+          && bignum_zonemap_append(&z, col, ROWS) == BIGNUM_ZONEMAP_OK
+          && z.nzones == (ROWS + BLOCK - 1) / BLOCK;
+    for (size_t b = 0; ok && b < z.nzones; ++b) {
+        size_t mn = b * BLOCK, mx = b * BLOCK;
+        for (size_t r = b * BLOCK; r < (b + 1) * BLOCK && r < ROWS; ++r) {
+            if (bignum_cmp(&col[r], &col[mn]) < 0) { mn = r; }
+            if (bignum_cmp(&col[r], &col[mx]) > 0) { mx = r; }
+        }
+        ok = bignum_cmp(&col[z.zones[b].min_row], &col[mn]) == 0
+          && bignum_cmp(&col[z.zones[b].max_row], &col[mx]) == 0
+          && z.zones[b].min_len == col[mn].len && z.zones[b].max_len == col[mx].len;
+    }
+    bignum_zonemap_free(&z);
+    free(col);
+    return ok;
+}
+
+/** @brief Тест: дописывание порциями даёт ту же карту. */
+int test_zonemap_incremental_append() {
+    bignum_t *col = make_column(ROWS);
+    bignum_t *grow = NULL;
+    bignum_zonemap_t whole, inc;
+    int ok = col != NULL
+          && bignum_zonemap_init(&whole, BLOCK) == BIGNUM_ZONEMAP_OK
+          && bignum_zonemap_append(&whole, col, ROWS) == BIGNUM_ZONEMAP_OK
+          && bignum_zonemap_init(&inc, BLOCK) == BIGNUM_ZONEMAP_OK;
+
+    size_t rows = 0;
+    while (ok && rows < ROWS) {
+        size_t add = (size_t)(rand() % 300);
+        if (rows + add > ROWS) {
+            add = ROWS - rows;
+        }
+        bignum_t *p = realloc(grow, sizeof(bignum_t) * (rows + add + 1));
+        if (p == NULL) {
+            ok = 0;
+            break;
+        }
+        grow = p;
+        memcpy(&grow[rows], &col[rows], sizeof(bignum_t) * add);
+        rows += add;
+        ok = bignum_zonemap_append(&inc, grow, rows) == BIGNUM_ZONEMAP_OK && inc.rows == rows;
+    }
+    ok = ok && inc.nzones == whole.nzones;
+    for (size_t b = 0; ok && b < whole.nzones; ++b) {
+        ok = bignum_cmp(&col[inc.zones[b].min_row], &col[whole.zones[b].min_row]) == 0
+          && bignum_cmp(&col[inc.zones[b].max_row], &col[whole.zones[b].max_row]) == 0;
+    }
+    bignum_zonemap_free(&whole);
+    bignum_zonemap_free(&inc);
+    free(grow);
+    free(col);
+    return ok;
+}
+
+/** @brief Тест: выборка совпадает с полным сканированием. */
+int test_zonemap_select_matches_scan() {
+    bignum_t *col  = make_column(ROWS);
+    size_t   *rows = malloc(sizeof(size_t) * ROWS);
+    bignum_zonemap_t z;
+    int ok = col && rows
+          && bignum_zonemap_init(&z, BLOCK) == BIGNUM_ZONEMAP_OK
+          && bignum_zonemap_append(&z, col, ROWS) == BIGNUM_ZONEMAP_OK;
+
+    for (int q = 0; ok && q < 400; ++q) {
+        bignum_t lo, hi;
+        if (q % 2 == 0) {
+            lo = col[rand() % ROWS];                   /* границы — ключи столбца */
+            hi = col[rand() % ROWS];
+        } else {
+            row_key(&lo, (size_t)(rand() % ROWS));
+            row_key(&hi, (size_t)(rand() % ROWS));
+        }
+        if (q % 3 != 0 && bignum_cmp(&lo, &hi) > 0) {
+            bignum_t t = lo; lo = hi; hi = t;        /* иногда оставляем lo > hi */
+        }
+        const bignum_t *plo = (q % 17 == 0) ? NULL : &lo;
+        const bignum_t *phi = (q % 19 == 0) ? NULL : &hi;
+
+        size_t count = 0, scanned = 0, expect = 0;
+        ok = bignum_zonemap_select(&z, col, plo, phi, rows, &count, &scanned) == BIGNUM_ZONEMAP_OK;
+        for (size_t r = 0; ok && r < ROWS; ++r) {
+            int match = (plo == NULL || bignum_cmp(&col[r], plo) >= 0) &&
+                        (phi == NULL || bignum_cmp(&col[r], phi) <= 0);
+            if (match) {
+                ok = expect < count && rows[expect] == r;
+                expect++;
+            }
+        }
+        ok = ok && expect == count && scanned <= ROWS;
+    }
+
+    /* Узкий диапазон на кластеризованных данных: сравниваются единицы блоков. */
+    bignum_t lo = col[ROWS / 2], hi = lo;
+    size_t count = 0, scanned = 0;
+    ok = ok && bignum_zonemap_select(&z, col, &lo, &hi, NULL, &count, &scanned) == BIGNUM_ZONEMAP_OK
+          && count >= 1 && scanned <= 8 * BLOCK;
+
+    bignum_zonemap_free(&z);
+    free(rows);
+    free(col);
+    return ok;
+}
+
+/** @brief Тест: ошибки и вырожденные случаи. */
+int test_zonemap_errors() {
+    bignum_zonemap_t z;
+    bignum_t col[3], bad;
+    size_t count = 7;
+    bignum_init_u64(&col[0], 5);
+    bignum_init_u64(&col[1], 1);
+    bignum_init_u64(&col[2], 9);
+    memset(&bad, 0, sizeof(bad));
+    bad.len = BIGNUM_CAPACITY + 1;
+
+    int ok = bignum_zonemap_init(NULL, 0) == BIGNUM_ZONEMAP_ERROR_NULL
+          && bignum_zonemap_init(&z, 0) == BIGNUM_ZONEMAP_OK && z.block_rows == BIGNUM_ZONEMAP_DEFAULT_BLOCK
+          && bignum_zonemap_select(&z, NULL, NULL, NULL, NULL, &count, NULL) == BIGNUM_ZONEMAP_OK && count == 0
+          && bignum_zonemap_append(&z, col, 3) == BIGNUM_ZONEMAP_OK
+          && bignum_zonemap_append(&z, col, 2) == BIGNUM_ZONEMAP_ERROR_RANGE
+          && bignum_zonemap_append(&z, NULL, 4) == BIGNUM_ZONEMAP_ERROR_NULL
+          && bignum_zonemap_select(&z, col, &bad, NULL, NULL, &count, NULL) == BIGNUM_ZONEMAP_ERROR_RANGE
+          && bignum_zonemap_select(&z, col, NULL, NULL, NULL, NULL, NULL) == BIGNUM_ZONEMAP_ERROR_NULL
+          && bignum_zonemap_classify(&z, col, 0, &col[1], &col[2]) == BIGNUM_ZONEMAP_FULL
+          && bignum_zonemap_classify(&z, col, 0, &col[2], NULL) == BIGNUM_ZONEMAP_PARTIAL
+          && bignum_zonemap_classify(&z, col, 1, NULL, NULL) == BIGNUM_ZONEMAP_SKIP;
+    bignum_t big;
+    bignum_init_u64(&big, 10);
+    ok = ok && bignum_zonemap_classify(&z, col, 0, &big, NULL) == BIGNUM_ZONEMAP_SKIP;
+    bignum_zonemap_free(&z);
+    bignum_zonemap_free(NULL);
+    return ok;
+}
+
+int main() {
+    printf("--- Running tests for bignum_zonemap ---\n");
+    srand(36);
+
+    RUN_TEST(test_zonemap_summaries);
+    RUN_TEST(test_zonemap_incremental_append);
+    RUN_TEST(test_zonemap_select_matches_scan);
+    RUN_TEST(test_zonemap_errors);
+
+    printf("--- All bignum_zonemap tests passed ---\n");
+    return 0;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file    bignum_layout_gen.c
+ * @brief   Генератор bignum_layout.inc — раскладки bignum_t для ассемблерного ядра.
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @details
+ *   Ядро bignum_cmp.asm раньше жёстко предполагало BIGNUM_CAPACITY = 32 и
+ *   смещение `len` = 256. Утилита компилируется с теми же CFLAGS, что и
+ *   библиотека (включая -DBIGNUM_CAPACITY=N), и печатает в stdout
+ *   yasm-include с фактическими значениями из bignum.h. Несовместимая
+ *   раскладка отвергается на этапе компиляции.
+ *
+ * @history
+ *   - rev 1.0 (16.10.2026): Первоначальная версия.
+ *
+ * # Запуск
+ *   make CAPACITY=64 build   (Makefile собирает и запускает утилиту сам)
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <bignum.h>
+
+_Static_assert(offsetof(bignum_t, words) == 0, "bignum_t.words must be the first member");
+_Static_assert(sizeof(((bignum_t *)0)->words[0]) == 8, "bignum_t.words must be 64-bit");
+_Static_assert(sizeof(((bignum_t *)0)->len) == 8, "bignum_t.len must be 64-bit");
+_Static_assert(offsetof(bignum_t, len) >= BIGNUM_CAPACITY * 8, "bignum_t.len overlaps words");
+
+int main(void)
+{
+    printf("; Сгенерировано tools/bignum_layout_gen.c — не редактировать.\n");
+    printf("%%define BIGNUM_CAPACITY     %d\n", (int)BIGNUM_CAPACITY);
+    printf("%%define BIGNUM_WORD_SIZE    %d\n", (int)sizeof(((bignum_t *)0)->words[0]));
+    printf("%%define BIGNUM_OFFSET_WORDS %d\n", (int)offsetof(bignum_t, words));
+    printf("%%define BIGNUM_OFFSET_LEN   %d\n", (int)offsetof(bignum_t, len));
+    printf("%%define BIGNUM_SIZE         %d\n", (int)sizeof(bignum_t));
+    return 0;
+}